@@ -22,6 +22,7 @@
 // Allow use of STL min and max functions in Windows
 #define NOMINMAX
 
+#include <algorithm>
 #include <sstream>
 
 #include "vk_enum_string_helper.h"
@@ -31,216 +32,133 @@
 
 #include "buffer_validation.h"
 
-void SetLayout(layer_data *device_data, GLOBAL_CB_NODE *pCB, ImageSubresourcePair imgpair, const VkImageLayout &layout) {
-    if (pCB->imageLayoutMap.find(imgpair) != pCB->imageLayoutMap.end()) {
-        pCB->imageLayoutMap[imgpair].layout = layout;
-    } else {
-        assert(imgpair.hasSubresource);
-        IMAGE_CMD_BUF_LAYOUT_NODE node;
-        if (!FindCmdBufLayout(device_data, pCB, imgpair.image, imgpair.subresource, node)) {
-            node.initialLayout = layout;
-        }
-        SetLayout(device_data, pCB, imgpair, {node.initialLayout, layout});
-    }
-}
-template <class OBJECT, class LAYOUT>
-void SetLayout(layer_data *device_data, OBJECT *pObject, VkImage image, VkImageSubresource range, const LAYOUT &layout) {
-    ImageSubresourcePair imgpair = {image, true, range};
-    SetLayout(device_data, pObject, imgpair, layout, VK_IMAGE_ASPECT_COLOR_BIT);
-    SetLayout(device_data, pObject, imgpair, layout, VK_IMAGE_ASPECT_DEPTH_BIT);
-    SetLayout(device_data, pObject, imgpair, layout, VK_IMAGE_ASPECT_STENCIL_BIT);
-    SetLayout(device_data, pObject, imgpair, layout, VK_IMAGE_ASPECT_METADATA_BIT);
-}
-
-template <class OBJECT, class LAYOUT>
-void SetLayout(layer_data *device_data, OBJECT *pObject, ImageSubresourcePair imgpair, const LAYOUT &layout,
-               VkImageAspectFlags aspectMask) {
-    if (imgpair.subresource.aspectMask & aspectMask) {
-        imgpair.subresource.aspectMask = aspectMask;
-        SetLayout(device_data, pObject, imgpair, layout);
-    }
-}
-
-// Set the layout in supplied map
-void SetLayout(std::unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> &imageLayoutMap, ImageSubresourcePair imgpair,
-               VkImageLayout layout) {
-    imageLayoutMap[imgpair].layout = layout;
-}
-
-bool FindLayoutVerifyNode(layer_data const *device_data, GLOBAL_CB_NODE const *pCB, ImageSubresourcePair imgpair,
-                          IMAGE_CMD_BUF_LAYOUT_NODE &node, const VkImageAspectFlags aspectMask) {
-    const debug_report_data *report_data = core_validation::GetReportData(device_data);
-
-    if (!(imgpair.subresource.aspectMask & aspectMask)) {
-        return false;
-    }
-    VkImageAspectFlags oldAspectMask = imgpair.subresource.aspectMask;
-    imgpair.subresource.aspectMask = aspectMask;
-    auto imgsubIt = pCB->imageLayoutMap.find(imgpair);
-    if (imgsubIt == pCB->imageLayoutMap.end()) {
-        return false;
-    }
-    if (node.layout != VK_IMAGE_LAYOUT_MAX_ENUM && node.layout != imgsubIt->second.layout) {
-        log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
-                reinterpret_cast<uint64_t &>(imgpair.image), __LINE__, DRAWSTATE_INVALID_LAYOUT, "DS",
-                "Cannot query for VkImage 0x%" PRIx64 " layout when combined aspect mask %d has multiple layout types: %s and %s",
-                reinterpret_cast<uint64_t &>(imgpair.image), oldAspectMask, string_VkImageLayout(node.layout),
-                string_VkImageLayout(imgsubIt->second.layout));
-    }
-    if (node.initialLayout != VK_IMAGE_LAYOUT_MAX_ENUM && node.initialLayout != imgsubIt->second.initialLayout) {
-        log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
-                reinterpret_cast<uint64_t &>(imgpair.image), __LINE__, DRAWSTATE_INVALID_LAYOUT, "DS",
-                "Cannot query for VkImage 0x%" PRIx64
-                " layout when combined aspect mask %d has multiple initial layout types: %s and %s",
-                reinterpret_cast<uint64_t &>(imgpair.image), oldAspectMask, string_VkImageLayout(node.initialLayout),
-                string_VkImageLayout(imgsubIt->second.initialLayout));
-    }
-    node = imgsubIt->second;
-    return true;
-}
-
-bool FindLayoutVerifyLayout(layer_data const *device_data, ImageSubresourcePair imgpair, VkImageLayout &layout,
-                            const VkImageAspectFlags aspectMask) {
-    if (!(imgpair.subresource.aspectMask & aspectMask)) {
-        return false;
-    }
+static const uint32_t kLayoutAspectCount = ImageSubresourceLayouts<IMAGE_LAYOUT_NODE>::kAspectCount;
+
+// Resolve the remaining level and layer counts of range and clip it to the image. Commands with an out of range subresource
+// are reported but still recorded, and the layout maps must not grow past the subresources the image actually has.
+static VkImageSubresourceRange ClipRangeToImage(VkImageSubresourceRange range, const VkImageCreateInfo &create_info) {
+    range.levelCount = range.baseMipLevel < create_info.mipLevels
+                           ? std::min(range.levelCount, create_info.mipLevels - range.baseMipLevel)
+                           : 0;
+    range.layerCount = range.baseArrayLayer < create_info.arrayLayers
+                           ? std::min(range.layerCount, create_info.arrayLayers - range.baseArrayLayer)
+                           : 0;
+    return range;
+}
+
+// Call func(level, first_layer, layer_count, node) for each run of layers in range, whose counts must be resolved, that has a
+// layout on the command buffer level. Where the aspects of range.aspectMask have different layouts an error is reported and node
+// is that of the last aspect.
+template <typename Func>
+static void ForEachCmdBufLayout(layer_data const *device_data, GLOBAL_CB_NODE const *pCB, VkImage image,
+                                const VkImageSubresourceRange &range, Func func) {
+    auto layouts_it = pCB->imageLayoutMap.find(image);
+    if (layouts_it == pCB->imageLayoutMap.end()) return;
     const debug_report_data *report_data = core_validation::GetReportData(device_data);
-    VkImageAspectFlags oldAspectMask = imgpair.subresource.aspectMask;
-    imgpair.subresource.aspectMask = aspectMask;
-    auto imgsubIt = (*core_validation::GetImageLayoutMap(device_data)).find(imgpair);
-    if (imgsubIt == (*core_validation::GetImageLayoutMap(device_data)).end()) {
-        return false;
-    }
-    if (layout != VK_IMAGE_LAYOUT_MAX_ENUM && layout != imgsubIt->second.layout) {
-        log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
-                reinterpret_cast<uint64_t &>(imgpair.image), __LINE__, DRAWSTATE_INVALID_LAYOUT, "DS",
-                "Cannot query for VkImage 0x%" PRIx64 " layout when combined aspect mask %d has multiple layout types: %s and %s",
-                reinterpret_cast<uint64_t &>(imgpair.image), oldAspectMask, string_VkImageLayout(layout),
-                string_VkImageLayout(imgsubIt->second.layout));
+    for (uint32_t level = range.baseMipLevel; level < range.baseMipLevel + range.levelCount; ++level) {
+        layouts_it->second.ForEachSegment(
+            range.aspectMask, level, range.baseArrayLayer, range.layerCount,
+            [&](uint32_t first_layer, uint32_t layer_count, const IMAGE_CMD_BUF_LAYOUT_NODE *const *nodes) {
+                const IMAGE_CMD_BUF_LAYOUT_NODE *node = nullptr;
+                for (uint32_t aspect_index = 0; aspect_index < kLayoutAspectCount; ++aspect_index) {
+                    const IMAGE_CMD_BUF_LAYOUT_NODE *aspect_node = nodes[aspect_index];
+                    if (!aspect_node) continue;
+                    if (node && node->layout != aspect_node->layout) {
+                        log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
+                                reinterpret_cast<uint64_t &>(image), __LINE__, DRAWSTATE_INVALID_LAYOUT, "DS",
+                                "Cannot query for VkImage 0x%" PRIx64
+                                " layout when combined aspect mask %d has multiple layout types: %s and %s",
+                                reinterpret_cast<uint64_t &>(image), range.aspectMask, string_VkImageLayout(node->layout),
+                                string_VkImageLayout(aspect_node->layout));
+                    }
+                    if (node && node->initialLayout != aspect_node->initialLayout) {
+                        log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
+                                reinterpret_cast<uint64_t &>(image), __LINE__, DRAWSTATE_INVALID_LAYOUT, "DS",
+                                "Cannot query for VkImage 0x%" PRIx64
+                                " layout when combined aspect mask %d has multiple initial layout types: %s and %s",
+                                reinterpret_cast<uint64_t &>(image), range.aspectMask, string_VkImageLayout(node->initialLayout),
+                                string_VkImageLayout(aspect_node->initialLayout));
+                    }
+                    node = aspect_node;
+                }
+                if (node) func(level, first_layer, layer_count, *node);
+            });
     }
-    layout = imgsubIt->second.layout;
-    return true;
 }
 
-// Find layout(s) on the command buffer level
-bool FindCmdBufLayout(layer_data const *device_data, GLOBAL_CB_NODE const *pCB, VkImage image, VkImageSubresource range,
-                      IMAGE_CMD_BUF_LAYOUT_NODE &node) {
-    ImageSubresourcePair imgpair = {image, true, range};
-    node = IMAGE_CMD_BUF_LAYOUT_NODE(VK_IMAGE_LAYOUT_MAX_ENUM, VK_IMAGE_LAYOUT_MAX_ENUM);
-    FindLayoutVerifyNode(device_data, pCB, imgpair, node, VK_IMAGE_ASPECT_COLOR_BIT);
-    FindLayoutVerifyNode(device_data, pCB, imgpair, node, VK_IMAGE_ASPECT_DEPTH_BIT);
-    FindLayoutVerifyNode(device_data, pCB, imgpair, node, VK_IMAGE_ASPECT_STENCIL_BIT);
-    FindLayoutVerifyNode(device_data, pCB, imgpair, node, VK_IMAGE_ASPECT_METADATA_BIT);
-    if (node.layout == VK_IMAGE_LAYOUT_MAX_ENUM) {
-        imgpair = {image, false, VkImageSubresource()};
-        auto imgsubIt = pCB->imageLayoutMap.find(imgpair);
-        if (imgsubIt == pCB->imageLayoutMap.end()) return false;
-        // TODO: This is ostensibly a find function but it changes state here
-        node = imgsubIt->second;
+// Set the layout of range on the cmdbuf level. Subresources the command buffer hasn't used yet also get it as their initial layout.
+void SetLayout(layer_data *device_data, GLOBAL_CB_NODE *pCB, VkImage image, const VkImageSubresourceRange &range,
+               const VkImageLayout &layout) {
+    auto &layouts = pCB->imageLayoutMap[image];
+    for (uint32_t aspect_index = 0; aspect_index < kLayoutAspectCount; ++aspect_index) {
+        const VkImageAspectFlags aspect = 1u << aspect_index;
+        if (!(range.aspectMask & aspect)) continue;
+        for (uint32_t level = range.baseMipLevel; level < range.baseMipLevel + range.levelCount; ++level) {
+            layouts.Update(aspect, level, range.baseArrayLayer, range.layerCount,
+                           [layout](uint32_t, uint32_t, const IMAGE_CMD_BUF_LAYOUT_NODE *node) {
+                               return IMAGE_CMD_BUF_LAYOUT_NODE(node ? node->initialLayout : layout, layout);
+                           });
+        }
     }
-    return true;
+    pCB->image_layout_generation++;
 }
 
-// Find layout(s) on the global level
-bool FindGlobalLayout(layer_data *device_data, ImageSubresourcePair imgpair, VkImageLayout &layout) {
-    layout = VK_IMAGE_LAYOUT_MAX_ENUM;
-    FindLayoutVerifyLayout(device_data, imgpair, layout, VK_IMAGE_ASPECT_COLOR_BIT);
-    FindLayoutVerifyLayout(device_data, imgpair, layout, VK_IMAGE_ASPECT_DEPTH_BIT);
-    FindLayoutVerifyLayout(device_data, imgpair, layout, VK_IMAGE_ASPECT_STENCIL_BIT);
-    FindLayoutVerifyLayout(device_data, imgpair, layout, VK_IMAGE_ASPECT_METADATA_BIT);
-    if (layout == VK_IMAGE_LAYOUT_MAX_ENUM) {
-        imgpair = {imgpair.image, false, VkImageSubresource()};
-        auto imgsubIt = (*core_validation::GetImageLayoutMap(device_data)).find(imgpair);
-        if (imgsubIt == (*core_validation::GetImageLayoutMap(device_data)).end()) return false;
-        layout = imgsubIt->second.layout;
+// Set both the initial and current layout of range on the cmdbuf level
+void SetLayout(layer_data *device_data, GLOBAL_CB_NODE *pCB, VkImage image, const VkImageSubresourceRange &range,
+               const IMAGE_CMD_BUF_LAYOUT_NODE &node) {
+    auto &layouts = pCB->imageLayoutMap[image];
+    for (uint32_t aspect_index = 0; aspect_index < kLayoutAspectCount; ++aspect_index) {
+        const VkImageAspectFlags aspect = 1u << aspect_index;
+        if (!(range.aspectMask & aspect)) continue;
+        for (uint32_t level = range.baseMipLevel; level < range.baseMipLevel + range.levelCount; ++level) {
+            layouts.Set(aspect, level, range.baseArrayLayer, range.layerCount, node);
+        }
     }
-    return true;
+    pCB->image_layout_generation++;
 }
 
 bool FindLayouts(layer_data *device_data, VkImage image, std::vector<VkImageLayout> &layouts) {
-    auto sub_data = (*core_validation::GetImageSubresourceMap(device_data)).find(image);
-    if (sub_data == (*core_validation::GetImageSubresourceMap(device_data)).end()) return false;
+    auto layouts_it = core_validation::GetImageLayoutMap(device_data)->find(image);
+    if (layouts_it == core_validation::GetImageLayoutMap(device_data)->end()) return false;
     auto image_state = GetImageState(device_data, image);
     if (!image_state) return false;
-    bool ignoreGlobal = false;
+    const auto &image_layouts = layouts_it->second;
     // TODO: Make this robust for >1 aspect mask. Now it will just say ignore potential errors in this case.
-    if (sub_data->second.size() >= (image_state->createInfo.arrayLayers * image_state->createInfo.mipLevels + 1)) {
-        ignoreGlobal = true;
-    }
-    for (auto imgsubpair : sub_data->second) {
-        if (ignoreGlobal && !imgsubpair.hasSubresource) continue;
-        auto img_data = (*core_validation::GetImageLayoutMap(device_data)).find(imgsubpair);
-        if (img_data != (*core_validation::GetImageLayoutMap(device_data)).end()) {
-            layouts.push_back(img_data->second.layout);
-        }
-    }
-    return true;
-}
-bool FindLayout(const std::unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> &imageLayoutMap, ImageSubresourcePair imgpair,
-                VkImageLayout &layout, const VkImageAspectFlags aspectMask) {
-    if (!(imgpair.subresource.aspectMask & aspectMask)) {
-        return false;
-    }
-    imgpair.subresource.aspectMask = aspectMask;
-    auto imgsubIt = imageLayoutMap.find(imgpair);
-    if (imgsubIt == imageLayoutMap.end()) {
-        return false;
-    }
-    layout = imgsubIt->second.layout;
+    bool ignoreGlobal = image_layouts.SubresourceCount() >=
+                        static_cast<uint64_t>(image_state->createInfo.arrayLayers) * image_state->createInfo.mipLevels;
+    if (!ignoreGlobal && image_layouts.whole_image()) layouts.push_back(image_layouts.whole_image()->layout);
+    image_layouts.ForEachRun([&layouts](VkImageAspectFlags, uint32_t, uint32_t, uint32_t, const IMAGE_LAYOUT_NODE &node) {
+        layouts.push_back(node.layout);
+    });
     return true;
 }
 
-// find layout in supplied map
-bool FindLayout(const std::unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> &imageLayoutMap, ImageSubresourcePair imgpair,
-                VkImageLayout &layout) {
-    layout = VK_IMAGE_LAYOUT_MAX_ENUM;
-    FindLayout(imageLayoutMap, imgpair, layout, VK_IMAGE_ASPECT_COLOR_BIT);
-    FindLayout(imageLayoutMap, imgpair, layout, VK_IMAGE_ASPECT_DEPTH_BIT);
-    FindLayout(imageLayoutMap, imgpair, layout, VK_IMAGE_ASPECT_STENCIL_BIT);
-    FindLayout(imageLayoutMap, imgpair, layout, VK_IMAGE_ASPECT_METADATA_BIT);
-    if (layout == VK_IMAGE_LAYOUT_MAX_ENUM) {
-        imgpair = {imgpair.image, false, VkImageSubresource()};
-        auto imgsubIt = imageLayoutMap.find(imgpair);
-        if (imgsubIt == imageLayoutMap.end()) return false;
-        layout = imgsubIt->second.layout;
+// Node for a subresource taking on layout on the global level, given its current node or null if it has none
+static IMAGE_LAYOUT_NODE GlobalLayoutNode(const ImageSubresourceLayouts<IMAGE_LAYOUT_NODE> &image_layouts,
+                                          const IMAGE_LAYOUT_NODE *node, VkImageLayout layout) {
+    IMAGE_LAYOUT_NODE new_node = {};
+    if (node) {
+        new_node = *node;
+    } else if (image_layouts.whole_image()) {
+        new_node = *image_layouts.whole_image();
     }
-    return true;
+    new_node.layout = layout;
+    return new_node;
 }
 
-// Set the layout on the global level
-void SetGlobalLayout(layer_data *device_data, ImageSubresourcePair imgpair, const VkImageLayout &layout) {
-    VkImage &image = imgpair.image;
-    (*core_validation::GetImageLayoutMap(device_data))[imgpair].layout = layout;
-    auto &image_subresources = (*core_validation::GetImageSubresourceMap(device_data))[image];
-    auto subresource = std::find(image_subresources.begin(), image_subresources.end(), imgpair);
-    if (subresource == image_subresources.end()) {
-        image_subresources.push_back(imgpair);
-    }
-}
-
-// Set the layout on the cmdbuf level
-void SetLayout(layer_data *device_data, GLOBAL_CB_NODE *pCB, ImageSubresourcePair imgpair, const IMAGE_CMD_BUF_LAYOUT_NODE &node) {
-    pCB->imageLayoutMap[imgpair] = node;
-}
 // Set image layout for given VkImageSubresourceRange struct
 void SetImageLayout(layer_data *device_data, GLOBAL_CB_NODE *cb_node, const IMAGE_STATE *image_state,
                     VkImageSubresourceRange image_subresource_range, const VkImageLayout &layout) {
     assert(image_state);
-    for (uint32_t level_index = 0; level_index < image_subresource_range.levelCount; ++level_index) {
-        uint32_t level = image_subresource_range.baseMipLevel + level_index;
-        for (uint32_t layer_index = 0; layer_index < image_subresource_range.layerCount; layer_index++) {
-            uint32_t layer = image_subresource_range.baseArrayLayer + layer_index;
-            VkImageSubresource sub = {image_subresource_range.aspectMask, level, layer};
-            // TODO: If ImageView was created with depth or stencil, transition both layouts as the aspectMask is ignored and both
-            // are used. Verify that the extra implicit layout is OK for descriptor set layout validation
-            if (image_subresource_range.aspectMask & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) {
-                if (FormatIsDepthAndStencil(image_state->createInfo.format)) {
-                    sub.aspectMask |= (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT);
-                }
-            }
-            SetLayout(device_data, cb_node, image_state->image, sub, layout);
+    image_subresource_range = ClipRangeToImage(image_subresource_range, image_state->createInfo);
+    // TODO: If ImageView was created with depth or stencil, transition both layouts as the aspectMask is ignored and both
+    // are used. Verify that the extra implicit layout is OK for descriptor set layout validation
+    if (image_subresource_range.aspectMask & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) {
+        if (FormatIsDepthAndStencil(image_state->createInfo.format)) {
+            image_subresource_range.aspectMask |= (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT);
         }
     }
+    SetLayout(device_data, cb_node, image_state->image, image_subresource_range, layout);
 }
 // Set image layout for given VkImageSubresourceLayers struct
 void SetImageLayout(layer_data *device_data, GLOBAL_CB_NODE *cb_node, const IMAGE_STATE *image_state,
@@ -281,31 +199,25 @@ bool VerifyFramebufferAndRenderPassLayouts(layer_data *device_data, GLOBAL_CB_NO
         auto view_state = GetImageViewState(device_data, image_view);
         assert(view_state);
         const VkImage &image = view_state->create_info.image;
-        const VkImageSubresourceRange &subRange = view_state->create_info.subresourceRange;
+        auto image_state = GetImageState(device_data, image);
+        if (!image_state) continue;
+        VkImageSubresourceRange subRange = ClipRangeToImage(view_state->create_info.subresourceRange, image_state->createInfo);
         auto initial_layout = pRenderPassInfo->pAttachments[i].initialLayout;
-        // TODO: Do not iterate over every possibility - consolidate where possible
-        for (uint32_t j = 0; j < subRange.levelCount; j++) {
-            uint32_t level = subRange.baseMipLevel + j;
-            for (uint32_t k = 0; k < subRange.layerCount; k++) {
-                uint32_t layer = subRange.baseArrayLayer + k;
-                VkImageSubresource sub = {subRange.aspectMask, level, layer};
-                IMAGE_CMD_BUF_LAYOUT_NODE node;
-                if (!FindCmdBufLayout(device_data, pCB, image, sub, node)) {
-                    // Missing layouts will be added during state update
-                    continue;
-                }
-                if (initial_layout != VK_IMAGE_LAYOUT_UNDEFINED && initial_layout != node.layout) {
-                    skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                    __LINE__, DRAWSTATE_INVALID_RENDERPASS, "DS",
-                                    "You cannot start a render pass using attachment %u "
-                                    "where the render pass initial layout is %s and the previous "
-                                    "known layout of the attachment is %s. The layouts must match, or "
-                                    "the render pass initial layout for the attachment must be "
-                                    "VK_IMAGE_LAYOUT_UNDEFINED",
-                                    i, string_VkImageLayout(initial_layout), string_VkImageLayout(node.layout));
-                }
-            }
-        }
+        // Missing layouts will be added during state update
+        ForEachCmdBufLayout(device_data, pCB, image, subRange,
+                            [&](uint32_t, uint32_t, uint32_t, const IMAGE_CMD_BUF_LAYOUT_NODE &node) {
+                                if (initial_layout != VK_IMAGE_LAYOUT_UNDEFINED && initial_layout != node.layout) {
+                                    skip |= log_msg(
+                                        report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
+                                        __LINE__, DRAWSTATE_INVALID_RENDERPASS, "DS",
+                                        "You cannot start a render pass using attachment %u "
+                                        "where the render pass initial layout is %s and the previous "
+                                        "known layout of the attachment is %s. The layouts must match, or "
+                                        "the render pass initial layout for the attachment must be "
+                                        "VK_IMAGE_LAYOUT_UNDEFINED",
+                                        i, string_VkImageLayout(initial_layout), string_VkImageLayout(node.layout));
+                                }
+                            });
     }
     return skip;
 }
@@ -336,28 +248,30 @@ void TransitionSubpassLayouts(layer_data *device_data, GLOBAL_CB_NODE *pCB, cons
     }
 }
 
+// Validate the barrier's oldLayout against the current layout of one aspect of range, the barrier's resolved subresource range
 bool ValidateImageAspectLayout(layer_data *device_data, GLOBAL_CB_NODE *pCB, const VkImageMemoryBarrier *mem_barrier,
-                               uint32_t level, uint32_t layer, VkImageAspectFlags aspect) {
-    if (!(mem_barrier->subresourceRange.aspectMask & aspect)) {
-        return false;
-    }
-    VkImageSubresource sub = {aspect, level, layer};
-    IMAGE_CMD_BUF_LAYOUT_NODE node;
-    if (!FindCmdBufLayout(device_data, pCB, mem_barrier->image, sub, node)) {
+                               VkImageSubresourceRange range, VkImageAspectFlags aspect) {
+    if (!(range.aspectMask & aspect)) {
         return false;
     }
     bool skip = false;
     if (mem_barrier->oldLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
         // TODO: Set memory invalid which is in mem_tracker currently
-    } else if (node.layout != mem_barrier->oldLayout) {
-        skip |=
-            log_msg(core_validation::GetReportData(device_data), VK_DEBUG_REPORT_ERROR_BIT_EXT,
-                    VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, reinterpret_cast<uint64_t>(pCB->commandBuffer), __LINE__,
-                    DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS",
-                    "For image 0x%" PRIxLEAST64 " you cannot transition the layout of aspect %d from %s when current layout is %s.",
-                    reinterpret_cast<const uint64_t &>(mem_barrier->image), aspect, string_VkImageLayout(mem_barrier->oldLayout),
-                    string_VkImageLayout(node.layout));
+        return skip;
     }
+    range.aspectMask = aspect;
+    ForEachCmdBufLayout(device_data, pCB, mem_barrier->image, range,
+                        [&](uint32_t, uint32_t, uint32_t, const IMAGE_CMD_BUF_LAYOUT_NODE &node) {
+                            if (node.layout == mem_barrier->oldLayout) return;
+                            skip |= log_msg(core_validation::GetReportData(device_data), VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                            VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
+                                            reinterpret_cast<uint64_t>(pCB->commandBuffer), __LINE__,
+                                            DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS",
+                                            "For image 0x%" PRIxLEAST64
+                                            " you cannot transition the layout of aspect %d from %s when current layout is %s.",
+                                            reinterpret_cast<const uint64_t &>(mem_barrier->image), aspect,
+                                            string_VkImageLayout(mem_barrier->oldLayout), string_VkImageLayout(node.layout));
+                        });
     return skip;
 }
 
@@ -376,22 +290,25 @@ void TransitionBeginRenderPassLayouts(layer_data *device_data, GLOBAL_CB_NODE *c
     TransitionSubpassLayouts(device_data, cb_state, render_pass_state, 0, framebuffer_state);
 }
 
+// Move one aspect of range, the barrier's resolved subresource range, to the barrier's newLayout. Subresources the command buffer
+// hasn't used yet start out in its oldLayout.
 void TransitionImageAspectLayout(layer_data *device_data, GLOBAL_CB_NODE *pCB, const VkImageMemoryBarrier *mem_barrier,
-                                 uint32_t level, uint32_t layer, VkImageAspectFlags aspect) {
-    if (!(mem_barrier->subresourceRange.aspectMask & aspect)) {
-        return;
-    }
-    VkImageSubresource sub = {aspect, level, layer};
-    IMAGE_CMD_BUF_LAYOUT_NODE node;
-    if (!FindCmdBufLayout(device_data, pCB, mem_barrier->image, sub, node)) {
-        SetLayout(device_data, pCB, mem_barrier->image, sub,
-                  IMAGE_CMD_BUF_LAYOUT_NODE(mem_barrier->oldLayout, mem_barrier->newLayout));
+                                 const VkImageSubresourceRange &range, VkImageAspectFlags aspect) {
+    if (!(range.aspectMask & aspect)) {
         return;
     }
     if (mem_barrier->oldLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
         // TODO: Set memory invalid
     }
-    SetLayout(device_data, pCB, mem_barrier->image, sub, mem_barrier->newLayout);
+    auto &layouts = pCB->imageLayoutMap[mem_barrier->image];
+    for (uint32_t level = range.baseMipLevel; level < range.baseMipLevel + range.levelCount; ++level) {
+        layouts.Update(aspect, level, range.baseArrayLayer, range.layerCount,
+                       [mem_barrier](uint32_t, uint32_t, const IMAGE_CMD_BUF_LAYOUT_NODE *node) {
+                           return IMAGE_CMD_BUF_LAYOUT_NODE(node ? node->initialLayout : mem_barrier->oldLayout,
+                                                            mem_barrier->newLayout);
+                       });
+    }
+    pCB->image_layout_generation++;
 }
 
 bool VerifyAspectsPresent(VkImageAspectFlags aspect_mask, VkFormat format) {
@@ -489,19 +406,12 @@ bool ValidateBarriersToImages(layer_data *device_data, VkCommandBuffer cmdBuffer
                             string_VkFormat(image_create_info->format), aspect_mask, validation_error_map[VALIDATION_ERROR_00302]);
             }
         }
-        uint32_t level_count = ResolveRemainingLevels(&img_barrier->subresourceRange, image_create_info->mipLevels);
-        uint32_t layer_count = ResolveRemainingLayers(&img_barrier->subresourceRange, image_create_info->arrayLayers);
-
-        for (uint32_t j = 0; j < level_count; j++) {
-            uint32_t level = img_barrier->subresourceRange.baseMipLevel + j;
-            for (uint32_t k = 0; k < layer_count; k++) {
-                uint32_t layer = img_barrier->subresourceRange.baseArrayLayer + k;
-                skip |= ValidateImageAspectLayout(device_data, pCB, img_barrier, level, layer, VK_IMAGE_ASPECT_COLOR_BIT);
-                skip |= ValidateImageAspectLayout(device_data, pCB, img_barrier, level, layer, VK_IMAGE_ASPECT_DEPTH_BIT);
-                skip |= ValidateImageAspectLayout(device_data, pCB, img_barrier, level, layer, VK_IMAGE_ASPECT_STENCIL_BIT);
-                skip |= ValidateImageAspectLayout(device_data, pCB, img_barrier, level, layer, VK_IMAGE_ASPECT_METADATA_BIT);
-            }
-        }
+        VkImageSubresourceRange range = ClipRangeToImage(img_barrier->subresourceRange, *image_create_info);
+
+        skip |= ValidateImageAspectLayout(device_data, pCB, img_barrier, range, VK_IMAGE_ASPECT_COLOR_BIT);
+        skip |= ValidateImageAspectLayout(device_data, pCB, img_barrier, range, VK_IMAGE_ASPECT_DEPTH_BIT);
+        skip |= ValidateImageAspectLayout(device_data, pCB, img_barrier, range, VK_IMAGE_ASPECT_STENCIL_BIT);
+        skip |= ValidateImageAspectLayout(device_data, pCB, img_barrier, range, VK_IMAGE_ASPECT_METADATA_BIT);
 
         IMAGE_STATE *image_state = GetImageState(device_data, img_barrier->image);
         if (image_state) {
@@ -522,19 +432,12 @@ void TransitionImageLayouts(layer_data *device_data, VkCommandBuffer cmdBuffer,
         if (!mem_barrier) continue;
 
         VkImageCreateInfo *image_create_info = &(GetImageState(device_data, mem_barrier->image)->createInfo);
-        uint32_t level_count = ResolveRemainingLevels(&mem_barrier->subresourceRange, image_create_info->mipLevels);
-        uint32_t layer_count = ResolveRemainingLayers(&mem_barrier->subresourceRange, image_create_info->arrayLayers);
-
-        for (uint32_t j = 0; j < level_count; j++) {
-            uint32_t level = mem_barrier->subresourceRange.baseMipLevel + j;
-            for (uint32_t k = 0; k < layer_count; k++) {
-                uint32_t layer = mem_barrier->subresourceRange.baseArrayLayer + k;
-                TransitionImageAspectLayout(device_data, pCB, mem_barrier, level, layer, VK_IMAGE_ASPECT_COLOR_BIT);
-                TransitionImageAspectLayout(device_data, pCB, mem_barrier, level, layer, VK_IMAGE_ASPECT_DEPTH_BIT);
-                TransitionImageAspectLayout(device_data, pCB, mem_barrier, level, layer, VK_IMAGE_ASPECT_STENCIL_BIT);
-                TransitionImageAspectLayout(device_data, pCB, mem_barrier, level, layer, VK_IMAGE_ASPECT_METADATA_BIT);
-            }
-        }
+        VkImageSubresourceRange range = ClipRangeToImage(mem_barrier->subresourceRange, *image_create_info);
+
+        TransitionImageAspectLayout(device_data, pCB, mem_barrier, range, VK_IMAGE_ASPECT_COLOR_BIT);
+        TransitionImageAspectLayout(device_data, pCB, mem_barrier, range, VK_IMAGE_ASPECT_DEPTH_BIT);
+        TransitionImageAspectLayout(device_data, pCB, mem_barrier, range, VK_IMAGE_ASPECT_STENCIL_BIT);
+        TransitionImageAspectLayout(device_data, pCB, mem_barrier, range, VK_IMAGE_ASPECT_METADATA_BIT);
     }
 }
 
@@ -545,11 +448,9 @@ bool VerifyImageLayout(layer_data const *device_data, GLOBAL_CB_NODE const *cb_n
     const auto image = image_state->image;
     bool skip = false;
 
-    for (uint32_t i = 0; i < subLayers.layerCount; ++i) {
-        uint32_t layer = i + subLayers.baseArrayLayer;
-        VkImageSubresource sub = {subLayers.aspectMask, subLayers.mipLevel, layer};
-        IMAGE_CMD_BUF_LAYOUT_NODE node;
-        if (FindCmdBufLayout(device_data, cb_node, image, sub, node)) {
+    VkImageSubresourceRange range = {subLayers.aspectMask, subLayers.mipLevel, 1, subLayers.baseArrayLayer, subLayers.layerCount};
+    ForEachCmdBufLayout(
+        device_data, cb_node, image, range, [&](uint32_t, uint32_t, uint32_t, const IMAGE_CMD_BUF_LAYOUT_NODE &node) {
             if (node.layout != explicit_layout) {
                 *error = true;
                 // TODO: Improve log message in the next pass
@@ -560,8 +461,7 @@ bool VerifyImageLayout(layer_data const *device_data, GLOBAL_CB_NODE const *cb_n
                                 caller, reinterpret_cast<const uint64_t &>(image), string_VkImageLayout(explicit_layout),
                                 string_VkImageLayout(node.layout));
             }
-        }
-    }
+        });
     // If optimal_layout is not UNDEFINED, check that layout matches optimal for this case
     if ((VK_IMAGE_LAYOUT_UNDEFINED != optimal_layout) && (explicit_layout != optimal_layout)) {
         if (VK_IMAGE_LAYOUT_GENERAL == explicit_layout) {
@@ -772,9 +672,7 @@ void PostCallRecordCreateImage(layer_data *device_data, const VkImageCreateInfo
     image_state.layout = pCreateInfo->initialLayout;
     image_state.format = pCreateInfo->format;
     GetImageMap(device_data)->insert(std::make_pair(*pImage, std::unique_ptr<IMAGE_STATE>(new IMAGE_STATE(*pImage, pCreateInfo))));
-    ImageSubresourcePair subpair{*pImage, false, VkImageSubresource()};
-    (*core_validation::GetImageSubresourceMap(device_data))[*pImage].push_back(subpair);
-    (*core_validation::GetImageLayoutMap(device_data))[subpair] = image_state;
+    (*core_validation::GetImageLayoutMap(device_data))[*pImage].SetWholeImage(image_state);
 }
 
 bool PreCallValidateDestroyImage(layer_data *device_data, VkImage image, IMAGE_STATE **image_state, VK_OBJECT *obj_struct) {
@@ -801,16 +699,7 @@ void PostCallRecordDestroyImage(layer_data *device_data, VkImage image, IMAGE_ST
     core_validation::ClearMemoryObjectBindings(device_data, obj_struct.handle, kVulkanObjectTypeImage);
     // Remove image from imageMap
     core_validation::GetImageMap(device_data)->erase(image);
-    std::unordered_map<VkImage, std::vector<ImageSubresourcePair>> *imageSubresourceMap =
-        core_validation::GetImageSubresourceMap(device_data);
-
-    const auto &sub_entry = imageSubresourceMap->find(image);
-    if (sub_entry != imageSubresourceMap->end()) {
-        for (const auto &pair : sub_entry->second) {
-            core_validation::GetImageLayoutMap(device_data)->erase(pair);
-        }
-        imageSubresourceMap->erase(sub_entry);
-    }
+    core_validation::GetImageLayoutMap(device_data)->erase(image);
 }
 
 bool ValidateImageAttributes(layer_data *device_data, IMAGE_STATE *image_state, VkImageSubresourceRange range) {
@@ -867,8 +756,7 @@ bool VerifyClearImageLayout(layer_data *device_data, GLOBAL_CB_NODE *cb_node, IM
     bool skip = false;
     const debug_report_data *report_data = core_validation::GetReportData(device_data);
 
-    uint32_t level_count = ResolveRemainingLevels(&range, image_state->createInfo.mipLevels);
-    uint32_t layer_count = ResolveRemainingLayers(&range, image_state->createInfo.arrayLayers);
+    range = ClipRangeToImage(range, image_state->createInfo);
 
     if (dest_image_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) {
         if (dest_image_layout == VK_IMAGE_LAYOUT_GENERAL) {
@@ -893,50 +781,44 @@ bool VerifyClearImageLayout(layer_data *device_data, GLOBAL_CB_NODE *cb_node, IM
         }
     }
 
-    for (uint32_t level_index = 0; level_index < level_count; ++level_index) {
-        uint32_t level = level_index + range.baseMipLevel;
-        for (uint32_t layer_index = 0; layer_index < layer_count; ++layer_index) {
-            uint32_t layer = layer_index + range.baseArrayLayer;
-            VkImageSubresource sub = {range.aspectMask, level, layer};
-            IMAGE_CMD_BUF_LAYOUT_NODE node;
-            if (FindCmdBufLayout(device_data, cb_node, image_state->image, sub, node)) {
-                if (node.layout != dest_image_layout) {
-                    UNIQUE_VALIDATION_ERROR_CODE error_code = VALIDATION_ERROR_01085;
-                    if (strcmp(func_name, "vkCmdClearDepthStencilImage()") == 0) {
-                        error_code = VALIDATION_ERROR_01100;
-                    } else {
-                        assert(strcmp(func_name, "vkCmdClearColorImage()") == 0);
-                    }
-                    skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, 0,
-                                    __LINE__, error_code, "DS",
-                                    "%s: Cannot clear an image whose layout is %s and "
-                                    "doesn't match the current layout %s. %s",
-                                    func_name, string_VkImageLayout(dest_image_layout), string_VkImageLayout(node.layout),
-                                    validation_error_map[error_code]);
-                }
-            }
-        }
-    }
+    ForEachCmdBufLayout(device_data, cb_node, image_state->image, range,
+                        [&](uint32_t, uint32_t, uint32_t, const IMAGE_CMD_BUF_LAYOUT_NODE &node) {
+                            if (node.layout == dest_image_layout) return;
+                            UNIQUE_VALIDATION_ERROR_CODE error_code = VALIDATION_ERROR_01085;
+                            if (strcmp(func_name, "vkCmdClearDepthStencilImage()") == 0) {
+                                error_code = VALIDATION_ERROR_01100;
+                            } else {
+                                assert(strcmp(func_name, "vkCmdClearColorImage()") == 0);
+                            }
+                            skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                            VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, 0, __LINE__, error_code, "DS",
+                                            "%s: Cannot clear an image whose layout is %s and "
+                                            "doesn't match the current layout %s. %s",
+                                            func_name, string_VkImageLayout(dest_image_layout), string_VkImageLayout(node.layout),
+                                            validation_error_map[error_code]);
+                        });
 
     return skip;
 }
 
 void RecordClearImageLayout(layer_data *device_data, GLOBAL_CB_NODE *cb_node, VkImage image, VkImageSubresourceRange range,
                             VkImageLayout dest_image_layout) {
-    VkImageCreateInfo *image_create_info = &(GetImageState(device_data, image)->createInfo);
-    uint32_t level_count = ResolveRemainingLevels(&range, image_create_info->mipLevels);
-    uint32_t layer_count = ResolveRemainingLayers(&range, image_create_info->arrayLayers);
-
-    for (uint32_t level_index = 0; level_index < level_count; ++level_index) {
-        uint32_t level = level_index + range.baseMipLevel;
-        for (uint32_t layer_index = 0; layer_index < layer_count; ++layer_index) {
-            uint32_t layer = layer_index + range.baseArrayLayer;
-            VkImageSubresource sub = {range.aspectMask, level, layer};
-            IMAGE_CMD_BUF_LAYOUT_NODE node;
-            if (!FindCmdBufLayout(device_data, cb_node, image, sub, node)) {
-                SetLayout(device_data, cb_node, image, sub, IMAGE_CMD_BUF_LAYOUT_NODE(dest_image_layout, dest_image_layout));
-            }
-        }
+    range = ClipRangeToImage(range, GetImageState(device_data, image)->createInfo);
+
+    // Subresources the command buffer hasn't used in any of the cleared aspects start out in dest_image_layout
+    std::vector<VkImageSubresourceRange> unused_ranges;
+    auto &layouts = cb_node->imageLayoutMap[image];
+    for (uint32_t level = range.baseMipLevel; level < range.baseMipLevel + range.levelCount; ++level) {
+        layouts.ForEachSegment(range.aspectMask, level, range.baseArrayLayer, range.layerCount,
+                               [&](uint32_t first_layer, uint32_t count, const IMAGE_CMD_BUF_LAYOUT_NODE *const *nodes) {
+                                   for (uint32_t aspect_index = 0; aspect_index < kLayoutAspectCount; ++aspect_index) {
+                                       if (nodes[aspect_index]) return;
+                                   }
+                                   unused_ranges.push_back({range.aspectMask, level, 1, first_layer, count});
+                               });
+    }
+    for (const auto &unused_range : unused_ranges) {
+        SetLayout(device_data, cb_node, image, unused_range, IMAGE_CMD_BUF_LAYOUT_NODE(dest_image_layout, dest_image_layout));
     }
 }
 
@@ -967,11 +849,7 @@ void PreCallRecordCmdClearImage(layer_data *dev_data, VkCommandBuffer commandBuf
     auto image_state = GetImageState(dev_data, image);
     if (cb_node && image_state) {
         AddCommandBufferBindingImage(dev_data, cb_node, image_state);
-        std::function<bool()> function = [=]() {
-            SetImageMemoryValid(dev_data, image_state, true);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        cb_node->deferred_checks->SetImageMemoryValid(image_state, true);
         core_validation::UpdateCmdBufferLastCmd(cb_node, cmd_type);
         for (uint32_t i = 0; i < rangeCount; ++i) {
             RecordClearImageLayout(dev_data, cb_node, image, pRanges[i], imageLayout);
@@ -1603,13 +1481,8 @@ void PreCallRecordCmdCopyImage(layer_data *device_data, GLOBAL_CB_NODE *cb_node,
     // Update bindings between images and cmd buffer
     AddCommandBufferBindingImage(device_data, cb_node, src_image_state);
     AddCommandBufferBindingImage(device_data, cb_node, dst_image_state);
-    std::function<bool()> function = [=]() { return ValidateImageMemoryIsValid(device_data, src_image_state, "vkCmdCopyImage()"); };
-    cb_node->validate_functions.push_back(function);
-    function = [=]() {
-        SetImageMemoryValid(device_data, dst_image_state, true);
-        return false;
-    };
-    cb_node->validate_functions.push_back(function);
+    cb_node->deferred_checks->ValidateImageMemory(src_image_state, "vkCmdCopyImage()");
+    cb_node->deferred_checks->SetImageMemoryValid(dst_image_state, true);
     core_validation::UpdateCmdBufferLastCmd(cb_node, CMD_COPYIMAGE);
 }
 
@@ -1821,15 +1694,8 @@ void PreCallRecordCmdResolveImage(layer_data *device_data, GLOBAL_CB_NODE *cb_no
     AddCommandBufferBindingImage(device_data, cb_node, src_image_state);
     AddCommandBufferBindingImage(device_data, cb_node, dst_image_state);
 
-    std::function<bool()> function = [=]() {
-        return ValidateImageMemoryIsValid(device_data, src_image_state, "vkCmdResolveImage()");
-    };
-    cb_node->validate_functions.push_back(function);
-    function = [=]() {
-        SetImageMemoryValid(device_data, dst_image_state, true);
-        return false;
-    };
-    cb_node->validate_functions.push_back(function);
+    cb_node->deferred_checks->ValidateImageMemory(src_image_state, "vkCmdResolveImage()");
+    cb_node->deferred_checks->SetImageMemoryValid(dst_image_state, true);
     core_validation::UpdateCmdBufferLastCmd(cb_node, CMD_RESOLVEIMAGE);
 }
 
@@ -1997,62 +1863,66 @@ void PreCallRecordCmdBlitImage(layer_data *device_data, GLOBAL_CB_NODE *cb_node,
     AddCommandBufferBindingImage(device_data, cb_node, src_image_state);
     AddCommandBufferBindingImage(device_data, cb_node, dst_image_state);
 
-    std::function<bool()> function = [=]() { return ValidateImageMemoryIsValid(device_data, src_image_state, "vkCmdBlitImage()"); };
-    cb_node->validate_functions.push_back(function);
-    function = [=]() {
-        SetImageMemoryValid(device_data, dst_image_state, true);
-        return false;
-    };
-    cb_node->validate_functions.push_back(function);
+    cb_node->deferred_checks->ValidateImageMemory(src_image_state, "vkCmdBlitImage()");
+    cb_node->deferred_checks->SetImageMemoryValid(dst_image_state, true);
     core_validation::UpdateCmdBufferLastCmd(cb_node, CMD_BLITIMAGE);
 }
 
 // This validates that the initial layout specified in the command buffer for
 // the IMAGE is the same
-// as the global IMAGE layout
-bool ValidateCmdBufImageLayouts(layer_data *device_data, GLOBAL_CB_NODE *pCB,
-                                std::unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> &imageLayoutMap) {
+// as the global IMAGE layout, as updated by earlier command buffers in the same submission (overlayLayoutMap)
+bool ValidateCmdBufImageLayouts(layer_data *device_data, GLOBAL_CB_NODE *pCB, GlobalImageLayoutMap &overlayLayoutMap) {
     bool skip = false;
     const debug_report_data *report_data = core_validation::GetReportData(device_data);
-    for (auto cb_image_data : pCB->imageLayoutMap) {
-        VkImageLayout imageLayout;
-
-        if (FindLayout(imageLayoutMap, cb_image_data.first, imageLayout)) {
-            if (cb_image_data.second.initialLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
-                // TODO: Set memory invalid which is in mem_tracker currently
-            } else if (imageLayout != cb_image_data.second.initialLayout) {
-                if (cb_image_data.first.hasSubresource) {
-                    skip |= log_msg(
-                        report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                        reinterpret_cast<uint64_t &>(pCB->commandBuffer), __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS",
-                        "Cannot submit cmd buffer using image (0x%" PRIx64
-                        ") [sub-resource: aspectMask 0x%X array layer %u, mip level %u], "
-                        "with layout %s when first use is %s.",
-                        reinterpret_cast<const uint64_t &>(cb_image_data.first.image), cb_image_data.first.subresource.aspectMask,
-                        cb_image_data.first.subresource.arrayLayer, cb_image_data.first.subresource.mipLevel,
-                        string_VkImageLayout(imageLayout), string_VkImageLayout(cb_image_data.second.initialLayout));
-                } else {
-                    skip |=
-                        log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                                reinterpret_cast<uint64_t &>(pCB->commandBuffer), __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS",
-                                "Cannot submit cmd buffer using image (0x%" PRIx64
-                                ") with layout %s when "
-                                "first use is %s.",
-                                reinterpret_cast<const uint64_t &>(cb_image_data.first.image), string_VkImageLayout(imageLayout),
-                                string_VkImageLayout(cb_image_data.second.initialLayout));
-                }
-            }
-            SetLayout(imageLayoutMap, cb_image_data.first, cb_image_data.second.layout);
-        }
+    const auto &globalLayoutMap = *core_validation::GetImageLayoutMap(device_data);
+    for (const auto &cb_image_data : pCB->imageLayoutMap) {
+        const VkImage image = cb_image_data.first;
+        // The submission's view of an image starts from its global layouts the first time one of its command buffers uses it
+        auto overlay_it = overlayLayoutMap.find(image);
+        if (overlay_it == overlayLayoutMap.end()) {
+            auto global_it = globalLayoutMap.find(image);
+            if (global_it == globalLayoutMap.end()) continue;
+            overlay_it = overlayLayoutMap.insert(*global_it).first;
+        }
+        auto &image_layouts = overlay_it->second;
+        cb_image_data.second.ForEachRun([&](VkImageAspectFlags aspect, uint32_t level, uint32_t first_layer, uint32_t layer_count,
+                                            const IMAGE_CMD_BUF_LAYOUT_NODE &cb_layout) {
+            image_layouts.Update(aspect, level, first_layer, layer_count,
+                                 [&](uint32_t first, uint32_t, const IMAGE_LAYOUT_NODE *node) {
+                                     if (!node) node = image_layouts.whole_image();
+                                     if (!node || cb_layout.initialLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
+                                         // TODO: Set memory invalid which is in mem_tracker currently
+                                     } else if (node->layout != cb_layout.initialLayout) {
+                                         skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                                         VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
+                                                         reinterpret_cast<uint64_t &>(pCB->commandBuffer), __LINE__,
+                                                         DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS",
+                                                         "Cannot submit cmd buffer using image (0x%" PRIx64
+                                                         ") [sub-resource: aspectMask 0x%X array layer %u, mip level %u], "
+                                                         "with layout %s when first use is %s.",
+                                                         reinterpret_cast<const uint64_t &>(image), aspect, first, level,
+                                                         string_VkImageLayout(node->layout),
+                                                         string_VkImageLayout(cb_layout.initialLayout));
+                                     }
+                                     return GlobalLayoutNode(image_layouts, node, cb_layout.layout);
+                                 });
+        });
     }
     return skip;
 }
 
 void UpdateCmdBufImageLayouts(layer_data *device_data, GLOBAL_CB_NODE *pCB) {
-    for (auto cb_image_data : pCB->imageLayoutMap) {
-        VkImageLayout imageLayout;
-        FindGlobalLayout(device_data, cb_image_data.first, imageLayout);
-        SetGlobalLayout(device_data, cb_image_data.first, cb_image_data.second.layout);
+    auto &globalLayoutMap = *core_validation::GetImageLayoutMap(device_data);
+    for (const auto &cb_image_data : pCB->imageLayoutMap) {
+        if (cb_image_data.second.empty()) continue;
+        auto &image_layouts = globalLayoutMap[cb_image_data.first];
+        cb_image_data.second.ForEachRun([&image_layouts](VkImageAspectFlags aspect, uint32_t level, uint32_t first_layer,
+                                                         uint32_t layer_count, const IMAGE_CMD_BUF_LAYOUT_NODE &cb_layout) {
+            image_layouts.Update(aspect, level, first_layer, layer_count,
+                                 [&](uint32_t, uint32_t, const IMAGE_LAYOUT_NODE *node) {
+                                     return GlobalLayoutNode(image_layouts, node, cb_layout.layout);
+                                 });
+        });
     }
 }
 
@@ -2665,15 +2535,8 @@ void PreCallRecordCmdCopyBuffer(layer_data *device_data, GLOBAL_CB_NODE *cb_node
     AddCommandBufferBindingBuffer(device_data, cb_node, src_buffer_state);
     AddCommandBufferBindingBuffer(device_data, cb_node, dst_buffer_state);
 
-    std::function<bool()> function = [=]() {
-        return ValidateBufferMemoryIsValid(device_data, src_buffer_state, "vkCmdCopyBuffer()");
-    };
-    cb_node->validate_functions.push_back(function);
-    function = [=]() {
-        SetBufferMemoryValid(device_data, dst_buffer_state, true);
-        return false;
-    };
-    cb_node->validate_functions.push_back(function);
+    cb_node->deferred_checks->ValidateBufferMemory(src_buffer_state, "vkCmdCopyBuffer()");
+    cb_node->deferred_checks->SetBufferMemoryValid(dst_buffer_state, true);
     core_validation::UpdateCmdBufferLastCmd(cb_node, CMD_COPYBUFFER);
 }
 
@@ -2771,11 +2634,7 @@ bool PreCallValidateCmdFillBuffer(layer_data *device_data, GLOBAL_CB_NODE *cb_no
 }
 
 void PreCallRecordCmdFillBuffer(layer_data *device_data, GLOBAL_CB_NODE *cb_node, BUFFER_STATE *buffer_state) {
-    std::function<bool()> function = [=]() {
-        SetBufferMemoryValid(device_data, buffer_state, true);
-        return false;
-    };
-    cb_node->validate_functions.push_back(function);
+    cb_node->deferred_checks->SetBufferMemoryValid(buffer_state, true);
     // Update bindings between buffer and cmd buffer
     AddCommandBufferBindingBuffer(device_data, cb_node, buffer_state);
     core_validation::UpdateCmdBufferLastCmd(cb_node, CMD_FILLBUFFER);
@@ -3143,15 +3002,8 @@ void PreCallRecordCmdCopyImageToBuffer(layer_data *device_data, GLOBAL_CB_NODE *
     AddCommandBufferBindingImage(device_data, cb_node, src_image_state);
     AddCommandBufferBindingBuffer(device_data, cb_node, dst_buffer_state);
 
-    std::function<bool()> function = [=]() {
-        return ValidateImageMemoryIsValid(device_data, src_image_state, "vkCmdCopyImageToBuffer()");
-    };
-    cb_node->validate_functions.push_back(function);
-    function = [=]() {
-        SetBufferMemoryValid(device_data, dst_buffer_state, true);
-        return false;
-    };
-    cb_node->validate_functions.push_back(function);
+    cb_node->deferred_checks->ValidateImageMemory(src_image_state, "vkCmdCopyImageToBuffer()");
+    cb_node->deferred_checks->SetBufferMemoryValid(dst_buffer_state, true);
 
     core_validation::UpdateCmdBufferLastCmd(cb_node, CMD_COPYIMAGETOBUFFER);
 }
@@ -3215,13 +3067,8 @@ void PreCallRecordCmdCopyBufferToImage(layer_data *device_data, GLOBAL_CB_NODE *
     }
     AddCommandBufferBindingBuffer(device_data, cb_node, src_buffer_state);
     AddCommandBufferBindingImage(device_data, cb_node, dst_image_state);
-    std::function<bool()> function = [=]() {
-        SetImageMemoryValid(device_data, dst_image_state, true);
-        return false;
-    };
-    cb_node->validate_functions.push_back(function);
-    function = [=]() { return ValidateBufferMemoryIsValid(device_data, src_buffer_state, "vkCmdCopyBufferToImage()"); };
-    cb_node->validate_functions.push_back(function);
+    cb_node->deferred_checks->SetImageMemoryValid(dst_image_state, true);
+    cb_node->deferred_checks->ValidateBufferMemory(src_buffer_state, "vkCmdCopyBufferToImage()");
 
     core_validation::UpdateCmdBufferLastCmd(cb_node, CMD_COPYBUFFERTOIMAGE);
 }
@@ -39,6 +39,8 @@
 #include <SPIRV/spirv.hpp>
 #include <algorithm>
 #include <assert.h>
+#include <condition_variable>
+#include <fstream>
 #include <iostream>
 #include <list>
 #include <map>
@@ -49,6 +51,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <inttypes.h>
 
@@ -65,6 +68,7 @@
 #include "buffer_validation.h"
 #include "vk_layer_table.h"
 #include "vk_layer_data.h"
+#include "vk_layer_command_table.h"
 #include "vk_layer_extension_utils.h"
 #include "vk_layer_utils.h"
 #include "spirv-tools/libspirv.h"
@@ -118,6 +122,8 @@ static const uint32_t kSurfaceSizeFromSwapchain = 0xFFFFFFFFu;
 
 // fwd decls
 struct shader_module;
+class shader_validation_cache;
+class validation_thread_pool;
 
 struct instance_layer_data {
     VkInstance instance = VK_NULL_HANDLE;
@@ -165,11 +171,11 @@ struct layer_data {
     unordered_map<VkQueryPool, QUERY_POOL_NODE> queryPoolMap;
     unordered_map<VkSemaphore, SEMAPHORE_NODE> semaphoreMap;
     unordered_map<VkCommandBuffer, GLOBAL_CB_NODE *> commandBufferMap;
+    vector<GLOBAL_CB_NODE *> free_cb_nodes;  // Reset nodes of freed command buffers, recycled by AllocateCommandBuffers
     unordered_map<VkFramebuffer, unique_ptr<FRAMEBUFFER_STATE>> frameBufferMap;
-    unordered_map<VkImage, vector<ImageSubresourcePair>> imageSubresourceMap;
-    unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> imageLayoutMap;
+    GlobalImageLayoutMap imageLayoutMap;
     unordered_map<VkRenderPass, unique_ptr<RENDER_PASS_STATE>> renderPassMap;
-    unordered_map<VkShaderModule, unique_ptr<shader_module>> shaderModuleMap;
+    unordered_map<VkShaderModule, std::shared_ptr<shader_module>> shaderModuleMap;
     unordered_map<VkDescriptorUpdateTemplateKHR, unique_ptr<TEMPLATE_STATE>> desc_template_map;
     unordered_map<VkSwapchainKHR, std::unique_ptr<SWAPCHAIN_NODE>> swapchainMap;
     unordered_map<VkImage, VkSwapchainKHR> imageToSwapchainMap;
@@ -184,6 +190,13 @@ struct layer_data {
     PHYS_DEV_PROPERTIES_NODE phys_dev_properties = {};
     VkPhysicalDeviceMemoryProperties phys_dev_mem_props = {};
     VkPhysicalDeviceProperties phys_dev_props = {};
+
+    // SPIR-V validation state shared by all shader modules created on this device
+    spv_context spirv_context = nullptr;
+    std::unique_ptr<shader_validation_cache> shader_cache;
+    std::string shader_cache_filename;
+    // Helper threads for validating large batches of pipelines
+    std::unique_ptr<validation_thread_pool> validation_threads;
 };
 
 // TODO : Do we need to guard access to layer_data_map w/ lock?
@@ -263,7 +276,9 @@ struct shader_module {
     vector<uint32_t> words;
     // A mapping of <id> to the first word of its def. this is useful because walking type
     // trees, constant expressions, etc requires jumping all over the instruction stream.
-    unordered_map<unsigned, unsigned> def_index;
+    // SPIR-V ids are dense and below the id bound in the header, so this is indexed directly
+    // by id; 0 means no def was recorded (no instruction starts inside the header).
+    vector<uint32_t> def_index;
     bool has_valid_spirv;
 
     shader_module(VkShaderModuleCreateInfo const *pCreateInfo)
@@ -283,16 +298,301 @@ struct shader_module {
 
     // Gets an iterator to the definition of an id
     spirv_inst_iter get_def(unsigned id) const {
-        auto it = def_index.find(id);
-        if (it == def_index.end()) {
+        if (id >= def_index.size() || !def_index[id]) {
             return end();
         }
-        return at(it->second);
+        return at(def_index[id]);
+    }
+
+    void set_def(unsigned id, uint32_t offset) {
+        // Ids at or above the header's bound are invalid; ignore them rather than growing the index to match
+        if (id >= words[3]) return;
+        if (id >= def_index.size()) def_index.resize(id + 1);
+        def_index[id] = offset;
+    }
+};
+
+// Remembers which SPIR-V blobs have passed spvValidate, keyed by a hash of their words, along with the parsed shader_module so
+// that creating an identical module again (e.g. on every level load) skips both validation and parsing. Entries only hold weak
+// references, so a module is freed once every VkShaderModule using it is destroyed, and expired entries are swept as the cache
+// grows. A hash match is never enough on its own: every hit is confirmed against the full words.
+// The words of valid modules can optionally be persisted to a file, tagged with the SPIRV-Tools version that validated them, so
+// later runs also skip revalidation. Whole modules are kept, as raw words, because a hit must match every word; the file and
+// the copies held for it are capped at kMaxSavedWords (16 MiB), past which new modules aren't saved. Saved entries are reparsed
+// on first use. Only successfully validated modules are cached, so warnings and errors are always reported.
+class shader_validation_cache {
+   public:
+    enum lookup_result {
+        miss,
+        validated,  // Validated and parsed in this run; the parsed module is returned
+        saved,      // Matches words saved by an earlier run
+    };
+
+    static uint64_t hash(uint32_t const *words, size_t word_count) {
+        // FNV-1a over the 32-bit words
+        uint64_t h = 14695981039346656037ULL;
+        for (size_t i = 0; i < word_count; ++i) {
+            h ^= words[i];
+            h *= 1099511628211ULL;
+        }
+        return h ^ word_count;
+    }
+
+    lookup_result find(uint64_t h, uint32_t const *words, size_t word_count, std::shared_ptr<shader_module> *out_module) const {
+        auto it = entries_.find(h);
+        if (it == entries_.end()) return miss;
+        auto module = it->second.module.lock();
+        if (module && module->words.size() == word_count && std::equal(module->words.begin(), module->words.end(), words)) {
+            *out_module = module;
+            return validated;
+        }
+        auto const &saved_words = it->second.saved_words;
+        if (saved_words.size() == word_count && std::equal(saved_words.begin(), saved_words.end(), words)) return saved;
+        return miss;
+    }
+
+    void insert(uint64_t h, std::shared_ptr<shader_module> const &module) {
+        auto &entry = entries_[h];
+        entry.module = module;
+        if (persistent_ && entry.saved_words.empty() && saved_word_count_ + module->words.size() <= kMaxSavedWords) {
+            entry.saved_words = module->words;
+            saved_word_count_ += module->words.size();
+            dirty_ = true;
+        }
+        if (entries_.size() >= sweep_threshold_) sweep();
+    }
+
+    // Read the entries saved by an earlier run, and save new ones from this run when the cache is destroyed
+    void load(const char *filename) {
+        persistent_ = true;
+        std::ifstream file(filename, std::ios::binary);
+        std::string header;
+        if (!file || !std::getline(file, header) || header != file_header()) return;
+        uint32_t word_count;
+        while (file.read(reinterpret_cast<char *>(&word_count), sizeof(word_count))) {
+            if (word_count == 0 || saved_word_count_ + word_count > kMaxSavedWords) break;
+            std::vector<uint32_t> words(word_count);
+            if (!file.read(reinterpret_cast<char *>(words.data()), word_count * sizeof(uint32_t))) break;
+            auto &entry = entries_[hash(words.data(), word_count)];
+            if (!entry.saved_words.empty()) continue;
+            entry.saved_words = std::move(words);
+            saved_word_count_ += word_count;
+        }
+    }
+
+    void save(const char *filename) const {
+        if (!dirty_) return;
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        if (!file) return;
+        // A text header line identifying the layer and SPIRV-Tools versions, then a 32-bit word count and the words of each
+        // module, in host byte order
+        file << file_header() << "\n";
+        for (auto const &entry : entries_) {
+            auto const &words = entry.second.saved_words;
+            if (words.empty()) continue;
+            uint32_t word_count = static_cast<uint32_t>(words.size());
+            file.write(reinterpret_cast<char const *>(&word_count), sizeof(word_count));
+            file.write(reinterpret_cast<char const *>(words.data()), word_count * sizeof(uint32_t));
+        }
+    }
+
+   private:
+    // Upper bound on the SPIR-V kept for the cache file, in words
+    static const size_t kMaxSavedWords = 16 * 1024 * 1024 / sizeof(uint32_t);
+    static const size_t kMinSweepThreshold = 256;
+
+    struct entry {
+        std::weak_ptr<shader_module> module;  // Expired until the module is created in this run, and once it's destroyed
+        std::vector<uint32_t> saved_words;    // Only for entries that are (or will be) in the cache file
+    };
+
+    // Drop entries whose modules have all been destroyed, unless they're kept for the cache file
+    void sweep() {
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (it->second.module.expired() && it->second.saved_words.empty()) {
+                it = entries_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        sweep_threshold_ = entries_.size() * 2 > kMinSweepThreshold ? entries_.size() * 2 : kMinSweepThreshold;
+    }
+
+    static std::string file_header() {
+        return "VkLayer_core_validation shader cache 2 " + std::to_string(VK_HEADER_VERSION) + " " + spvSoftwareVersionString();
+    }
+
+    std::unordered_map<uint64_t, entry> entries_;
+    size_t saved_word_count_ = 0;
+    size_t sweep_threshold_ = kMinSweepThreshold;
+    bool persistent_ = false;
+    bool dirty_ = false;
+};
+
+// Reader/writer lock protecting the layer's global state. Entry points that only record into a single command buffer take it
+// shared: per-CB state is externally synchronized by the app, the object maps are only read, and the remaining shared writes
+// (BASE_NODE::cb_bindings) go through BASE_NODE::AddBoundCommandBuffer(). Pipeline creation also validates under a shared lock,
+// since it only writes to the not-yet-published PIPELINE_STATEs. Everything else takes it exclusive. Writers are
+// preferred so that a steady stream of recording threads can't starve object creation/destruction or queue submission.
+class rw_lock {
+   public:
+    rw_lock() : readers_(0), writers_waiting_(0), writer_(false) {}
+
+    void lock() {
+        std::unique_lock<std::mutex> guard(mutex_);
+        writers_waiting_++;
+        writer_cv_.wait(guard, [this]() { return !writer_ && readers_ == 0; });
+        writers_waiting_--;
+        writer_ = true;
+    }
+    void unlock() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        writer_ = false;
+        if (writers_waiting_) {
+            writer_cv_.notify_one();
+        } else {
+            reader_cv_.notify_all();
+        }
+    }
+    void lock_shared() {
+        std::unique_lock<std::mutex> guard(mutex_);
+        reader_cv_.wait(guard, [this]() { return !writer_ && writers_waiting_ == 0; });
+        readers_++;
+    }
+    void unlock_shared() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (--readers_ == 0 && writers_waiting_) writer_cv_.notify_one();
+    }
+
+   private:
+    std::mutex mutex_;
+    std::condition_variable reader_cv_;
+    std::condition_variable writer_cv_;
+    uint32_t readers_;
+    uint32_t writers_waiting_;
+    bool writer_;
+};
+
+// Scoped shared ownership of an rw_lock, with the same lock()/unlock() usage as the std::unique_lock<rw_lock> exclusive case
+class read_lock {
+   public:
+    explicit read_lock(rw_lock &lock) : lock_(lock), owned_(true) { lock_.lock_shared(); }
+    ~read_lock() {
+        if (owned_) lock_.unlock_shared();
+    }
+    void lock() {
+        lock_.lock_shared();
+        owned_ = true;
     }
+    void unlock() {
+        lock_.unlock_shared();
+        owned_ = false;
+    }
+
+   private:
+    read_lock(const read_lock &) = delete;
+    read_lock &operator=(const read_lock &) = delete;
+    rw_lock &lock_;
+    bool owned_;
+};
+
+static rw_lock global_lock;
+
+// Threads that help the calling thread work through a batch of items. They are started by the first batch and then wait for
+// further batches until the device is destroyed, so a batch only pays for waking them rather than for thread startup.
+class validation_thread_pool {
+   public:
+    validation_thread_pool() : helper_count_(std::max(1u, std::thread::hardware_concurrency()) - 1) {}
+    ~validation_thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto &thread : threads_) thread.join();
+    }
+
+    // Number of threads a batch is spread over, counting the calling thread
+    uint32_t thread_count() const { return helper_count_ + 1; }
+
+    // Call func(i) for every i in [0, count) on the calling thread and the helpers, returning once every call has finished.
+    // While another thread's batch is running, the calling thread works through its batch alone.
+    void run(uint32_t count, const std::function<void(uint32_t)> &func) {
+        std::unique_lock<std::mutex> run_lock(run_lock_, std::try_to_lock);
+        if (!run_lock.owns_lock() || helper_count_ == 0) {
+            for (uint32_t i = 0; i < count; ++i) func(i);
+            return;
+        }
+        std::unique_lock<std::mutex> lock(lock_);
+        while (threads_.size() < helper_count_) threads_.emplace_back(&validation_thread_pool::work, this);
+        func_ = &func;
+        count_ = count;
+        next_index_ = 0;
+        busy_ = helper_count_;
+        ++generation_;
+        lock.unlock();
+        wake_.notify_all();
+        take_items();
+        lock.lock();
+        done_.wait(lock, [this]() { return busy_ == 0; });
+        func_ = nullptr;
+    }
+
+   private:
+    validation_thread_pool(const validation_thread_pool &) = delete;
+    validation_thread_pool &operator=(const validation_thread_pool &) = delete;
+
+    void take_items() {
+        for (uint32_t i = next_index_++; i < count_; i = next_index_++) (*func_)(i);
+    }
+
+    void work() {
+        uint64_t generation = 0;
+        std::unique_lock<std::mutex> lock(lock_);
+        while (true) {
+            wake_.wait(lock, [&]() { return stop_ || generation_ != generation; });
+            if (stop_) return;
+            generation = generation_;
+            lock.unlock();
+            take_items();
+            lock.lock();
+            if (--busy_ == 0) done_.notify_one();
+        }
+    }
+
+    const uint32_t helper_count_;
+    std::mutex run_lock_;  // Held for the duration of a batch
+    std::mutex lock_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void(uint32_t)> *func_ = nullptr;
+    uint32_t count_ = 0;
+    std::atomic<uint32_t> next_index_{0};
+    uint32_t busy_ = 0;  // Helpers still working on the current batch
+    uint64_t generation_ = 0;
+    bool stop_ = false;
+    std::vector<std::thread> threads_;
 };
 
-// TODO : This can be much smarter, using separate locks for separate global data
-static std::mutex global_lock;
+// Call func(i) for every i in [0, count), spreading the work over the device's validation threads when there are at least
+// min_per_thread items for each of two threads. func must only read shared layer state; callers hold global_lock (at least
+// shared) for the duration. Messages func(i) logs are held back in messages[i] so that the caller can deliver them from its
+// own thread in index order, whichever thread did the work.
+template <typename Func>
+static void RunInParallel(layer_data *dev_data, uint32_t count, uint32_t min_per_thread,
+                          std::vector<debug_report_deferred_messages> &messages, Func func) {
+    messages.assign(count, debug_report_deferred_messages());
+    auto deferred = [&](uint32_t i) {
+        debug_report_set_thread_deferral(&messages[i]);
+        func(i);
+        debug_report_set_thread_deferral(nullptr);
+    };
+    if (count < 2 * min_per_thread) {
+        for (uint32_t i = 0; i < count; ++i) deferred(i);
+        return;
+    }
+    dev_data->validation_threads->run(count, deferred);
+}
 
 // Return IMAGE_VIEW_STATE ptr for specified imageView or else NULL
 IMAGE_VIEW_STATE *GetImageViewState(const layer_data *dev_data, VkImageView image_view) {
@@ -508,7 +808,7 @@ void SetBufferMemoryValid(layer_data *dev_data, BUFFER_STATE *buffer_state, bool
 
 // Create binding link between given sampler and command buffer node
 void AddCommandBufferBindingSampler(GLOBAL_CB_NODE *cb_node, SAMPLER_STATE *sampler_state) {
-    sampler_state->cb_bindings.insert(cb_node);
+    sampler_state->AddBoundCommandBuffer(cb_node);
     cb_node->object_bindings.insert(
         {reinterpret_cast<uint64_t &>(sampler_state->sampler), kVulkanObjectTypeSampler });
 }
@@ -521,21 +821,21 @@ void AddCommandBufferBindingImage(const layer_data *dev_data, GLOBAL_CB_NODE *cb
         for (auto mem_binding : image_state->GetBoundMemory()) {
             DEVICE_MEM_INFO *pMemInfo = GetMemObjInfo(dev_data, mem_binding);
             if (pMemInfo) {
-                pMemInfo->cb_bindings.insert(cb_node);
+                pMemInfo->AddBoundCommandBuffer(cb_node);
                 // Now update CBInfo's Mem reference list
                 cb_node->memObjs.insert(mem_binding);
             }
         }
         // Now update cb binding for image
         cb_node->object_bindings.insert({reinterpret_cast<uint64_t &>(image_state->image), kVulkanObjectTypeImage });
-        image_state->cb_bindings.insert(cb_node);
+        image_state->AddBoundCommandBuffer(cb_node);
     }
 }
 
 // Create binding link between given image view node and its image with command buffer node
 void AddCommandBufferBindingImageView(const layer_data *dev_data, GLOBAL_CB_NODE *cb_node, IMAGE_VIEW_STATE *view_state) {
     // First add bindings for imageView
-    view_state->cb_bindings.insert(cb_node);
+    view_state->AddBoundCommandBuffer(cb_node);
     cb_node->object_bindings.insert(
         {reinterpret_cast<uint64_t &>(view_state->image_view), kVulkanObjectTypeImageView });
     auto image_state = GetImageState(dev_data, view_state->create_info.image);
@@ -551,20 +851,20 @@ void AddCommandBufferBindingBuffer(const layer_data *dev_data, GLOBAL_CB_NODE *c
     for (auto mem_binding : buffer_state->GetBoundMemory()) {
         DEVICE_MEM_INFO *pMemInfo = GetMemObjInfo(dev_data, mem_binding);
         if (pMemInfo) {
-            pMemInfo->cb_bindings.insert(cb_node);
+            pMemInfo->AddBoundCommandBuffer(cb_node);
             // Now update CBInfo's Mem reference list
             cb_node->memObjs.insert(mem_binding);
         }
     }
     // Now update cb binding for buffer
     cb_node->object_bindings.insert({reinterpret_cast<uint64_t &>(buffer_state->buffer), kVulkanObjectTypeBuffer });
-    buffer_state->cb_bindings.insert(cb_node);
+    buffer_state->AddBoundCommandBuffer(cb_node);
 }
 
 // Create binding link between given buffer view node and its buffer with command buffer node
 void AddCommandBufferBindingBufferView(const layer_data *dev_data, GLOBAL_CB_NODE *cb_node, BUFFER_VIEW_STATE *view_state) {
     // First add bindings for bufferView
-    view_state->cb_bindings.insert(cb_node);
+    view_state->AddBoundCommandBuffer(cb_node);
     cb_node->object_bindings.insert(
         {reinterpret_cast<uint64_t &>(view_state->buffer_view), kVulkanObjectTypeBufferView });
     auto buffer_state = GetBufferState(dev_data, view_state->create_info.buffer);
@@ -586,7 +886,12 @@ static void clear_cmd_buf_and_mem_references(layer_data *dev_data, GLOBAL_CB_NOD
             }
             cb_node->memObjs.clear();
         }
-        cb_node->validate_functions.clear();
+        // A primary this command buffer was executed in may still hold its checks, in which case start a new queue
+        if (cb_node->deferred_checks.use_count() == 1) {
+            cb_node->deferred_checks->clear();
+        } else {
+            cb_node->deferred_checks = std::make_shared<DeferredCheckQueue>();
+        }
     }
 }
 
@@ -769,7 +1074,23 @@ static bool SetSparseMemBinding(layer_data *dev_data, MEM_BINDING binding, uint6
 }
 
 // SPIRV utility functions
+
+// Structural checks for SPIR-V that skips spvValidate: the header is present, the id bound is no larger than the module, and
+// every instruction has a nonzero length and ends inside the module
+static bool spirv_is_parseable(uint32_t const *words, size_t word_count) {
+    if (word_count < 5 || words[0] != spv::MagicNumber || words[3] > word_count) return false;
+    for (size_t offset = 5; offset < word_count;) {
+        uint32_t len = words[offset] >> 16;
+        if (len == 0 || len > word_count - offset) return false;
+        offset += len;
+    }
+    return true;
+}
+
 static void build_def_index(shader_module *module) {
+    // Word 3 of the header is the id bound; every id in a valid module is below it. Don't trust it beyond the module size:
+    // set_def() grows the index, up to the bound, for any id past the module size, and ignores ids at or above the bound.
+    if (module->words.size() > 3) module->def_index.resize(std::min<size_t>(module->words[3], module->words.size()));
     for (auto insn : *module) {
         switch (insn.opcode()) {
             // Types
@@ -793,7 +1114,7 @@ static void build_def_index(shader_module *module) {
             case spv::OpTypeReserveId:
             case spv::OpTypeQueue:
             case spv::OpTypePipe:
-                module->def_index[insn.word(1)] = insn.offset();
+                module->set_def(insn.word(1), insn.offset());
                 break;
 
             // Fixed constants
@@ -803,7 +1124,7 @@ static void build_def_index(shader_module *module) {
             case spv::OpConstantComposite:
             case spv::OpConstantSampler:
             case spv::OpConstantNull:
-                module->def_index[insn.word(2)] = insn.offset();
+                module->set_def(insn.word(2), insn.offset());
                 break;
 
             // Specialization constants
@@ -812,17 +1133,17 @@ static void build_def_index(shader_module *module) {
             case spv::OpSpecConstant:
             case spv::OpSpecConstantComposite:
             case spv::OpSpecConstantOp:
-                module->def_index[insn.word(2)] = insn.offset();
+                module->set_def(insn.word(2), insn.offset());
                 break;
 
             // Variables
             case spv::OpVariable:
-                module->def_index[insn.word(2)] = insn.offset();
+                module->set_def(insn.word(2), insn.offset());
                 break;
 
             // Functions
             case spv::OpFunction:
-                module->def_index[insn.word(2)] = insn.offset();
+                module->set_def(insn.word(2), insn.offset());
                 break;
 
             default:
@@ -2289,6 +2610,23 @@ static uint32_t descriptor_type_to_reqs(shader_module const *module, uint32_t ty
     }
 }
 
+// Number of messages deferred so far on this thread, for deferred_error_since()
+static size_t deferred_message_count() {
+    debug_report_deferred_messages *deferred = debug_report_get_thread_deferral();
+    return deferred ? deferred->size() : 0;
+}
+
+// Whether an error has been deferred on this thread since deferred_message_count() returned mark. A deferred log_msg returns
+// false whatever the callbacks will say, so its result can't tell whether validation found a problem.
+static bool deferred_error_since(size_t mark) {
+    debug_report_deferred_messages *deferred = debug_report_get_thread_deferral();
+    if (!deferred) return false;
+    for (size_t i = mark; i < deferred->size(); ++i) {
+        if ((*deferred)[i].msgFlags & VK_DEBUG_REPORT_ERROR_BIT_EXT) return true;
+    }
+    return false;
+}
+
 static bool validate_pipeline_shader_stage(
     layer_data *dev_data, VkPipelineShaderStageCreateInfo const *pStage, PIPELINE_STATE *pipeline,
     shader_module **out_module, spirv_inst_iter *out_entrypoint) {
@@ -2302,11 +2640,12 @@ static bool validate_pipeline_shader_stage(
     // Find the entrypoint
     auto entrypoint = *out_entrypoint = find_entrypoint(module, pStage->pName, pStage->stage);
     if (entrypoint == module->end()) {
-        if (log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
-                    VALIDATION_ERROR_00510, "SC", "No entrypoint found named `%s` for stage %s. %s.", pStage->pName,
-                    string_VkShaderStageFlagBits(pStage->stage), validation_error_map[VALIDATION_ERROR_00510])) {
-            return true;  // no point continuing beyond here, any analysis is just going to be garbage.
-        }
+        // No point continuing beyond here, any analysis is just going to be garbage. This mustn't depend on what the callback
+        // returns: while the stage is validated on a helper thread the message is deferred and log_msg returns false.
+        log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
+                VALIDATION_ERROR_00510, "SC", "No entrypoint found named `%s` for stage %s. %s.", pStage->pName,
+                string_VkShaderStageFlagBits(pStage->stage), validation_error_map[VALIDATION_ERROR_00510]);
+        return true;
     }
 
     // Validate shader capabilities against enabled device features
@@ -2406,14 +2745,19 @@ static bool validate_and_capture_pipeline_shader_state(layer_data *dev_data, PIP
     memset(entrypoints, 0, sizeof(entrypoints));
     bool skip = false;
 
+    // A stage's errors are told apart from the callbacks' verdict on them, which isn't known yet while messages are deferred
+    bool stage_failed = false;
     for (uint32_t i = 0; i < pCreateInfo->stageCount; i++) {
         auto pStage = &pCreateInfo->pStages[i];
         auto stage_id = get_shader_stage_id(pStage->stage);
+        size_t mark = deferred_message_count();
         skip |= validate_pipeline_shader_stage(dev_data, pStage, pPipeline, &shaders[stage_id], &entrypoints[stage_id]);
+        stage_failed |= deferred_error_since(mark);
     }
 
     // if the shader stages are no good individually, cross-stage validation is pointless.
     if (skip) return true;
+    if (stage_failed) return false;
 
     auto vi = pCreateInfo->pVertexInputState;
 
@@ -2623,12 +2967,27 @@ static bool ValidatePipelineDrawtimeState(layer_data const *dev_data, LAST_BOUND
     return skip;
 }
 
+// Return true if nothing that descriptor set validation depends on has changed at this bind point since the snapshot in
+// state.validated was taken: no pipeline or set has been bound and none of the active sets has been updated. Image layout
+// changes only matter to the checks in ValidateDrawState, not to binding the sets in UpdateDrawState.
+static bool MatchesValidatedDrawState(GLOBAL_CB_NODE const *cb_node, LAST_BOUND_STATE const &state, bool check_image_layouts) {
+    auto const &validated = state.validated;
+    // Destroying or updating anything the sets refer to invalidates the command buffer
+    if (cb_node->state != CB_RECORDING || validated.bind_generation != state.bind_generation) return false;
+    if (check_image_layouts && validated.image_layout_generation != cb_node->image_layout_generation) return false;
+    for (const auto &set_binding_pair : state.pipeline_state->active_slots) {
+        const uint32_t set_index = set_binding_pair.first;
+        if (validated.set_change_counts[set_index] != state.boundDescriptorSets[set_index]->GetChangeCount()) return false;
+    }
+    return true;
+}
+
 // Validate overall state at the time of a draw call
 static bool ValidateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_node, const bool indexed,
                               const VkPipelineBindPoint bind_point, const char *function,
                               UNIQUE_VALIDATION_ERROR_CODE const msg_code) {
     bool result = false;
-    auto const &state = cb_node->lastBound[bind_point];
+    auto &state = cb_node->lastBound[bind_point];
     PIPELINE_STATE *pPipe = state.pipeline_state;
     if (nullptr == pPipe) {
         result |= log_msg(
@@ -2642,15 +3001,17 @@ static bool ValidateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_node, con
     if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point)
         result = validate_draw_state_flags(dev_data, cb_node, pPipe, indexed, msg_code);
 
-    // Now complete other state checks
-    if (VK_NULL_HANDLE != state.pipeline_layout.layout) {
+    // Now complete other state checks, skipping the descriptor sets if they are unchanged since they last passed
+    if (VK_NULL_HANDLE != state.pipeline_layout.layout && !MatchesValidatedDrawState(cb_node, state, true)) {
         string errorString;
         auto pipeline_layout = pPipe->pipeline_layout;
+        bool sets_valid = true;
 
         for (const auto &set_binding_pair : pPipe->active_slots) {
             uint32_t setIndex = set_binding_pair.first;
             // If valid set is not bound throw an error
             if ((state.boundDescriptorSets.size() <= setIndex) || (!state.boundDescriptorSets[setIndex])) {
+                sets_valid = false;
                 result |= log_msg(
                     dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                     reinterpret_cast<uint64_t>(cb_node->commandBuffer), __LINE__, DRAWSTATE_DESCRIPTOR_SET_NOT_BOUND, "DS",
@@ -2658,6 +3019,7 @@ static bool ValidateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_node, con
             } else if (!verify_set_layout_compatibility(state.boundDescriptorSets[setIndex], &pipeline_layout, setIndex,
                                                         errorString)) {
                 // Set is bound but not compatible w/ overlapping pipeline_layout from PSO
+                sets_valid = false;
                 VkDescriptorSet setHandle = state.boundDescriptorSets[setIndex]->GetSet();
                 result |=
                     log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
@@ -2673,6 +3035,7 @@ static bool ValidateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_node, con
                 std::string err_str;
                 if (!descriptor_set->ValidateDrawState(set_binding_pair.second, state.dynamicOffsets[setIndex], cb_node, function,
                                                        &err_str)) {
+                    sets_valid = false;
                     auto set = descriptor_set->GetSet();
                     result |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
                                       VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT, reinterpret_cast<const uint64_t &>(set),
@@ -2682,6 +3045,18 @@ static bool ValidateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_node, con
                 }
             }
         }
+
+        if (sets_valid) {
+            // Only an image layout change can leave the sets bound to the command buffer by UpdateDrawState still current
+            state.validated.sets_bound = state.validated.sets_bound && MatchesValidatedDrawState(cb_node, state, false);
+            state.validated.bind_generation = state.bind_generation;
+            state.validated.image_layout_generation = cb_node->image_layout_generation;
+            state.validated.set_change_counts.resize(state.boundDescriptorSets.size());
+            for (const auto &set_binding_pair : pPipe->active_slots) {
+                state.validated.set_change_counts[set_binding_pair.first] =
+                    state.boundDescriptorSets[set_binding_pair.first]->GetChangeCount();
+            }
+        }
     }
 
     // Check general pipeline state that needs to be validated at drawtime
@@ -2691,9 +3066,10 @@ static bool ValidateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_node, con
 }
 
 static void UpdateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_state, const VkPipelineBindPoint bind_point) {
-    auto const &state = cb_state->lastBound[bind_point];
+    auto &state = cb_state->lastBound[bind_point];
     PIPELINE_STATE *pPipe = state.pipeline_state;
-    if (VK_NULL_HANDLE != state.pipeline_layout.layout) {
+    // Sets that passed validation only need binding once until something is rebound or updated
+    if (VK_NULL_HANDLE != state.pipeline_layout.layout && !state.validated.sets_bound) {
         for (const auto &set_binding_pair : pPipe->active_slots) {
             uint32_t setIndex = set_binding_pair.first;
             // Pull the set node
@@ -2703,6 +3079,7 @@ static void UpdateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_state, cons
             // For given active slots record updated images & buffers
             descriptor_set->GetStorageUpdates(set_binding_pair.second, &cb_state->updateBuffers, &cb_state->updateImages);
         }
+        state.validated.sets_bound = MatchesValidatedDrawState(cb_state, state, false);
     }
     if (pPipe->vertexBindingDescriptions.size() > 0) {
         cb_state->vertex_buffer_used = true;
@@ -2738,7 +3115,7 @@ static bool verifyLineWidth(layer_data *dev_data, DRAW_STATE_ERROR dsError, Vulk
 }
 
 // Verify that create state for a pipeline is valid
-static bool verifyPipelineCreateState(layer_data *dev_data, std::vector<PIPELINE_STATE *> pPipelines, int pipelineIndex) {
+static bool verifyPipelineCreateState(layer_data *dev_data, std::vector<PIPELINE_STATE *> const &pPipelines, int pipelineIndex) {
     bool skip = false;
 
     PIPELINE_STATE *pPipeline = pPipelines[pipelineIndex];
@@ -3219,8 +3596,8 @@ BASE_NODE *GetStateStructPtrFromObject(layer_data *dev_data, VK_OBJECT object_st
 // Tie the VK_OBJECT to the cmd buffer which includes:
 //  Add object_binding to cmd buffer
 //  Add cb_binding to object
-static void addCommandBufferBinding(std::unordered_set<GLOBAL_CB_NODE *> *cb_bindings, VK_OBJECT obj, GLOBAL_CB_NODE *cb_node) {
-    cb_bindings->insert(cb_node);
+static void addCommandBufferBinding(BASE_NODE *base_obj, VK_OBJECT obj, GLOBAL_CB_NODE *cb_node) {
+    base_obj->AddBoundCommandBuffer(cb_node);
     cb_node->object_bindings.insert(obj);
 }
 // For a given object, if cb_node is in that objects cb_bindings, remove cb_node
@@ -3263,6 +3640,7 @@ static void resetCB(layer_data *dev_data, const VkCommandBuffer cb) {
         pCB->activeQueries.clear();
         pCB->startedQueries.clear();
         pCB->imageLayoutMap.clear();
+        pCB->image_layout_generation = 0;
         pCB->eventToStageMap.clear();
         pCB->drawData.clear();
         pCB->currentDrawData.buffers.clear();
@@ -3276,8 +3654,6 @@ static void resetCB(layer_data *dev_data, const VkCommandBuffer cb) {
         pCB->updateImages.clear();
         pCB->updateBuffers.clear();
         clear_cmd_buf_and_mem_references(dev_data, pCB);
-        pCB->eventUpdates.clear();
-        pCB->queryUpdates.clear();
 
         // Remove object bindings
         for (auto obj : pCB->object_bindings) {
@@ -3430,7 +3806,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     instance_layer_data *instance_data = GetLayerDataPtr(key, instance_layer_data_map);
     instance_data->dispatch_table.DestroyInstance(instance, pAllocator);
 
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(global_lock);
     // Clean up logging callback, if any
     while (instance_data->logging_callback.size() > 0) {
         VkDebugReportCallbackEXT callback = instance_data->logging_callback.back();
@@ -3550,7 +3926,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     bool skip = false;
     instance_layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(gpu), instance_layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto pd_state = GetPhysicalDeviceState(instance_data, gpu);
 
     // TODO: object_tracker should perhaps do this instead
@@ -3618,6 +3994,15 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     // Store physical device properties and physical device mem limits into device layer_data structs
     instance_data->dispatch_table.GetPhysicalDeviceMemoryProperties(gpu, &device_data->phys_dev_mem_props);
     instance_data->dispatch_table.GetPhysicalDeviceProperties(gpu, &device_data->phys_dev_props);
+
+    device_data->spirv_context = spvContextCreate(SPV_ENV_VULKAN_1_0);
+    device_data->shader_cache.reset(new shader_validation_cache());
+    device_data->validation_threads.reset(new validation_thread_pool());
+    const char *shader_cache_filename = getLayerOption("lunarg_core_validation.shader_validation_cache");
+    if (shader_cache_filename && *shader_cache_filename) {
+        device_data->shader_cache_filename = shader_cache_filename;
+        device_data->shader_cache->load(shader_cache_filename);
+    }
     lock.unlock();
 
     ValidateLayerOrdering(*pCreateInfo);
@@ -3632,13 +4017,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     dispatch_key key = get_dispatch_key(device);
     layer_data *dev_data = GetLayerDataPtr(key, layer_data_map);
     // Free all the memory
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     deletePipelines(dev_data);
     dev_data->renderPassMap.clear();
     for (auto ii = dev_data->commandBufferMap.begin(); ii != dev_data->commandBufferMap.end(); ++ii) {
         delete (*ii).second;
     }
     dev_data->commandBufferMap.clear();
+    for (auto cb_node : dev_data->free_cb_nodes) {
+        delete cb_node;
+    }
+    dev_data->free_cb_nodes.clear();
     // This will also delete all sets in the pool & remove them from setMap
     deletePools(dev_data);
     // All sets should be removed
@@ -3649,12 +4038,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     dev_data->descriptorSetLayoutMap.clear();
     dev_data->imageViewMap.clear();
     dev_data->imageMap.clear();
-    dev_data->imageSubresourceMap.clear();
     dev_data->imageLayoutMap.clear();
     dev_data->bufferViewMap.clear();
     dev_data->bufferMap.clear();
     // Queues persist until device is destroyed
     dev_data->queueMap.clear();
+    dev_data->shaderModuleMap.clear();
+    if (!dev_data->shader_cache_filename.empty()) {
+        dev_data->shader_cache->save(dev_data->shader_cache_filename.c_str());
+    }
+    dev_data->shader_cache.reset();
+    dev_data->validation_threads.reset();
+    spvContextDestroy(dev_data->spirv_context);
+    dev_data->spirv_context = nullptr;
     // Report any memory leaks
     layer_debug_report_destroy_device(device);
     lock.unlock();
@@ -3694,23 +4090,25 @@ static bool ValidateStageMaskGsTsEnables(layer_data *dev_data, VkPipelineStageFl
     return skip;
 }
 
-// Loop through bound objects and increment their in_use counts.
-static void IncrementBoundObjects(layer_data *dev_data, GLOBAL_CB_NODE const *cb_node) {
+// Loop through bound objects and increment their in_use counts, noting each one incremented in retire_objects.
+static void IncrementBoundObjects(layer_data *dev_data, GLOBAL_CB_NODE const *cb_node, std::vector<VK_OBJECT> *retire_objects) {
     for (auto obj : cb_node->object_bindings) {
         auto base_obj = GetStateStructPtrFromObject(dev_data, obj);
         if (base_obj) {
             base_obj->in_use.fetch_add(1);
+            retire_objects->push_back(obj);
         }
     }
 }
-// Track which resources are in-flight by atomically incrementing their "in_use" count
-static void incrementResources(layer_data *dev_data, GLOBAL_CB_NODE *cb_node) {
+// Track which resources are in-flight by atomically incrementing their "in_use" count. Everything incremented is appended
+// to retire_objects so that retiring the submission doesn't have to walk the command buffer again.
+static void incrementResources(layer_data *dev_data, GLOBAL_CB_NODE *cb_node, std::vector<VK_OBJECT> *retire_objects) {
     cb_node->submitCount++;
     cb_node->in_use.fetch_add(1);
     dev_data->globalInFlightCmdBuffers.insert(cb_node->commandBuffer);
 
     // First Increment for all "generic" objects bound to cmd buffer, followed by special-case objects below
-    IncrementBoundObjects(dev_data, cb_node);
+    IncrementBoundObjects(dev_data, cb_node, retire_objects);
     // TODO : We should be able to remove the NULL look-up checks from the code below as long as
     //  all the corresponding cases are verified to cause CB_INVALID state and the CB_INVALID state
     //  should then be flagged prior to calling this function
@@ -3719,6 +4117,7 @@ static void incrementResources(layer_data *dev_data, GLOBAL_CB_NODE *cb_node) {
             auto buffer_state = GetBufferState(dev_data, buffer);
             if (buffer_state) {
                 buffer_state->in_use.fetch_add(1);
+                retire_objects->push_back({reinterpret_cast<uint64_t &>(buffer), kVulkanObjectTypeBuffer});
             }
         }
     }
@@ -3735,40 +4134,59 @@ static void incrementResources(layer_data *dev_data, GLOBAL_CB_NODE *cb_node) {
 static bool VerifyQueueStateToSeq(layer_data *dev_data, QUEUE_STATE *initial_queue, uint64_t initial_seq) {
     bool skip = false;
 
-    // sequence number we want to validate up to, per queue
-    std::unordered_map<QUEUE_STATE *, uint64_t> target_seqs { { initial_queue, initial_seq } };
-    // sequence number we've completed validation for, per queue
-    std::unordered_map<QUEUE_STATE *, uint64_t> done_seqs;
-    std::vector<QUEUE_STATE *> worklist { initial_queue };
+    // Per queue, the sequence number we want to validate up to and the one we've completed validation for. There are only
+    // ever a few queues involved, so these live in a flat list.
+    struct QueueProgress {
+        QUEUE_STATE *queue;
+        uint64_t target_seq;
+        uint64_t done_seq;
+    };
+    std::vector<QueueProgress> progress{{initial_queue, initial_seq, 0}};
+    std::vector<size_t> worklist{0};
+
+    auto progress_index = [&progress](QUEUE_STATE *queue) {
+        for (size_t i = 0; i < progress.size(); ++i) {
+            if (progress[i].queue == queue) return i;
+        }
+        progress.push_back({queue, 0, 0});
+        return progress.size() - 1;
+    };
 
     while (worklist.size()) {
-        auto queue = worklist.back();
+        auto index = worklist.back();
         worklist.pop_back();
 
-        auto target_seq = target_seqs[queue];
-        auto seq = std::max(done_seqs[queue], queue->seq);
-        auto sub_it = queue->submissions.begin() + int(seq - queue->seq);  // seq >= queue->seq
+        auto queue = progress[index].queue;
+        auto target_seq = progress[index].target_seq;
+        auto seq = std::max(progress[index].done_seq, queue->seq);
+
+        // Submissions that neither wait on another queue nor reset guarded queries have nothing to verify, so only the
+        // ones indexed in verify_seqs are visited.
+        auto seq_it = std::lower_bound(queue->verify_seqs.begin(), queue->verify_seqs.end(), seq);
+        for (; seq_it != queue->verify_seqs.end() && *seq_it < target_seq; ++seq_it) {
+            auto &submission = queue->submissions[static_cast<size_t>(*seq_it - queue->seq)];  // *seq_it >= queue->seq
 
-        for (; seq < target_seq; ++sub_it, ++seq) {
-            for (auto &wait : sub_it->waitSemaphores) {
+            for (auto &wait : submission.waitSemaphores) {
                 auto other_queue = GetQueueState(dev_data, wait.queue);
 
                 if (other_queue == queue)
                     continue;   // semaphores /always/ point backwards, so no point here.
 
-                auto other_target_seq = std::max(target_seqs[other_queue], wait.seq);
-                auto other_done_seq = std::max(done_seqs[other_queue], other_queue->seq);
+                auto other_index = progress_index(other_queue);
+                auto other_target_seq = std::max(progress[other_index].target_seq, wait.seq);
+                auto other_done_seq = std::max(progress[other_index].done_seq, other_queue->seq);
 
                 // if this wait is for another queue, and covers new sequence
                 // numbers beyond what we've already validated, mark the new
                 // target seq and (possibly-re)add the queue to the worklist.
                 if (other_done_seq < other_target_seq) {
-                    target_seqs[other_queue] = other_target_seq;
-                    worklist.push_back(other_queue);
+                    progress[other_index].target_seq = other_target_seq;
+                    worklist.push_back(other_index);
                 }
             }
 
-            for (auto cb : sub_it->cbs) {
+            if (!submission.has_guarded_query_resets) continue;
+            for (auto cb : submission.cbs) {
                 auto cb_node = GetCBNode(dev_data, cb);
                 if (cb_node) {
                     for (auto queryEventsPair : cb_node->waitedEventsBeforeQueryReset) {
@@ -3787,7 +4205,7 @@ static bool VerifyQueueStateToSeq(layer_data *dev_data, QUEUE_STATE *initial_que
         }
 
         // finally mark the point we've now validated this queue to.
-        done_seqs[queue] = seq;
+        progress[index].done_seq = std::max(seq, target_seq);
     }
 
     return skip;
@@ -3813,11 +4231,10 @@ static inline void removeInFlightCmdBuffer(layer_data *dev_data, VkCommandBuffer
     }
 }
 
-// Decrement in-use count for objects bound to command buffer
-static void DecrementBoundResources(layer_data *dev_data, GLOBAL_CB_NODE const *cb_node) {
-    BASE_NODE *base_obj = nullptr;
-    for (auto obj : cb_node->object_bindings) {
-        base_obj = GetStateStructPtrFromObject(dev_data, obj);
+// Decrement in-use count for the objects a submission incremented
+static void DecrementBoundResources(layer_data *dev_data, CB_SUBMISSION const &submission) {
+    for (auto obj : submission.retire_objects) {
+        auto base_obj = GetStateStructPtrFromObject(dev_data, obj);
         if (base_obj) {
             base_obj->in_use.fetch_sub(1);
         }
@@ -3825,7 +4242,8 @@ static void DecrementBoundResources(layer_data *dev_data, GLOBAL_CB_NODE const *
 }
 
 static void RetireWorkOnQueue(layer_data *dev_data, QUEUE_STATE *pQueue, uint64_t seq) {
-    std::unordered_map<VkQueue, uint64_t> otherQueueSeqs;
+    // Highest seq waited on per other queue; there are only a few queues, so a flat list does.
+    std::vector<std::pair<VkQueue, uint64_t>> otherQueueSeqs;
 
     // Roll this queue forward, one submission at a time.
     while (pQueue->seq < seq) {
@@ -3836,8 +4254,14 @@ static void RetireWorkOnQueue(layer_data *dev_data, QUEUE_STATE *pQueue, uint64_
             if (pSemaphore) {
                 pSemaphore->in_use.fetch_sub(1);
             }
-            auto &lastSeq = otherQueueSeqs[wait.queue];
-            lastSeq = std::max(lastSeq, wait.seq);
+            if (wait.queue == pQueue->queue) continue;
+            auto other = std::find_if(otherQueueSeqs.begin(), otherQueueSeqs.end(),
+                                      [&wait](const std::pair<VkQueue, uint64_t> &qs) { return qs.first == wait.queue; });
+            if (other == otherQueueSeqs.end()) {
+                otherQueueSeqs.emplace_back(wait.queue, wait.seq);
+            } else {
+                other->second = std::max(other->second, wait.seq);
+            }
         }
 
         for (auto &semaphore : submission.signalSemaphores) {
@@ -3847,21 +4271,13 @@ static void RetireWorkOnQueue(layer_data *dev_data, QUEUE_STATE *pQueue, uint64_
             }
         }
 
+        DecrementBoundResources(dev_data, submission);
+
         for (auto cb : submission.cbs) {
             auto cb_node = GetCBNode(dev_data, cb);
             if (!cb_node) {
                 continue;
             }
-            // First perform decrement on general case bound objects
-            DecrementBoundResources(dev_data, cb_node);
-            for (auto drawDataElement : cb_node->drawData) {
-                for (auto buffer : drawDataElement.buffers) {
-                    auto buffer_state = GetBufferState(dev_data, buffer);
-                    if (buffer_state) {
-                        buffer_state->in_use.fetch_sub(1);
-                    }
-                }
-            }
             for (auto event : cb_node->writeEventsBeforeWait) {
                 auto eventNode = dev_data->eventMap.find(event);
                 if (eventNode != dev_data->eventMap.end()) {
@@ -3883,6 +4299,9 @@ static void RetireWorkOnQueue(layer_data *dev_data, QUEUE_STATE *pQueue, uint64_
             pFence->state = FENCE_RETIRED;
         }
 
+        if (!pQueue->verify_seqs.empty() && pQueue->verify_seqs.front() == pQueue->seq) {
+            pQueue->verify_seqs.pop_front();
+        }
         pQueue->submissions.pop_front();
         pQueue->seq++;
     }
@@ -3893,6 +4312,18 @@ static void RetireWorkOnQueue(layer_data *dev_data, QUEUE_STATE *pQueue, uint64_
     }
 }
 
+// Index the submission just appended to the queue in verify_seqs if fence waits will have to visit it
+static void IndexSubmissionForVerify(QUEUE_STATE *pQueue) {
+    auto &submission = pQueue->submissions.back();
+    bool verify = submission.has_guarded_query_resets;
+    for (auto &wait : submission.waitSemaphores) {
+        verify |= (wait.queue != pQueue->queue);
+    }
+    if (verify) {
+        pQueue->verify_seqs.push_back(pQueue->seq + pQueue->submissions.size() - 1);
+    }
+}
+
 // Submit a fence to a queue, delimiting previous fences and previous untracked
 // work by it.
 static void SubmitFence(QUEUE_STATE *pQueue, FENCE_NODE *pFence, uint64_t submitCount) {
@@ -4091,6 +4522,8 @@ static void PostCallRecordQueueSubmit(layer_data *dev_data, VkQueue queue, uint3
     // Now process each individual submit
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         std::vector<VkCommandBuffer> cbs;
+        std::vector<VK_OBJECT> retire_objects;
+        bool has_guarded_query_resets = false;
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
         vector<SEMAPHORE_WAIT> semaphore_waits;
         vector<VkSemaphore> semaphore_signals;
@@ -4125,17 +4558,22 @@ static void PostCallRecordQueueSubmit(layer_data *dev_data, VkQueue queue, uint3
                     cbs.push_back(secondaryCmdBuffer);
                 }
                 UpdateCmdBufImageLayouts(dev_data, cb_node);
-                incrementResources(dev_data, cb_node);
+                incrementResources(dev_data, cb_node, &retire_objects);
+                has_guarded_query_resets |= !cb_node->waitedEventsBeforeQueryReset.empty();
                 if (!cb_node->secondaryCommandBuffers.empty()) {
                     for (auto secondaryCmdBuffer : cb_node->secondaryCommandBuffers) {
                         GLOBAL_CB_NODE *pSubCB = GetCBNode(dev_data, secondaryCmdBuffer);
-                        incrementResources(dev_data, pSubCB);
+                        incrementResources(dev_data, pSubCB, &retire_objects);
+                        has_guarded_query_resets |= !pSubCB->waitedEventsBeforeQueryReset.empty();
                     }
                 }
             }
         }
         pQueue->submissions.emplace_back(cbs, semaphore_waits, semaphore_signals,
                                          submit_idx == submitCount - 1 ? fence : VK_NULL_HANDLE);
+        pQueue->submissions.back().retire_objects.swap(retire_objects);
+        pQueue->submissions.back().has_guarded_query_resets = has_guarded_query_resets;
+        IndexSubmissionForVerify(pQueue);
     }
 
     if (pFence && !submitCount) {
@@ -4147,6 +4585,68 @@ static void PostCallRecordQueueSubmit(layer_data *dev_data, VkQueue queue, uint3
     }
 }
 
+bool setEventStageMask(VkQueue queue, VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask);
+bool validateEventStageMask(VkQueue queue, GLOBAL_CB_NODE *pCB, uint32_t eventCount, size_t firstEventIndex,
+                            VkPipelineStageFlags sourceStageMask);
+bool setQueryState(VkQueue queue, VkCommandBuffer commandBuffer, QueryObject object, bool value);
+bool validateQuery(VkQueue queue, GLOBAL_CB_NODE *pCB, VkQueryPool queryPool, uint32_t queryCount, uint32_t firstQuery);
+
+// Perform the checks and state updates recorded into cb_node for its submission to queue. Secondary command buffers
+// executed by cb_node contribute only their query updates, which are replayed at the point they were executed.
+static bool ReplayDeferredChecks(layer_data *dev_data, VkQueue queue, GLOBAL_CB_NODE *cb_node, const DeferredCheckQueue &checks,
+                                 bool query_updates_only) {
+    bool skip = false;
+    for (const auto &check : checks.checks()) {
+        if (query_updates_only && check.type != DEFERRED_SET_QUERY_STATE && check.type != DEFERRED_VALIDATE_QUERY &&
+            check.type != DEFERRED_EXECUTE_COMMANDS) {
+            continue;
+        }
+        switch (check.type) {
+            case DEFERRED_VALIDATE_IMAGE_MEMORY:
+                skip |= ValidateImageMemoryIsValid(dev_data, check.image_state, check.function);
+                break;
+            case DEFERRED_VALIDATE_BUFFER_MEMORY:
+                skip |= ValidateBufferMemoryIsValid(dev_data, check.buffer_state, check.function);
+                break;
+            case DEFERRED_SET_IMAGE_MEMORY_VALID:
+                SetImageMemoryValid(dev_data, check.image_state, check.valid);
+                break;
+            case DEFERRED_SET_BUFFER_MEMORY_VALID:
+                SetBufferMemoryValid(dev_data, check.buffer_state, check.valid);
+                break;
+            case DEFERRED_VALIDATE_ATTACHMENT_MEMORY: {
+                auto image_state = GetImageState(dev_data, check.image);
+                if (image_state) skip |= ValidateImageMemoryIsValid(dev_data, image_state, check.function);
+                break;
+            }
+            case DEFERRED_SET_ATTACHMENT_MEMORY_VALID: {
+                auto image_state = GetImageState(dev_data, check.image);
+                if (image_state) SetImageMemoryValid(dev_data, image_state, check.valid);
+                break;
+            }
+            case DEFERRED_SET_EVENT_STAGE_MASK:
+                skip |= setEventStageMask(queue, cb_node->commandBuffer, check.event, check.stage_mask);
+                break;
+            case DEFERRED_VALIDATE_EVENT_STAGE_MASK:
+                skip |= validateEventStageMask(queue, cb_node, check.count, check.first, check.stage_mask);
+                break;
+            case DEFERRED_SET_QUERY_STATE:
+                skip |= setQueryState(queue, cb_node->commandBuffer, {check.query_pool, check.first}, check.valid);
+                break;
+            case DEFERRED_VALIDATE_QUERY:
+                skip |= validateQuery(queue, cb_node, check.query_pool, check.count, check.first);
+                break;
+            case DEFERRED_EXECUTE_COMMANDS: {
+                auto const &secondary = checks.secondary(check.first);
+                auto sub_cb_node = GetCBNode(dev_data, secondary.first);
+                if (sub_cb_node) skip |= ReplayDeferredChecks(dev_data, queue, sub_cb_node, *secondary.second, true);
+                break;
+            }
+        }
+    }
+    return skip;
+}
+
 static bool PreCallValidateQueueSubmit(layer_data *dev_data, VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
                                        VkFence fence) {
     auto pFence = GetFenceNode(dev_data, fence);
@@ -4158,7 +4658,8 @@ static bool PreCallValidateQueueSubmit(layer_data *dev_data, VkQueue queue, uint
     unordered_set<VkSemaphore> signaled_semaphores;
     unordered_set<VkSemaphore> unsignaled_semaphores;
     vector<VkCommandBuffer> current_cmds;
-    unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> localImageLayoutMap = dev_data->imageLayoutMap;
+    // Layouts changed by the command buffers validated so far in this submission, on top of dev_data->imageLayoutMap
+    GlobalImageLayoutMap localImageLayoutMap;
     // Now verify each individual submit
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
@@ -4211,16 +4712,8 @@ static bool PreCallValidateQueueSubmit(layer_data *dev_data, VkQueue queue, uint
                     return true;
                 }
 
-                // Call submit-time functions to validate/update state
-                for (auto &function : cb_node->validate_functions) {
-                    skip |= function();
-                }
-                for (auto &function : cb_node->eventUpdates) {
-                    skip |= function(queue);
-                }
-                for (auto &function : cb_node->queryUpdates) {
-                    skip |= function(queue);
-                }
+                // Perform submit-time checks and state updates
+                skip |= ReplayDeferredChecks(dev_data, queue, cb_node, *cb_node->deferred_checks, false);
             }
         }
     }
@@ -4229,7 +4722,7 @@ static bool PreCallValidateQueueSubmit(layer_data *dev_data, VkQueue queue, uint
 
 VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 
     bool skip = PreCallValidateQueueSubmit(dev_data, queue, submitCount, pSubmits, fence);
     lock.unlock();
@@ -4265,7 +4758,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice device, const VkMemoryAll
                                               const VkAllocationCallbacks *pAllocator, VkDeviceMemory *pMemory) {
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateAllocateMemory(dev_data);
     if (!skip) {
         lock.unlock();
@@ -4336,7 +4829,7 @@ VKAPI_ATTR void VKAPI_CALL FreeMemory(VkDevice device, VkDeviceMemory mem, const
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     DEVICE_MEM_INFO *mem_info = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateFreeMemory(dev_data, mem, &mem_info, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -4445,9 +4938,10 @@ static void initializeAndTrackMemory(layer_data *dev_data, VkDeviceMemory mem, V
 
             // From spec: (ppData - offset) must be aligned to at least limits::minMemoryMapAlignment.
             uint64_t start_offset = offset % map_alignment;
-            // Data passed to driver will be wrapped by a guardband of data to detect over- or under-writes.
+            // Data passed to driver will be wrapped by a guardband of data to detect over- or under-writes. Only the guard bands
+            // are filled here; calloc lets large mappings get zeroed pages lazily instead of touching the whole range up front.
             mem_info->shadow_copy_base =
-                malloc(static_cast<size_t>(2 * mem_info->shadow_pad_size + size + map_alignment + start_offset));
+                calloc(1, static_cast<size_t>(2 * mem_info->shadow_pad_size + size + map_alignment + start_offset));
 
             mem_info->shadow_copy =
                 reinterpret_cast<char *>((reinterpret_cast<uintptr_t>(mem_info->shadow_copy_base) + map_alignment) &
@@ -4456,7 +4950,10 @@ static void initializeAndTrackMemory(layer_data *dev_data, VkDeviceMemory mem, V
             assert(SafeModulo(reinterpret_cast<uintptr_t>(mem_info->shadow_copy) + mem_info->shadow_pad_size - start_offset,
                                   map_alignment) == 0);
 
-            memset(mem_info->shadow_copy, NoncoherentMemoryFillValue, static_cast<size_t>(2 * mem_info->shadow_pad_size + size));
+            char *data = static_cast<char *>(mem_info->shadow_copy);
+            memset(data, NoncoherentMemoryFillValue, static_cast<size_t>(mem_info->shadow_pad_size));
+            memset(data + mem_info->shadow_pad_size + size, NoncoherentMemoryFillValue,
+                   static_cast<size_t>(mem_info->shadow_pad_size));
             *ppData = static_cast<char *>(mem_info->shadow_copy) + mem_info->shadow_pad_size;
         }
     }
@@ -4520,7 +5017,7 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(VkDevice device, uint32_t fenceCoun
                                              uint64_t timeout) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     // Verify fence status of submitted fences
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateWaitForFences(dev_data, fenceCount, pFences);
     lock.unlock();
     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -4544,7 +5041,7 @@ static void PostCallRecordGetFenceStatus(layer_data *dev_data, VkFence fence) {
 
 VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(VkDevice device, VkFence fence) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateGetFenceStatus(dev_data, fence);
     lock.unlock();
     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -4572,7 +5069,7 @@ static void PostCallRecordGetDeviceQueue(layer_data *dev_data, uint32_t q_family
 VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue *pQueue) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     dev_data->dispatch_table.GetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(global_lock);
 
     PostCallRecordGetDeviceQueue(dev_data, queueFamilyIndex, *pQueue);
 }
@@ -4590,7 +5087,7 @@ static void PostCallRecordQueueWaitIdle(layer_data *dev_data, QUEUE_STATE *queue
 VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(VkQueue queue) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     QUEUE_STATE *queue_state = nullptr;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateQueueWaitIdle(dev_data, queue, &queue_state);
     lock.unlock();
     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -4620,7 +5117,7 @@ static void PostCallRecordDeviceWaitIdle(layer_data *dev_data) {
 
 VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(VkDevice device) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateDeviceWaitIdle(dev_data);
     lock.unlock();
     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -4655,7 +5152,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyFence(VkDevice device, VkFence fence, const Vk
     // Common data objects used pre & post call
     FENCE_NODE *fence_node = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateDestroyFence(dev_data, fence, &fence_node, &obj_struct);
 
     if (!skip) {
@@ -4684,7 +5181,7 @@ VKAPI_ATTR void VKAPI_CALL DestroySemaphore(VkDevice device, VkSemaphore semapho
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     SEMAPHORE_NODE *sema_node;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateDestroySemaphore(dev_data, semaphore, &sema_node, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -4714,7 +5211,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyEvent(VkDevice device, VkEvent event, const Vk
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     EVENT_STATE *event_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateDestroyEvent(dev_data, event, &event_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -4748,7 +5245,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(VkDevice device, VkQueryPool queryPo
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     QUERY_POOL_NODE *qp_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateDestroyQueryPool(dev_data, queryPool, &qp_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -4851,7 +5348,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(VkDevice device, VkQueryPool
                                                    size_t dataSize, void *pData, VkDeviceSize stride, VkQueryResultFlags flags) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     unordered_map<QueryObject, vector<VkCommandBuffer>> queries_in_flight;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateGetQueryPoolResults(dev_data, queryPool, firstQuery, queryCount, flags, &queries_in_flight);
     lock.unlock();
     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -4913,6 +5410,15 @@ bool rangesIntersect(layer_data const *dev_data, MEMORY_RANGE const *range1, VkD
     bool tmp_bool;
     return rangesIntersect(dev_data, range1, &range_wrap, &tmp_bool, true);
 }
+// Call func(range) for each range bound to mem_info that rangesIntersect() may find intersecting [start, end]. The span is
+//  widened to bufferImageGranularity so that ranges only reached through linear/non-linear padding are included.
+template <typename Func>
+static void ForEachCandidateRange(layer_data const *dev_data, DEVICE_MEM_INFO *mem_info, VkDeviceSize start, VkDeviceSize end,
+                                  Func func) {
+    VkDeviceSize granularity = dev_data->phys_dev_properties.properties.limits.bufferImageGranularity;
+    if (granularity == 0) granularity = 1;
+    mem_info->bound_range_index.ForEachOverlapping(start & ~(granularity - 1), end | (granularity - 1), func);
+}
 // For given mem_info, set all ranges valid that intersect [offset-end] range
 // TODO : For ranges where there is no alias, we may want to create new buffer ranges that are valid
 static void SetMemRangesValid(layer_data const *dev_data, DEVICE_MEM_INFO *mem_info, VkDeviceSize offset, VkDeviceSize end) {
@@ -4921,12 +5427,12 @@ static void SetMemRangesValid(layer_data const *dev_data, DEVICE_MEM_INFO *mem_i
     map_range.linear = true;
     map_range.start = offset;
     map_range.end = end;
-    for (auto &handle_range_pair : mem_info->bound_ranges) {
-        if (rangesIntersect(dev_data, &handle_range_pair.second, &map_range, &tmp_bool, false)) {
+    ForEachCandidateRange(dev_data, mem_info, offset, end, [&](MEMORY_RANGE *check_range) {
+        if (rangesIntersect(dev_data, check_range, &map_range, &tmp_bool, false)) {
             // TODO : WARN here if tmp_bool true?
-            handle_range_pair.second.valid = true;
+            check_range->valid = true;
         }
-    }
+    });
 }
 
 static bool ValidateInsertMemoryRange(layer_data const *dev_data, uint64_t handle, DEVICE_MEM_INFO *mem_info,
@@ -4946,14 +5452,13 @@ static bool ValidateInsertMemoryRange(layer_data const *dev_data, uint64_t handl
     range.aliases.clear();
 
     // Check for aliasing problems.
-    for (auto &obj_range_pair : mem_info->bound_ranges) {
-        auto check_range = &obj_range_pair.second;
+    ForEachCandidateRange(dev_data, mem_info, range.start, range.end, [&](MEMORY_RANGE *check_range) {
         bool intersection_error = false;
         if (rangesIntersect(dev_data, &range, check_range, &intersection_error, false)) {
             skip |= intersection_error;
             range.aliases.insert(check_range);
         }
-    }
+    });
 
     if (memoryOffset >= mem_info->alloc_info.allocationSize) {
         UNIQUE_VALIDATION_ERROR_CODE error_code = is_image ? VALIDATION_ERROR_00805 : VALIDATION_ERROR_00793;
@@ -4992,17 +5497,20 @@ static void InsertMemoryRange(layer_data const *dev_data, uint64_t handle, DEVIC
     // Save aliased ranges so we can copy into final map entry below. Can't do it in loop b/c we don't yet have final ptr. If we
     // inserted into map before loop to get the final ptr, then we may enter loop when not needed & we check range against itself
     std::unordered_set<MEMORY_RANGE *> tmp_alias_ranges;
-    for (auto &obj_range_pair : mem_info->bound_ranges) {
-        auto check_range = &obj_range_pair.second;
+    ForEachCandidateRange(dev_data, mem_info, range.start, range.end, [&](MEMORY_RANGE *check_range) {
         bool intersection_error = false;
         if (rangesIntersect(dev_data, &range, check_range, &intersection_error, true)) {
             range.aliases.insert(check_range);
             tmp_alias_ranges.insert(check_range);
         }
-    }
-    mem_info->bound_ranges[handle] = std::move(range);
+    });
+    auto existing = mem_info->bound_ranges.find(handle);
+    if (existing != mem_info->bound_ranges.end()) mem_info->bound_range_index.erase(&existing->second);
+    auto &bound_range = mem_info->bound_ranges[handle];
+    bound_range = std::move(range);
+    mem_info->bound_range_index.insert(&bound_range);
     for (auto tmp_range : tmp_alias_ranges) {
-        tmp_range->aliases.insert(&mem_info->bound_ranges[handle]);
+        tmp_range->aliases.insert(&bound_range);
     }
     if (is_image)
         mem_info->bound_images.insert(handle);
@@ -5041,6 +5549,7 @@ static void RemoveMemoryRange(uint64_t handle, DEVICE_MEM_INFO *mem_info, bool i
         alias_range->aliases.erase(erase_range);
     }
     erase_range->aliases.clear();
+    mem_info->bound_range_index.erase(erase_range);
     mem_info->bound_ranges.erase(handle);
     if (is_image) {
         mem_info->bound_images.erase(handle);
@@ -5057,7 +5566,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyBuffer(VkDevice device, VkBuffer buffer, const
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     BUFFER_STATE *buffer_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateDestroyBuffer(dev_data, buffer, &buffer_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5074,7 +5583,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyBufferView(VkDevice device, VkBufferView buffe
     // Common data objects used pre & post call
     BUFFER_VIEW_STATE *buffer_view_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     // Validate state before calling down chain, update common data if we'll be calling down chain
     bool skip = PreCallValidateDestroyBufferView(dev_data, bufferView, &buffer_view_state, &obj_struct);
     if (!skip) {
@@ -5091,7 +5600,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyImage(VkDevice device, VkImage image, const Vk
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     IMAGE_STATE *image_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateDestroyImage(dev_data, image, &image_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5121,7 +5630,7 @@ static bool PreCallValidateBindBufferMemory(layer_data *dev_data, VkBuffer buffe
                                             VkDeviceSize memoryOffset) {
     bool skip = false;
     if (buffer_state) {
-        std::unique_lock<std::mutex> lock(global_lock);
+        std::unique_lock<rw_lock> lock(global_lock);
         // Track objects tied to memory
         uint64_t buffer_handle = reinterpret_cast<uint64_t &>(buffer);
         skip = ValidateSetMemBinding(dev_data, mem, buffer_handle, kVulkanObjectTypeBuffer, "vkBindBufferMemory()");
@@ -5212,7 +5721,7 @@ static bool PreCallValidateBindBufferMemory(layer_data *dev_data, VkBuffer buffe
 static void PostCallRecordBindBufferMemory(layer_data *dev_data, VkBuffer buffer, BUFFER_STATE *buffer_state, VkDeviceMemory mem,
                                            VkDeviceSize memoryOffset) {
     if (buffer_state) {
-        std::unique_lock<std::mutex> lock(global_lock);
+        std::unique_lock<rw_lock> lock(global_lock);
         // Track bound memory range information
         auto mem_info = GetMemObjInfo(dev_data, mem);
         if (mem_info) {
@@ -5269,7 +5778,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyImageView(VkDevice device, VkImageView imageVi
     // Common data objects used pre & post call
     IMAGE_VIEW_STATE *image_view_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateDestroyImageView(dev_data, imageView, &image_view_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5285,7 +5794,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(VkDevice device, VkShaderModule s
                                                const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     dev_data->shaderModuleMap.erase(shaderModule);
     lock.unlock();
 
@@ -5315,7 +5824,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipeline(VkDevice device, VkPipeline pipeline,
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     PIPELINE_STATE *pipeline_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateDestroyPipeline(dev_data, pipeline, &pipeline_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5330,7 +5839,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipeline(VkDevice device, VkPipeline pipeline,
 VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout,
                                                  const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     dev_data->pipelineLayoutMap.erase(pipelineLayout);
     lock.unlock();
 
@@ -5360,7 +5869,7 @@ VKAPI_ATTR void VKAPI_CALL DestroySampler(VkDevice device, VkSampler sampler, co
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     SAMPLER_STATE *sampler_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateDestroySampler(dev_data, sampler, &sampler_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5380,7 +5889,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(VkDevice device, VkDescrip
                                                       const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     dev_data->dispatch_table.DestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     PostCallRecordDestroyDescriptorSetLayout(dev_data, descriptorSetLayout);
 }
 
@@ -5412,7 +5921,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(VkDevice device, VkDescriptorPo
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     DESCRIPTOR_POOL_STATE *desc_pool_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateDestroyDescriptorPool(dev_data, descriptorPool, &desc_pool_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5461,11 +5970,25 @@ static void clearCommandBuffersInFlight(layer_data *dev_data, COMMAND_POOL_NODE
     }
 }
 
+// Most nodes that are freed are soon reallocated, so up to this many are kept for AllocateCommandBuffers to reuse along with
+// the memory their tracking state holds. Beyond that they are deleted, so freeing a burst of command buffers doesn't keep
+// their memory until the device is destroyed.
+static const size_t kMaxFreeCBNodes = 64;
+
+// Take the node of a command buffer that has been reset and removed from commandBufferMap
+static void RecycleCBNode(layer_data *dev_data, GLOBAL_CB_NODE *cb_node) {
+    if (dev_data->free_cb_nodes.size() < kMaxFreeCBNodes) {
+        dev_data->free_cb_nodes.push_back(cb_node);
+    } else {
+        delete cb_node;
+    }
+}
+
 VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
                                               const VkCommandBuffer *pCommandBuffers) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 
     for (uint32_t i = 0; i < commandBufferCount; i++) {
         auto cb_node = GetCBNode(dev_data, pCommandBuffers[i]);
@@ -5483,10 +6006,10 @@ VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandPool com
         // Delete CB information structure, and remove from commandBufferMap
         if (cb_node) {
             dev_data->globalInFlightCmdBuffers.erase(cb_node->commandBuffer);
-            // reset prior to delete for data clean-up
+            // reset prior to recycling for data clean-up
             resetCB(dev_data, cb_node->commandBuffer);
             dev_data->commandBufferMap.erase(cb_node->commandBuffer);
-            delete cb_node;
+            RecycleCBNode(dev_data, cb_node);
         }
 
         // Remove commandBuffer reference from commandPoolMap
@@ -5504,7 +6027,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(VkDevice device, const VkComman
     VkResult result = dev_data->dispatch_table.CreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
 
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         dev_data->commandPoolMap[*pCommandPool].createFlags = pCreateInfo->flags;
         dev_data->commandPoolMap[*pCommandPool].queueFamilyIndex = pCreateInfo->queueFamilyIndex;
     }
@@ -5530,7 +6053,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(VkDevice device, const VkQueryPoo
         result = dev_data->dispatch_table.CreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     }
     if (result == VK_SUCCESS) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         QUERY_POOL_NODE *qp_node = &dev_data->queryPoolMap[*pQueryPool];
         qp_node->createInfo = *pCreateInfo;
     }
@@ -5553,18 +6076,10 @@ static void PostCallRecordDestroyCommandPool(layer_data *dev_data, VkCommandPool
     clearCommandBuffersInFlight(dev_data, cp_state);
     for (auto cb : cp_state->commandBuffers) {
         auto cb_node = GetCBNode(dev_data, cb);
-        clear_cmd_buf_and_mem_references(dev_data, cb_node);
-        // Remove references to this cb_node prior to delete
-        // TODO : Need better solution here, resetCB?
-        for (auto obj : cb_node->object_bindings) {
-            removeCommandBufferBinding(dev_data, &obj, cb_node);
-        }
-        for (auto framebuffer : cb_node->framebuffers) {
-            auto fb_state = GetFramebufferState(dev_data, framebuffer);
-            if (fb_state) fb_state->cb_bindings.erase(cb_node);
-        }
+        // Remove references to this cb_node prior to recycling it
+        resetCB(dev_data, cb);
         dev_data->commandBufferMap.erase(cb);  // Remove this command buffer
-        delete cb_node;                        // delete CB info structure
+        RecycleCBNode(dev_data, cb_node);
     }
     dev_data->commandPoolMap.erase(pool);
 }
@@ -5573,7 +6088,7 @@ static void PostCallRecordDestroyCommandPool(layer_data *dev_data, VkCommandPool
 VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     COMMAND_POOL_NODE *cp_state = nullptr;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateDestroyCommandPool(dev_data, commandPool, &cp_state);
     if (!skip) {
         lock.unlock();
@@ -5589,7 +6104,7 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(VkDevice device, VkCommandPool c
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto pPool = GetCommandPoolNode(dev_data, commandPool);
     skip |= checkCommandBuffersInFlight(dev_data, pPool, "reset command pool with", VALIDATION_ERROR_00072);
     lock.unlock();
@@ -5613,7 +6128,7 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(VkDevice device, VkCommandPool c
 VKAPI_ATTR VkResult VKAPI_CALL ResetFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     for (uint32_t i = 0; i < fenceCount; ++i) {
         auto pFence = GetFenceNode(dev_data, pFences[i]);
         if (pFence && pFence->state == FENCE_INFLIGHT) {
@@ -5678,7 +6193,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(VkDevice device, VkFramebuffer fra
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     FRAMEBUFFER_STATE *framebuffer_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateDestroyFramebuffer(dev_data, framebuffer, &framebuffer_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5712,7 +6227,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(VkDevice device, VkRenderPass rende
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     RENDER_PASS_STATE *rp_state = nullptr;
     VK_OBJECT obj_struct;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateDestroyRenderPass(dev_data, renderPass, &rp_state, &obj_struct);
     if (!skip) {
         lock.unlock();
@@ -5727,7 +6242,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(VkDevice device, VkRenderPass rende
 VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo,
                                             const VkAllocationCallbacks *pAllocator, VkBuffer *pBuffer) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateCreateBuffer(dev_data, pCreateInfo);
     lock.unlock();
 
@@ -5745,7 +6260,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreat
 VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(VkDevice device, const VkBufferViewCreateInfo *pCreateInfo,
                                                 const VkAllocationCallbacks *pAllocator, VkBufferView *pView) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateCreateBufferView(dev_data, pCreateInfo);
     lock.unlock();
     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -5790,15 +6305,9 @@ std::unordered_map<VkImage, std::unique_ptr<IMAGE_STATE>> *GetImageMap(core_vali
     return &device_data->imageMap;
 }
 
-std::unordered_map<VkImage, std::vector<ImageSubresourcePair>> *GetImageSubresourceMap(core_validation::layer_data *device_data) {
-    return &device_data->imageSubresourceMap;
-}
-
-std::unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> *GetImageLayoutMap(layer_data *device_data) {
-    return &device_data->imageLayoutMap;
-}
+GlobalImageLayoutMap *GetImageLayoutMap(layer_data *device_data) { return &device_data->imageLayoutMap; }
 
-std::unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> const *GetImageLayoutMap(layer_data const *device_data) {
+GlobalImageLayoutMap const *GetImageLayoutMap(layer_data const *device_data) {
     return &device_data->imageLayoutMap;
 }
 
@@ -5833,7 +6342,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImage(VkDevice device, const VkImageCreateI
         result = dev_data->dispatch_table.CreateImage(device, pCreateInfo, pAllocator, pImage);
     }
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         PostCallRecordCreateImage(dev_data, pCreateInfo, pImage);
     }
     return result;
@@ -5842,7 +6351,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImage(VkDevice device, const VkImageCreateI
 VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(VkDevice device, const VkImageViewCreateInfo *pCreateInfo,
                                                const VkAllocationCallbacks *pAllocator, VkImageView *pView) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateCreateImageView(dev_data, pCreateInfo);
     lock.unlock();
     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -5861,7 +6370,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFence(VkDevice device, const VkFenceCreateI
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->dispatch_table.CreateFence(device, pCreateInfo, pAllocator, pFence);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         auto &fence_node = dev_data->fenceMap[*pFence];
         fence_node.fence = *pFence;
         fence_node.createInfo = *pCreateInfo;
@@ -5945,30 +6454,47 @@ bool validate_dual_src_blend_feature(layer_data *device_data, PIPELINE_STATE *pi
     return skip;
 }
 
+// Minimum number of pipelines each validation thread handles when a batch is split across threads
+static const uint32_t kMinPipelinesPerValidationThread = 4;
+
+// Vertex attribute formats are checked by asking the layers below for their properties, which is left to the calling thread
+static bool ValidateVertexInputFormats(layer_data *device_data, instance_layer_data *instance_data,
+                                       const VkGraphicsPipelineCreateInfo *create_infos, uint32_t i) {
+    bool skip = false;
+    if (create_infos[i].pVertexInputState != NULL) {
+        for (uint32_t j = 0; j < create_infos[i].pVertexInputState->vertexAttributeDescriptionCount; j++) {
+            VkFormat format = create_infos[i].pVertexInputState->pVertexAttributeDescriptions[j].format;
+            // Internal call to get format info.  Still goes through layers, could potentially go directly to ICD.
+            VkFormatProperties properties;
+            instance_data->dispatch_table.GetPhysicalDeviceFormatProperties(device_data->physical_device, format, &properties);
+            if ((properties.bufferFeatures & VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT) == 0) {
+                skip |= log_msg(
+                    device_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
+                    __LINE__, VALIDATION_ERROR_01413, "IMAGE",
+                    "vkCreateGraphicsPipelines: pCreateInfo[%d].pVertexInputState->vertexAttributeDescriptions[%d].format "
+                    "(%s) is not a supported vertex buffer format. %s",
+                    i, j, string_VkFormat(format), validation_error_map[VALIDATION_ERROR_01413]);
+            }
+        }
+    }
+    return skip;
+}
+
+// Pipelines in a batch are independent (a derivative only reads its base's create flags), so validate them in parallel
 static bool PreCallCreateGraphicsPipelines(layer_data *device_data, uint32_t count,
                                            const VkGraphicsPipelineCreateInfo *create_infos, vector<PIPELINE_STATE *> &pipe_state) {
-    bool skip = false;
     instance_layer_data *instance_data =
         GetLayerDataPtr(get_dispatch_key(device_data->instance_data->instance), instance_layer_data_map);
 
+    std::vector<char> pipe_skip(count, 0);
+    std::vector<debug_report_deferred_messages> messages;
+    RunInParallel(device_data, count, kMinPipelinesPerValidationThread, messages,
+                  [&](uint32_t i) { pipe_skip[i] = verifyPipelineCreateState(device_data, pipe_state, i); });
+    bool skip = false;
     for (uint32_t i = 0; i < count; i++) {
-        skip |= verifyPipelineCreateState(device_data, pipe_state, i);
-        if (create_infos[i].pVertexInputState != NULL) {
-            for (uint32_t j = 0; j < create_infos[i].pVertexInputState->vertexAttributeDescriptionCount; j++) {
-                VkFormat format = create_infos[i].pVertexInputState->pVertexAttributeDescriptions[j].format;
-                // Internal call to get format info.  Still goes through layers, could potentially go directly to ICD.
-                VkFormatProperties properties;
-                instance_data->dispatch_table.GetPhysicalDeviceFormatProperties(device_data->physical_device, format, &properties);
-                if ((properties.bufferFeatures & VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT) == 0) {
-                    skip |= log_msg(
-                        device_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                        __LINE__, VALIDATION_ERROR_01413, "IMAGE",
-                        "vkCreateGraphicsPipelines: pCreateInfo[%d].pVertexInputState->vertexAttributeDescriptions[%d].format "
-                        "(%s) is not a supported vertex buffer format. %s",
-                        i, j, string_VkFormat(format), validation_error_map[VALIDATION_ERROR_01413]);
-                }
-            }
-        }
+        skip |= pipe_skip[i] != 0;
+        skip |= debug_report_deliver_deferred(messages[i]);
+        skip |= ValidateVertexInputFormats(device_data, instance_data, create_infos, i);
     }
     return skip;
 }
@@ -5981,21 +6507,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
     //  1. Pipeline create state is first shadowed into PIPELINE_STATE struct
     //  2. Create state is then validated (which uses flags setup during shadowing)
     //  3. If everything looks good, we'll then create the pipeline and add NODE to pipelineMap
+    // Steps 1 and 2 only read device state, so they run under a shared lock; step 3 takes it exclusive.
     bool skip = false;
     // TODO : Improve this data struct w/ unique_ptrs so cleanup below is automatic
     vector<PIPELINE_STATE *> pipe_state(count);
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
 
     uint32_t i = 0;
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock validate_lock(global_lock);
 
     for (i = 0; i < count; i++) {
         pipe_state[i] = new PIPELINE_STATE;
         pipe_state[i]->initGraphicsPipeline(&pCreateInfos[i]);
+        set_pipeline_state(pipe_state[i]);
         pipe_state[i]->render_pass_ci.initialize(GetRenderPassState(dev_data, pCreateInfos[i].renderPass)->createInfo.ptr());
         pipe_state[i]->pipeline_layout = *getPipelineLayout(dev_data, pCreateInfos[i].layout);
     }
     skip |= PreCallCreateGraphicsPipelines(dev_data, count, pCreateInfos, pipe_state);
+    validate_lock.unlock();
 
     if (skip) {
         for (i = 0; i < count; i++) {
@@ -6005,10 +6534,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
         return VK_ERROR_VALIDATION_FAILED_EXT;
     }
 
-    lock.unlock();
     auto result =
         dev_data->dispatch_table.CreateGraphicsPipelines(device, pipelineCache, count, pCreateInfos, pAllocator, pPipelines);
-    lock.lock();
+    std::lock_guard<rw_lock> lock(global_lock);
     for (i = 0; i < count; i++) {
         if (pPipelines[i] == VK_NULL_HANDLE) {
             delete pipe_state[i];
@@ -6024,14 +6552,12 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
 VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                                       const VkComputePipelineCreateInfo *pCreateInfos,
                                                       const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines) {
-    bool skip = false;
-
     // TODO : Improve this data struct w/ unique_ptrs so cleanup below is automatic
     vector<PIPELINE_STATE *> pPipeState(count);
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
 
     uint32_t i = 0;
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock validate_lock(global_lock);
     for (i = 0; i < count; i++) {
         // TODO: Verify compute stage bits
 
@@ -6039,11 +6565,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, VkPipelin
         pPipeState[i] = new PIPELINE_STATE;
         pPipeState[i]->initComputePipeline(&pCreateInfos[i]);
         pPipeState[i]->pipeline_layout = *getPipelineLayout(dev_data, pCreateInfos[i].layout);
+    }
 
-        // TODO: Add Compute Pipeline Verification
-        skip |= validate_compute_pipeline(dev_data, pPipeState[i]);
-        // skip |= verifyPipelineCreateState(dev_data, pPipeState[i]);
+    // TODO: Add Compute Pipeline Verification
+    std::vector<char> pipe_skip(count, 0);
+    std::vector<debug_report_deferred_messages> messages;
+    RunInParallel(dev_data, count, kMinPipelinesPerValidationThread, messages,
+                  [&](uint32_t index) { pipe_skip[index] = validate_compute_pipeline(dev_data, pPipeState[index]); });
+    bool skip = false;
+    for (i = 0; i < count; i++) {
+        skip |= pipe_skip[i] != 0;
+        skip |= debug_report_deliver_deferred(messages[i]);
     }
+    validate_lock.unlock();
 
     if (skip) {
         for (i = 0; i < count; i++) {
@@ -6054,10 +6588,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, VkPipelin
         return VK_ERROR_VALIDATION_FAILED_EXT;
     }
 
-    lock.unlock();
     auto result =
         dev_data->dispatch_table.CreateComputePipelines(device, pipelineCache, count, pCreateInfos, pAllocator, pPipelines);
-    lock.lock();
+    std::lock_guard<rw_lock> lock(global_lock);
     for (i = 0; i < count; i++) {
         if (pPipelines[i] == VK_NULL_HANDLE) {
             delete pPipeState[i];
@@ -6075,7 +6608,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(VkDevice device, const VkSamplerCre
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->dispatch_table.CreateSampler(device, pCreateInfo, pAllocator, pSampler);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         dev_data->samplerMap[*pSampler] = unique_ptr<SAMPLER_STATE>(new SAMPLER_STATE(pSampler, pCreateInfo));
     }
     return result;
@@ -6097,7 +6630,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(VkDevice device, const
                                                          VkDescriptorSetLayout *pSetLayout) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateCreateDescriptorSetLayout(dev_data, pCreateInfo);
     if (!skip) {
         lock.unlock();
@@ -6249,7 +6782,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPip
 
     VkResult result = dev_data->dispatch_table.CreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         PIPELINE_LAYOUT_NODE &plNode = dev_data->pipelineLayoutMap[*pPipelineLayout];
         plNode.layout = *pPipelineLayout;
         plNode.set_layouts.resize(pCreateInfo->setLayoutCount);
@@ -6276,7 +6809,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(VkDevice device, const VkDes
                         "Out of memory while attempting to allocate DESCRIPTOR_POOL_STATE in vkCreateDescriptorPool()"))
                 return VK_ERROR_VALIDATION_FAILED_EXT;
         } else {
-            std::lock_guard<std::mutex> lock(global_lock);
+            std::lock_guard<rw_lock> lock(global_lock);
             dev_data->descriptorPoolMap[*pDescriptorPool] = pNewNode;
         }
     } else {
@@ -6291,7 +6824,7 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(VkDevice device, VkDescriptor
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->dispatch_table.ResetDescriptorPool(device, descriptorPool, flags);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         clearDescriptorPool(dev_data, device, descriptorPool, flags);
     }
     return result;
@@ -6319,7 +6852,7 @@ static void PostCallRecordAllocateDescriptorSets(layer_data *dev_data, const VkD
 VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo,
                                                       VkDescriptorSet *pDescriptorSets) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     cvdescriptorset::AllocateDescriptorSetsData common_data(pAllocateInfo->descriptorSetCount);
     bool skip = PreCallValidateAllocateDescriptorSets(dev_data, pAllocateInfo, &common_data);
     lock.unlock();
@@ -6385,7 +6918,7 @@ VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(VkDevice device, VkDescriptorP
                                                   const VkDescriptorSet *pDescriptorSets) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     // Make sure that no sets being destroyed are in-flight
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateFreeDescriptorSets(dev_data, descriptorPool, count, pDescriptorSets);
     lock.unlock();
 
@@ -6429,7 +6962,7 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(VkDevice device, uint32_t descri
                                                 const VkCopyDescriptorSet *pDescriptorCopies) {
     // Only map look-up at top level is for device-level layer_data
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateUpdateDescriptorSets(dev_data, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount,
                                                     pDescriptorCopies);
     lock.unlock();
@@ -6448,14 +6981,21 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(VkDevice device, const VkC
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->dispatch_table.AllocateCommandBuffers(device, pCreateInfo, pCommandBuffer);
     if (VK_SUCCESS == result) {
-        std::unique_lock<std::mutex> lock(global_lock);
+        std::unique_lock<rw_lock> lock(global_lock);
         auto pPool = GetCommandPoolNode(dev_data, pCreateInfo->commandPool);
 
         if (pPool) {
             for (uint32_t i = 0; i < pCreateInfo->commandBufferCount; i++) {
                 // Add command buffer to its commandPool map
                 pPool->commandBuffers.push_back(pCommandBuffer[i]);
-                GLOBAL_CB_NODE *pCB = new GLOBAL_CB_NODE;
+                // Prefer a node recycled from a freed command buffer, which already has memory for its tracking state
+                GLOBAL_CB_NODE *pCB = nullptr;
+                if (dev_data->free_cb_nodes.empty()) {
+                    pCB = new GLOBAL_CB_NODE;
+                } else {
+                    pCB = dev_data->free_cb_nodes.back();
+                    dev_data->free_cb_nodes.pop_back();
+                }
                 // Add command buffer to map
                 dev_data->commandBufferMap[pCommandBuffer[i]] = pCB;
                 resetCB(dev_data, pCommandBuffer[i]);
@@ -6470,7 +7010,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(VkDevice device, const VkC
 
 // Add bindings between the given cmd buffer & framebuffer and the framebuffer's children
 static void AddFramebufferBinding(layer_data *dev_data, GLOBAL_CB_NODE *cb_state, FRAMEBUFFER_STATE *fb_state) {
-    addCommandBufferBinding(&fb_state->cb_bindings,
+    addCommandBufferBinding(fb_state,
                             {reinterpret_cast<uint64_t &>(fb_state->framebuffer), kVulkanObjectTypeFramebuffer},
                             cb_state);
     for (auto attachment : fb_state->attachments) {
@@ -6481,7 +7021,7 @@ static void AddFramebufferBinding(layer_data *dev_data, GLOBAL_CB_NODE *cb_state
         auto rp_state = GetRenderPassState(dev_data, fb_state->createInfo.renderPass);
         if (rp_state) {
             addCommandBufferBinding(
-                &rp_state->cb_bindings,
+                rp_state,
                 {reinterpret_cast<uint64_t &>(rp_state->renderPass), kVulkanObjectTypeRenderPass}, cb_state);
         }
     }
@@ -6490,7 +7030,7 @@ static void AddFramebufferBinding(layer_data *dev_data, GLOBAL_CB_NODE *cb_state
 VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     // Validate command buffer level
     GLOBAL_CB_NODE *cb_node = GetCBNode(dev_data, commandBuffer);
     if (cb_node) {
@@ -6615,7 +7155,7 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer,
 VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer commandBuffer) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         if ((VK_COMMAND_BUFFER_LEVEL_PRIMARY == pCB->createInfo.level) ||
@@ -6649,7 +7189,7 @@ VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer commandBuffer) {
 VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     VkCommandPool cmdPool = pCB->createInfo.commandPool;
     auto pPool = GetCommandPoolNode(dev_data, cmdPool);
@@ -6677,7 +7217,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipe
                                            VkPipeline pipeline) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "vkCmdBindPipeline()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
@@ -6696,8 +7236,8 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipe
         PIPELINE_STATE *pipe_state = getPipelineState(dev_data, pipeline);
         if (pipe_state) {
             cb_state->lastBound[pipelineBindPoint].pipeline_state = pipe_state;
+            cb_state->lastBound[pipelineBindPoint].bind_generation++;
             set_cb_pso_status(cb_state, pipe_state);
-            set_pipeline_state(pipe_state);
             skip |= validate_dual_src_blend_feature(dev_data, pipe_state);
         } else {
             skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_EXT,
@@ -6705,14 +7245,13 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipe
                             "Attempt to bind Pipeline 0x%" PRIxLEAST64 " that doesn't exist! %s", (uint64_t)(pipeline),
                             validation_error_map[VALIDATION_ERROR_00600]);
         }
-        addCommandBufferBinding(&pipe_state->cb_bindings,
-                                {reinterpret_cast<uint64_t &>(pipeline), kVulkanObjectTypePipeline}, cb_state);
+        addCommandBufferBinding(pipe_state, {reinterpret_cast<uint64_t &>(pipeline), kVulkanObjectTypePipeline}, cb_state);
         if (VK_PIPELINE_BIND_POINT_GRAPHICS == pipelineBindPoint) {
             // Add binding for child renderpass
             auto rp_state = GetRenderPassState(dev_data, pipe_state->graphicsPipelineCI.renderPass);
             if (rp_state) {
                 addCommandBufferBinding(
-                    &rp_state->cb_bindings,
+                    rp_state,
                     {reinterpret_cast<uint64_t &>(rp_state->renderPass), kVulkanObjectTypeRenderPass}, cb_state);
             }
         }
@@ -6725,7 +7264,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(VkCommandBuffer commandBuffer, uint32_
                                           const VkViewport *pViewports) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetViewport()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01446);
@@ -6741,7 +7280,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t
                                          const VkRect2D *pScissors) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetScissor()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01495);
@@ -6756,7 +7295,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t
 VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetLineWidth()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01480);
@@ -6784,7 +7323,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(VkCommandBuffer commandBuffer, float
                                            float depthBiasSlopeFactor) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetDepthBias()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01485);
@@ -6809,7 +7348,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(VkCommandBuffer commandBuffer, float
 VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetBlendConstants()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01553);
@@ -6824,7 +7363,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer commandBuffer, c
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetDepthBounds()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01509);
@@ -6840,7 +7379,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(VkCommandBuffer commandBuffe
                                                     uint32_t compareMask) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetStencilCompareMask()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01519);
@@ -6855,7 +7394,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(VkCommandBuffer commandBuffe
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetStencilWriteMask()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01525);
@@ -6870,7 +7409,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetStencilReference()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01531);
@@ -6888,7 +7427,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer,
                                                  const uint32_t *pDynamicOffsets) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "vkCmdBindDescriptorSets()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
@@ -6903,6 +7442,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer,
             cb_state->lastBound[pipelineBindPoint].dynamicOffsets.resize(last_set_index + 1);
         }
         auto old_final_bound_set = cb_state->lastBound[pipelineBindPoint].boundDescriptorSets[last_set_index];
+        cb_state->lastBound[pipelineBindPoint].bind_generation++;
         auto pipeline_layout = getPipelineLayout(dev_data, layout);
         for (uint32_t set_idx = 0; set_idx < setCount; set_idx++) {
             cvdescriptorset::DescriptorSet *descriptor_set = GetSetNode(dev_data, pDescriptorSets[set_idx]);
@@ -7051,7 +7591,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkB
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     // TODO : Somewhere need to verify that IBs have correct usage state flagged
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
 
     auto buffer_state = GetBufferState(dev_data, buffer);
     auto cb_node = GetCBNode(dev_data, commandBuffer);
@@ -7059,10 +7599,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkB
         skip |= ValidateCmdQueueFlags(dev_data, cb_node, "vkCmdBindIndexBuffer()", VK_QUEUE_GRAPHICS_BIT, VALIDATION_ERROR_01357);
         skip |= ValidateCmd(dev_data, cb_node, CMD_BINDINDEXBUFFER, "vkCmdBindIndexBuffer()");
         skip |= ValidateMemoryIsBoundToBuffer(dev_data, buffer_state, "vkCmdBindIndexBuffer()", VALIDATION_ERROR_02543);
-        std::function<bool()> function = [=]() {
-            return ValidateBufferMemoryIsValid(dev_data, buffer_state, "vkCmdBindIndexBuffer()");
-        };
-        cb_node->validate_functions.push_back(function);
+        cb_node->deferred_checks->ValidateBufferMemory(buffer_state, "vkCmdBindIndexBuffer()");
         UpdateCmdBufferLastCmd(cb_node, CMD_BINDINDEXBUFFER);
         VkDeviceSize offset_align = 0;
         switch (indexType) {
@@ -7107,7 +7644,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, u
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     // TODO : Somewhere need to verify that VBs have correct usage state flagged
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
 
     auto cb_node = GetCBNode(dev_data, commandBuffer);
     if (cb_node) {
@@ -7117,10 +7654,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, u
             auto buffer_state = GetBufferState(dev_data, pBuffers[i]);
             assert(buffer_state);
             skip |= ValidateMemoryIsBoundToBuffer(dev_data, buffer_state, "vkCmdBindVertexBuffers()", VALIDATION_ERROR_02546);
-            std::function<bool()> function = [=]() {
-                return ValidateBufferMemoryIsValid(dev_data, buffer_state, "vkCmdBindVertexBuffers()");
-            };
-            cb_node->validate_functions.push_back(function);
+            cb_node->deferred_checks->ValidateBufferMemory(buffer_state, "vkCmdBindVertexBuffers()");
             if (pOffsets[i] >= buffer_state->createInfo.size) {
                 skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT,
                                 reinterpret_cast<uint64_t &>(buffer_state->buffer), __LINE__, VALIDATION_ERROR_01417, "DS",
@@ -7145,20 +7679,12 @@ static void MarkStoreImagesAndBuffersAsWritten(layer_data *dev_data, GLOBAL_CB_N
 
         auto image_state = GetImageState(dev_data, view_state->create_info.image);
         assert(image_state);
-        std::function<bool()> function = [=]() {
-            SetImageMemoryValid(dev_data, image_state, true);
-            return false;
-        };
-        pCB->validate_functions.push_back(function);
+        pCB->deferred_checks->SetImageMemoryValid(image_state, true);
     }
     for (auto buffer : pCB->updateBuffers) {
         auto buffer_state = GetBufferState(dev_data, buffer);
         assert(buffer_state);
-        std::function<bool()> function = [=]() {
-            SetBufferMemoryValid(dev_data, buffer_state, true);
-            return false;
-        };
-        pCB->validate_functions.push_back(function);
+        pCB->deferred_checks->SetBufferMemoryValid(buffer_state, true);
     }
 }
 
@@ -7209,7 +7735,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer commandBuffer, uint32_t verte
                                    uint32_t firstVertex, uint32_t firstInstance) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     bool skip = PreCallValidateCmdDraw(dev_data, commandBuffer, false, VK_PIPELINE_BIND_POINT_GRAPHICS, &cb_state, "vkCmdDraw()");
     lock.unlock();
     if (!skip) {
@@ -7234,7 +7760,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_
                                           uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     bool skip = PreCallValidateCmdDrawIndexed(dev_data, commandBuffer, true, VK_PIPELINE_BIND_POINT_GRAPHICS, &cb_state,
                                               "vkCmdDrawIndexed()");
     lock.unlock();
@@ -7269,7 +7795,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuff
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
     BUFFER_STATE *buffer_state = nullptr;
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     bool skip = PreCallValidateCmdDrawIndirect(dev_data, commandBuffer, buffer, false, VK_PIPELINE_BIND_POINT_GRAPHICS, &cb_state,
                                                &buffer_state, "vkCmdDrawIndirect()");
     lock.unlock();
@@ -7305,7 +7831,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer,
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
     BUFFER_STATE *buffer_state = nullptr;
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     bool skip = PreCallValidateCmdDrawIndexedIndirect(dev_data, commandBuffer, buffer, true, VK_PIPELINE_BIND_POINT_GRAPHICS,
                                                       &cb_state, &buffer_state, "vkCmdDrawIndexedIndirect()");
     lock.unlock();
@@ -7330,7 +7856,7 @@ static void PostCallRecordCmdDispatch(layer_data *dev_data, GLOBAL_CB_NODE *cb_s
 VKAPI_ATTR void VKAPI_CALL CmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     bool skip =
         PreCallValidateCmdDispatch(dev_data, commandBuffer, false, VK_PIPELINE_BIND_POINT_COMPUTE, &cb_state, "vkCmdDispatch()");
     lock.unlock();
@@ -7363,7 +7889,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(VkCommandBuffer commandBuffer, Vk
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
     BUFFER_STATE *buffer_state = nullptr;
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     bool skip = PreCallValidateCmdDispatchIndirect(dev_data, commandBuffer, buffer, false, VK_PIPELINE_BIND_POINT_COMPUTE,
                                                    &cb_state, &buffer_state, "vkCmdDispatchIndirect()");
     lock.unlock();
@@ -7378,7 +7904,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(VkCommandBuffer commandBuffer, Vk
 VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
                                          uint32_t regionCount, const VkBufferCopy *pRegions) {
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
 
     auto cb_node = GetCBNode(device_data, commandBuffer);
     auto src_buffer_state = GetBufferState(device_data, srcBuffer);
@@ -7402,7 +7928,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage(VkCommandBuffer commandBuffer, VkImage s
                                         const VkImageCopy *pRegions) {
     bool skip = false;
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 
     auto cb_node = GetCBNode(device_data, commandBuffer);
     auto src_image_state = GetImageState(device_data, srcImage);
@@ -7442,7 +7968,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(VkCommandBuffer commandBuffer, VkImage s
                                         VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                         const VkImageBlit *pRegions, VkFilter filter) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 
     auto cb_node = GetCBNode(dev_data, commandBuffer);
     auto src_image_state = GetImageState(dev_data, srcImage);
@@ -7462,7 +7988,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(VkCommandBuffer commandBuffer, V
                                                 VkImageLayout dstImageLayout, uint32_t regionCount,
                                                 const VkBufferImageCopy *pRegions) {
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = false;
     auto cb_node = GetCBNode(device_data, commandBuffer);
     auto src_buffer_state = GetBufferState(device_data, srcBuffer);
@@ -7487,7 +8013,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(VkCommandBuffer commandBuffer, V
                                                 VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy *pRegions) {
     bool skip = false;
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 
     auto cb_node = GetCBNode(device_data, commandBuffer);
     auto src_image_state = GetImageState(device_data, srcImage);
@@ -7512,7 +8038,7 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuff
                                            VkDeviceSize dataSize, const uint32_t *pData) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
 
     auto cb_node = GetCBNode(dev_data, commandBuffer);
     auto dst_buff_state = GetBufferState(dev_data, dstBuffer);
@@ -7523,11 +8049,7 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuff
         // Validate that DST buffer has correct usage flags set
         skip |= ValidateBufferUsageFlags(dev_data, dst_buff_state, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, VALIDATION_ERROR_01146,
                                          "vkCmdUpdateBuffer()", "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            SetBufferMemoryValid(dev_data, dst_buff_state, true);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        cb_node->deferred_checks->SetBufferMemoryValid(dst_buff_state, true);
 
         skip |= ValidateCmdQueueFlags(dev_data, cb_node, "vkCmdUpdateBuffer()",
                                       VK_QUEUE_TRANSFER_BIT | VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, VALIDATION_ERROR_01154);
@@ -7544,7 +8066,7 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuff
 VKAPI_ATTR void VKAPI_CALL CmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                          VkDeviceSize size, uint32_t data) {
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     auto cb_node = GetCBNode(device_data, commandBuffer);
     auto buffer_state = GetBufferState(device_data, dstBuffer);
 
@@ -7567,7 +8089,7 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(VkCommandBuffer commandBuffer, ui
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         skip = PreCallValidateCmdClearAttachments(dev_data, commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     }
     if (!skip) dev_data->dispatch_table.CmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
@@ -7577,7 +8099,7 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(VkCommandBuffer commandBuffer, VkI
                                               const VkClearColorValue *pColor, uint32_t rangeCount,
                                               const VkImageSubresourceRange *pRanges) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 
     bool skip = PreCallValidateCmdClearColorImage(dev_data, commandBuffer, image, imageLayout, rangeCount, pRanges);
     if (!skip) {
@@ -7591,7 +8113,7 @@ VKAPI_ATTR void VKAPI_CALL CmdClearDepthStencilImage(VkCommandBuffer commandBuff
                                                      const VkClearDepthStencilValue *pDepthStencil, uint32_t rangeCount,
                                                      const VkImageSubresourceRange *pRanges) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 
     bool skip = PreCallValidateCmdClearDepthStencilImage(dev_data, commandBuffer, image, imageLayout, rangeCount, pRanges);
     if (!skip) {
@@ -7605,7 +8127,7 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(VkCommandBuffer commandBuffer, VkImag
                                            VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                            const VkImageResolve *pRegions) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 
     auto cb_node = GetCBNode(dev_data, commandBuffer);
     auto src_image_state = GetImageState(dev_data, srcImage);
@@ -7647,7 +8169,7 @@ bool setEventStageMask(VkQueue queue, VkCommandBuffer commandBuffer, VkEvent eve
 VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetEvent()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
@@ -7659,7 +8181,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent ev
             ValidateStageMaskGsTsEnables(dev_data, stageMask, "vkCmdSetEvent()", VALIDATION_ERROR_00230, VALIDATION_ERROR_00231);
         auto event_state = GetEventNode(dev_data, event);
         if (event_state) {
-            addCommandBufferBinding(&event_state->cb_bindings,
+            addCommandBufferBinding(event_state,
                                     {reinterpret_cast<uint64_t &>(event), kVulkanObjectTypeEvent}, pCB);
             event_state->cb_bindings.insert(pCB);
         }
@@ -7667,9 +8189,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent ev
         if (!pCB->waitedEvents.count(event)) {
             pCB->writeEventsBeforeWait.push_back(event);
         }
-        std::function<bool(VkQueue)> eventUpdate =
-            std::bind(setEventStageMask, std::placeholders::_1, commandBuffer, event, stageMask);
-        pCB->eventUpdates.push_back(eventUpdate);
+        pCB->deferred_checks->SetEventStageMask(event, stageMask);
     }
     lock.unlock();
     if (!skip) dev_data->dispatch_table.CmdSetEvent(commandBuffer, event, stageMask);
@@ -7678,7 +8198,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent ev
 VKAPI_ATTR void VKAPI_CALL CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdResetEvent()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
@@ -7690,7 +8210,7 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent
             ValidateStageMaskGsTsEnables(dev_data, stageMask, "vkCmdResetEvent()", VALIDATION_ERROR_00240, VALIDATION_ERROR_00241);
         auto event_state = GetEventNode(dev_data, event);
         if (event_state) {
-            addCommandBufferBinding(&event_state->cb_bindings,
+            addCommandBufferBinding(event_state,
                                     {reinterpret_cast<uint64_t &>(event), kVulkanObjectTypeEvent}, pCB);
             event_state->cb_bindings.insert(pCB);
         }
@@ -7699,9 +8219,7 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent
             pCB->writeEventsBeforeWait.push_back(event);
         }
         // TODO : Add check for VALIDATION_ERROR_00226
-        std::function<bool(VkQueue)> eventUpdate =
-            std::bind(setEventStageMask, std::placeholders::_1, commandBuffer, event, VkPipelineStageFlags(0));
-        pCB->eventUpdates.push_back(eventUpdate);
+        pCB->deferred_checks->SetEventStageMask(event, VkPipelineStageFlags(0));
     }
     lock.unlock();
     if (!skip) dev_data->dispatch_table.CmdResetEvent(commandBuffer, event, stageMask);
@@ -8015,7 +8533,7 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t
                                          uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
         skip |= ValidateStageMasksAgainstQueueCapabilities(dev_data, cb_state, sourceStageMask, dstStageMask, "vkCmdWaitEvents",
@@ -8028,7 +8546,7 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t
         for (uint32_t i = 0; i < eventCount; ++i) {
             auto event_state = GetEventNode(dev_data, pEvents[i]);
             if (event_state) {
-                addCommandBufferBinding(&event_state->cb_bindings,
+                addCommandBufferBinding(event_state,
                                         {reinterpret_cast<const uint64_t &>(pEvents[i]), kVulkanObjectTypeEvent},
                                         cb_state);
                 event_state->cb_bindings.insert(cb_state);
@@ -8036,9 +8554,7 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t
             cb_state->waitedEvents.insert(pEvents[i]);
             cb_state->events.push_back(pEvents[i]);
         }
-        std::function<bool(VkQueue)> event_update =
-            std::bind(validateEventStageMask, std::placeholders::_1, cb_state, eventCount, first_event_index, sourceStageMask);
-        cb_state->eventUpdates.push_back(event_update);
+        cb_state->deferred_checks->ValidateEventStageMask(static_cast<uint32_t>(first_event_index), eventCount, sourceStageMask);
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "vkCmdWaitEvents()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
                                       VALIDATION_ERROR_00262);
         skip |= ValidateCmd(dev_data, cb_state, CMD_WAITEVENTS, "vkCmdWaitEvents()");
@@ -8094,7 +8610,7 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkP
                                               uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers) {
     bool skip = false;
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(device_data, commandBuffer);
     if (cb_state) {
         skip |= PreCallValidateCmdPipelineBarrier(device_data, cb_state, commandBuffer, srcStageMask, dstStageMask,
@@ -8130,7 +8646,7 @@ bool setQueryState(VkQueue queue, VkCommandBuffer commandBuffer, QueryObject obj
 VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot, VkFlags flags) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         QueryObject query = {queryPool, slot};
@@ -8142,7 +8658,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryP
                                       VALIDATION_ERROR_01039);
         skip |= ValidateCmd(dev_data, pCB, CMD_BEGINQUERY, "vkCmdBeginQuery()");
         UpdateCmdBufferLastCmd(pCB, CMD_BEGINQUERY);
-        addCommandBufferBinding(&GetQueryPoolNode(dev_data, queryPool)->cb_bindings,
+        addCommandBufferBinding(GetQueryPoolNode(dev_data, queryPool),
                                 {reinterpret_cast<uint64_t &>(queryPool), kVulkanObjectTypeQueryPool}, pCB);
     }
     lock.unlock();
@@ -8152,7 +8668,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryP
 VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
         QueryObject query = {queryPool, slot};
@@ -8164,13 +8680,12 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPoo
         } else {
             cb_state->activeQueries.erase(query);
         }
-        std::function<bool(VkQueue)> query_update = std::bind(setQueryState, std::placeholders::_1, commandBuffer, query, true);
-        cb_state->queryUpdates.push_back(query_update);
+        cb_state->deferred_checks->SetQueryState(query, true);
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "VkCmdEndQuery()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
                                       VALIDATION_ERROR_01046);
         skip |= ValidateCmd(dev_data, cb_state, CMD_ENDQUERY, "VkCmdEndQuery()");
         UpdateCmdBufferLastCmd(cb_state, CMD_ENDQUERY);
-        addCommandBufferBinding(&GetQueryPoolNode(dev_data, queryPool)->cb_bindings,
+        addCommandBufferBinding(GetQueryPoolNode(dev_data, queryPool),
                                 {reinterpret_cast<uint64_t &>(queryPool), kVulkanObjectTypeQueryPool}, cb_state);
     }
     lock.unlock();
@@ -8181,22 +8696,21 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQu
                                              uint32_t queryCount) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
         for (uint32_t i = 0; i < queryCount; i++) {
             QueryObject query = {queryPool, firstQuery + i};
-            cb_state->waitedEventsBeforeQueryReset[query] = cb_state->waitedEvents;
-            std::function<bool(VkQueue)> query_update =
-                std::bind(setQueryState, std::placeholders::_1, commandBuffer, query, false);
-            cb_state->queryUpdates.push_back(query_update);
+            cb_state->waitedEventsBeforeQueryReset[query] =
+                std::unordered_set<VkEvent>(cb_state->waitedEvents.begin(), cb_state->waitedEvents.end());
+            cb_state->deferred_checks->SetQueryState(query, false);
         }
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "VkCmdResetQueryPool()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
                                       VALIDATION_ERROR_01024);
         skip |= ValidateCmd(dev_data, cb_state, CMD_RESETQUERYPOOL, "VkCmdResetQueryPool()");
         UpdateCmdBufferLastCmd(cb_state, CMD_RESETQUERYPOOL);
         skip |= insideRenderPass(dev_data, cb_state, "vkCmdResetQueryPool()", VALIDATION_ERROR_01025);
-        addCommandBufferBinding(&GetQueryPoolNode(dev_data, queryPool)->cb_bindings,
+        addCommandBufferBinding(GetQueryPoolNode(dev_data, queryPool),
                                 {reinterpret_cast<uint64_t &>(queryPool), kVulkanObjectTypeQueryPool}, cb_state);
     }
     lock.unlock();
@@ -8241,7 +8755,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer
                                                    VkDeviceSize stride, VkQueryResultFlags flags) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 
     auto cb_node = GetCBNode(dev_data, commandBuffer);
     auto dst_buff_state = GetBufferState(dev_data, dstBuffer);
@@ -8252,20 +8766,14 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer
         // Validate that DST buffer has correct usage flags set
         skip |= ValidateBufferUsageFlags(dev_data, dst_buff_state, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, VALIDATION_ERROR_01066,
                                          "vkCmdCopyQueryPoolResults()", "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            SetBufferMemoryValid(dev_data, dst_buff_state, true);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
-        std::function<bool(VkQueue)> query_update =
-            std::bind(validateQuery, std::placeholders::_1, cb_node, queryPool, queryCount, firstQuery);
-        cb_node->queryUpdates.push_back(query_update);
+        cb_node->deferred_checks->SetBufferMemoryValid(dst_buff_state, true);
+        cb_node->deferred_checks->ValidateQuery(queryPool, firstQuery, queryCount);
         skip |= ValidateCmdQueueFlags(dev_data, cb_node, "vkCmdCopyQueryPoolResults()",
                                       VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, VALIDATION_ERROR_01073);
         skip |= ValidateCmd(dev_data, cb_node, CMD_COPYQUERYPOOLRESULTS, "vkCmdCopyQueryPoolResults()");
         UpdateCmdBufferLastCmd(cb_node, CMD_COPYQUERYPOOLRESULTS);
         skip |= insideRenderPass(dev_data, cb_node, "vkCmdCopyQueryPoolResults()", VALIDATION_ERROR_01074);
-        addCommandBufferBinding(&GetQueryPoolNode(dev_data, queryPool)->cb_bindings,
+        addCommandBufferBinding(GetQueryPoolNode(dev_data, queryPool),
                                 {reinterpret_cast<uint64_t &>(queryPool), kVulkanObjectTypeQueryPool}, cb_node);
     } else {
         assert(0);
@@ -8280,7 +8788,7 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(VkCommandBuffer commandBuffer, VkPip
                                             uint32_t offset, uint32_t size, const void *pValues) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "vkCmdPushConstants()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
@@ -8325,12 +8833,11 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPi
                                              VkQueryPool queryPool, uint32_t slot) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
         QueryObject query = {queryPool, slot};
-        std::function<bool(VkQueue)> query_update = std::bind(setQueryState, std::placeholders::_1, commandBuffer, query, true);
-        cb_state->queryUpdates.push_back(query_update);
+        cb_state->deferred_checks->SetQueryState(query, true);
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "vkCmdWriteTimestamp()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
                                       VALIDATION_ERROR_01082);
         skip |= ValidateCmd(dev_data, cb_state, CMD_WRITETIMESTAMP, "vkCmdWriteTimestamp()");
@@ -8565,7 +9072,7 @@ static void PostCallRecordCreateFramebuffer(layer_data *dev_data, const VkFrameb
 VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo *pCreateInfo,
                                                  const VkAllocationCallbacks *pAllocator, VkFramebuffer *pFramebuffer) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     bool skip = PreCallValidateCreateFramebuffer(dev_data, pCreateInfo);
     lock.unlock();
 
@@ -8842,6 +9349,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShade
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     spv_result_t spv_valid = SPV_SUCCESS;
+    size_t word_count = 0;
+    uint64_t code_hash = 0;
+    bool cache_hit = false;
+    std::shared_ptr<shader_module> cached_module;
 
     if (!GetDisables(dev_data)->shader_validation) {
         if (!dev_data->device_extensions.nv_glsl_shader && (pCreateInfo->codeSize % 4)) {
@@ -8850,23 +9361,32 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShade
                             "SPIR-V module not valid: Codesize must be a multiple of 4 but is " PRINTF_SIZE_T_SPECIFIER ". %s",
                             pCreateInfo->codeSize, validation_error_map[VALIDATION_ERROR_02816]);
         } else {
-            // Use SPIRV-Tools validator to try and catch any issues with the module itself
-            spv_context ctx = spvContextCreate(SPV_ENV_VULKAN_1_0);
-            spv_const_binary_t binary{ pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t) };
-            spv_diagnostic diag = nullptr;
-
-            spv_valid = spvValidate(ctx, &binary, &diag);
-            if (spv_valid != SPV_SUCCESS) {
-                if (!dev_data->device_extensions.nv_glsl_shader || (pCreateInfo->pCode[0] == spv::MagicNumber)) {
-                    skip |= log_msg(dev_data->report_data,
-                        spv_valid == SPV_WARNING ? VK_DEBUG_REPORT_WARNING_BIT_EXT : VK_DEBUG_REPORT_ERROR_BIT_EXT,
-                        VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__, SHADER_CHECKER_INCONSISTENT_SPIRV, "SC",
-                        "SPIR-V module not valid: %s", diag && diag->error ? diag->error : "(no error text)");
+            word_count = pCreateInfo->codeSize / sizeof(uint32_t);
+            code_hash = shader_validation_cache::hash(pCreateInfo->pCode, word_count);
+            std::unique_lock<rw_lock> lock(global_lock);
+            auto lookup = dev_data->shader_cache->find(code_hash, pCreateInfo->pCode, word_count, &cached_module);
+            lock.unlock();
+            // The cache file lives outside the layer, so a module it vouches for must still be safe to parse
+            cache_hit = lookup == shader_validation_cache::validated ||
+                        (lookup == shader_validation_cache::saved && spirv_is_parseable(pCreateInfo->pCode, word_count));
+
+            if (!cache_hit) {
+                // Use SPIRV-Tools validator to try and catch any issues with the module itself
+                spv_const_binary_t binary{pCreateInfo->pCode, word_count};
+                spv_diagnostic diag = nullptr;
+
+                spv_valid = spvValidate(dev_data->spirv_context, &binary, &diag);
+                if (spv_valid != SPV_SUCCESS) {
+                    if (!dev_data->device_extensions.nv_glsl_shader || (pCreateInfo->pCode[0] == spv::MagicNumber)) {
+                        skip |= log_msg(dev_data->report_data,
+                                        spv_valid == SPV_WARNING ? VK_DEBUG_REPORT_WARNING_BIT_EXT : VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                        VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__, SHADER_CHECKER_INCONSISTENT_SPIRV,
+                                        "SC", "SPIR-V module not valid: %s", diag && diag->error ? diag->error : "(no error text)");
+                    }
                 }
-            }
 
-            spvDiagnosticDestroy(diag);
-            spvContextDestroy(ctx);
+                spvDiagnosticDestroy(diag);
+            }
         }
 
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -8875,9 +9395,18 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShade
     VkResult res = dev_data->dispatch_table.CreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
 
     if (res == VK_SUCCESS && !GetDisables(dev_data)->shader_validation) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        const auto new_shader_module = (SPV_SUCCESS == spv_valid ? new shader_module(pCreateInfo) : new shader_module());
-        dev_data->shaderModuleMap[*pShaderModule] = unique_ptr<shader_module>(new_shader_module);
+        std::lock_guard<rw_lock> lock(global_lock);
+        std::shared_ptr<shader_module> new_shader_module;
+        if (cached_module) {
+            new_shader_module = cached_module;
+        } else if (SPV_SUCCESS == spv_valid) {
+            new_shader_module = std::make_shared<shader_module>(pCreateInfo);
+            // Modules accepted through the codeSize % 4 GLSL path never reach the validator, so leave them out of the cache
+            if (word_count) dev_data->shader_cache->insert(code_hash, new_shader_module);
+        } else {
+            new_shader_module = std::make_shared<shader_module>();
+        }
+        dev_data->shaderModuleMap[*pShaderModule] = new_shader_module;
     }
     return res;
 }
@@ -9036,7 +9565,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(VkDevice device, const VkRenderP
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     // TODO: As part of wrapping up the mem_tracker/core_validation merge the following routine should be consolidated with
     //       ValidateLayouts.
     skip |= ValidateRenderpassAttachmentUsage(dev_data, pCreateInfo);
@@ -9143,7 +9672,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, con
                                               VkSubpassContents contents) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     GLOBAL_CB_NODE *cb_node = GetCBNode(dev_data, commandBuffer);
     auto render_pass_state = pRenderPassBegin ? GetRenderPassState(dev_data, pRenderPassBegin->renderPass) : nullptr;
     auto framebuffer = pRenderPassBegin ? GetFramebufferState(dev_data, pRenderPassBegin->framebuffer) : nullptr;
@@ -9157,32 +9686,16 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, con
                 if (FormatSpecificLoadAndStoreOpSettings(pAttachment->format, pAttachment->loadOp, pAttachment->stencilLoadOp,
                                                          VK_ATTACHMENT_LOAD_OP_CLEAR)) {
                     clear_op_size = static_cast<uint32_t>(i) + 1;
-                    std::function<bool()> function = [=]() {
-                        SetImageMemoryValid(dev_data, GetImageState(dev_data, fb_info.image), true);
-                        return false;
-                    };
-                    cb_node->validate_functions.push_back(function);
+                    cb_node->deferred_checks->SetAttachmentMemoryValid(fb_info.image, true);
                 } else if (FormatSpecificLoadAndStoreOpSettings(pAttachment->format, pAttachment->loadOp,
                                                                 pAttachment->stencilLoadOp, VK_ATTACHMENT_LOAD_OP_DONT_CARE)) {
-                    std::function<bool()> function = [=]() {
-                        SetImageMemoryValid(dev_data, GetImageState(dev_data, fb_info.image), false);
-                        return false;
-                    };
-                    cb_node->validate_functions.push_back(function);
+                    cb_node->deferred_checks->SetAttachmentMemoryValid(fb_info.image, false);
                 } else if (FormatSpecificLoadAndStoreOpSettings(pAttachment->format, pAttachment->loadOp,
                                                                 pAttachment->stencilLoadOp, VK_ATTACHMENT_LOAD_OP_LOAD)) {
-                    std::function<bool()> function = [=]() {
-                        return ValidateImageMemoryIsValid(dev_data, GetImageState(dev_data, fb_info.image),
-                                                          "vkCmdBeginRenderPass()");
-                    };
-                    cb_node->validate_functions.push_back(function);
+                    cb_node->deferred_checks->ValidateAttachmentMemory(fb_info.image, "vkCmdBeginRenderPass()");
                 }
                 if (render_pass_state->attachment_first_read[i]) {
-                    std::function<bool()> function = [=]() {
-                        return ValidateImageMemoryIsValid(dev_data, GetImageState(dev_data, fb_info.image),
-                                                          "vkCmdBeginRenderPass()");
-                    };
-                    cb_node->validate_functions.push_back(function);
+                    cb_node->deferred_checks->ValidateAttachmentMemory(fb_info.image, "vkCmdBeginRenderPass()");
                 }
             }
             if (clear_op_size > pRenderPassBegin->clearValueCount) {
@@ -9240,7 +9753,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, con
 VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= validatePrimaryCommandBuffer(dev_data, pCB, "vkCmdNextSubpass()", VALIDATION_ERROR_00459);
@@ -9275,7 +9788,7 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpa
 VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto pCB = GetCBNode(dev_data, commandBuffer);
     FRAMEBUFFER_STATE *framebuffer = NULL;
     if (pCB) {
@@ -9294,18 +9807,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
                 auto pAttachment = &rp_state->createInfo.pAttachments[i];
                 if (FormatSpecificLoadAndStoreOpSettings(pAttachment->format, pAttachment->storeOp, pAttachment->stencilStoreOp,
                                                          VK_ATTACHMENT_STORE_OP_STORE)) {
-                    std::function<bool()> function = [=]() {
-                        SetImageMemoryValid(dev_data, GetImageState(dev_data, fb_info.image), true);
-                        return false;
-                    };
-                    pCB->validate_functions.push_back(function);
+                    pCB->deferred_checks->SetAttachmentMemoryValid(fb_info.image, true);
                 } else if (FormatSpecificLoadAndStoreOpSettings(pAttachment->format, pAttachment->storeOp,
                                                                 pAttachment->stencilStoreOp, VK_ATTACHMENT_STORE_OP_DONT_CARE)) {
-                    std::function<bool()> function = [=]() {
-                        SetImageMemoryValid(dev_data, GetImageState(dev_data, fb_info.image), false);
-                        return false;
-                    };
-                    pCB->validate_functions.push_back(function);
+                    pCB->deferred_checks->SetAttachmentMemoryValid(fb_info.image, false);
                 }
             }
         }
@@ -9550,7 +10055,7 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer commandBuffer, uin
                                               const VkCommandBuffer *pCommandBuffers) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         GLOBAL_CB_NODE *pSubCB = NULL;
@@ -9635,15 +10140,18 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer commandBuffer, uin
                             pCommandBuffers[i], validation_error_map[VALIDATION_ERROR_02062]);
             }
             // Propagate layout transitions to the primary cmd buffer
-            for (auto ilm_entry : pSubCB->imageLayoutMap) {
-                SetLayout(dev_data, pCB, ilm_entry.first, ilm_entry.second);
+            for (const auto &ilm_entry : pSubCB->imageLayoutMap) {
+                auto &layouts = pCB->imageLayoutMap[ilm_entry.first];
+                ilm_entry.second.ForEachRun([&layouts](VkImageAspectFlags aspect, uint32_t level, uint32_t first_layer,
+                                                       uint32_t layer_count, const IMAGE_CMD_BUF_LAYOUT_NODE &node) {
+                    layouts.Set(aspect, level, first_layer, layer_count, node);
+                });
+                pCB->image_layout_generation++;
             }
             pSubCB->primaryCommandBuffer = pCB->commandBuffer;
             pCB->secondaryCommandBuffers.insert(pSubCB->commandBuffer);
             dev_data->globalInFlightCmdBuffers.insert(pSubCB->commandBuffer);
-            for (auto &function : pSubCB->queryUpdates) {
-                pCB->queryUpdates.push_back(function);
-            }
+            pCB->deferred_checks->ExecuteCommands(pSubCB->commandBuffer, pSubCB->deferred_checks);
         }
         skip |= validatePrimaryCommandBuffer(dev_data, pCB, "vkCmdExecuteCommands()", VALIDATION_ERROR_00163);
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdExecuteCommands()",
@@ -9661,7 +10169,7 @@ VKAPI_ATTR VkResult VKAPI_CALL MapMemory(VkDevice device, VkDeviceMemory mem, Vk
 
     bool skip = false;
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     DEVICE_MEM_INFO *mem_info = GetMemObjInfo(dev_data, mem);
     if (mem_info) {
         // TODO : This could me more fine-grained to track just region that is valid
@@ -9698,7 +10206,7 @@ VKAPI_ATTR void VKAPI_CALL UnmapMemory(VkDevice device, VkDeviceMemory mem) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     skip |= deleteMemRanges(dev_data, mem);
     lock.unlock();
     if (!skip) {
@@ -9744,6 +10252,23 @@ static bool validateMemoryIsMapped(layer_data *dev_data, const char *funcName, u
     return skip;
 }
 
+// Clip a flushed/invalidated range to the currently mapped range of mem_info, returning it relative to the start of the mapping.
+// Returns false if the two don't overlap.
+static bool GetMappedSubrange(const DEVICE_MEM_INFO *mem_info, const VkMappedMemoryRange &mem_range, VkDeviceSize *offset,
+                              VkDeviceSize *size) {
+    const VkDeviceSize map_start = mem_info->mem_range.offset;
+    const VkDeviceSize map_end = (mem_info->mem_range.size == VK_WHOLE_SIZE) ? mem_info->alloc_info.allocationSize
+                                                                             : (map_start + mem_info->mem_range.size);
+    const VkDeviceSize range_start = std::max(mem_range.offset, map_start);
+    const VkDeviceSize range_end =
+        (mem_range.size == VK_WHOLE_SIZE) ? map_end : std::min(mem_range.offset + mem_range.size, map_end);
+    if (range_end <= range_start) return false;
+    *offset = range_start - map_start;
+    *size = range_end - range_start;
+    return true;
+}
+
+// Check the guard bands around the shadow copy, then copy only the flushed part of the mapping through to the driver
 static bool ValidateAndCopyNoncoherentMemoryToDriver(layer_data *dev_data, uint32_t mem_range_count,
                                                      const VkMappedMemoryRange *mem_ranges) {
     bool skip = false;
@@ -9771,22 +10296,27 @@ static bool ValidateAndCopyNoncoherentMemoryToDriver(layer_data *dev_data, uint3
                                         (uint64_t)mem_ranges[i].memory);
                     }
                 }
-                memcpy(mem_info->p_driver_data, static_cast<void *>(data + mem_info->shadow_pad_size), (size_t)(size));
+                VkDeviceSize flush_offset, flush_size;
+                if (GetMappedSubrange(mem_info, mem_ranges[i], &flush_offset, &flush_size)) {
+                    memcpy(static_cast<char *>(mem_info->p_driver_data) + flush_offset,
+                           data + mem_info->shadow_pad_size + flush_offset, static_cast<size_t>(flush_size));
+                }
             }
         }
     }
     return skip;
 }
 
+// Refresh only the invalidated part of the shadow copy from the driver's mapping
 static void CopyNoncoherentMemoryFromDriver(layer_data *dev_data, uint32_t mem_range_count, const VkMappedMemoryRange *mem_ranges) {
     for (uint32_t i = 0; i < mem_range_count; ++i) {
         auto mem_info = GetMemObjInfo(dev_data, mem_ranges[i].memory);
-        if (mem_info && mem_info->shadow_copy) {
-            VkDeviceSize size = (mem_info->mem_range.size != VK_WHOLE_SIZE)
-                                    ? mem_info->mem_range.size
-                                    : (mem_info->alloc_info.allocationSize - mem_ranges[i].offset);
+        VkDeviceSize invalidate_offset, invalidate_size;
+        if (mem_info && mem_info->shadow_copy &&
+            GetMappedSubrange(mem_info, mem_ranges[i], &invalidate_offset, &invalidate_size)) {
             char *data = static_cast<char *>(mem_info->shadow_copy);
-            memcpy(data + mem_info->shadow_pad_size, mem_info->p_driver_data, (size_t)(size));
+            memcpy(data + mem_info->shadow_pad_size + invalidate_offset,
+                   static_cast<char *>(mem_info->p_driver_data) + invalidate_offset, static_cast<size_t>(invalidate_size));
         }
     }
 }
@@ -9817,7 +10347,7 @@ static bool ValidateMappedMemoryRangeDeviceLimits(layer_data *dev_data, const ch
 static bool PreCallValidateFlushMappedMemoryRanges(layer_data *dev_data, uint32_t mem_range_count,
                                                    const VkMappedMemoryRange *mem_ranges) {
     bool skip = false;
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(global_lock);
     skip |= ValidateAndCopyNoncoherentMemoryToDriver(dev_data, mem_range_count, mem_ranges);
     skip |= validateMemoryIsMapped(dev_data, "vkFlushMappedMemoryRanges", mem_range_count, mem_ranges);
     return skip;
@@ -9837,14 +10367,14 @@ VKAPI_ATTR VkResult VKAPI_CALL FlushMappedMemoryRanges(VkDevice device, uint32_t
 static bool PreCallValidateInvalidateMappedMemoryRanges(layer_data *dev_data, uint32_t mem_range_count,
                                                         const VkMappedMemoryRange *mem_ranges) {
     bool skip = false;
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(global_lock);
     skip |= validateMemoryIsMapped(dev_data, "vkInvalidateMappedMemoryRanges", mem_range_count, mem_ranges);
     return skip;
 }
 
 static void PostCallRecordInvalidateMappedMemoryRanges(layer_data *dev_data, uint32_t mem_range_count,
                                                        const VkMappedMemoryRange *mem_ranges) {
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(global_lock);
     // Update our shadow copy with modified driver data
     CopyNoncoherentMemoryFromDriver(dev_data, mem_range_count, mem_ranges);
 }
@@ -9867,7 +10397,7 @@ static bool PreCallValidateBindImageMemory(layer_data *dev_data, VkImage image,
                                            VkDeviceSize memoryOffset) {
     bool skip = false;
     if (image_state) {
-        std::unique_lock<std::mutex> lock(global_lock);
+        std::unique_lock<rw_lock> lock(global_lock);
         // Track objects tied to memory
         uint64_t image_handle = reinterpret_cast<uint64_t &>(image);
         skip = ValidateSetMemBinding(dev_data, mem, image_handle, kVulkanObjectTypeImage, "vkBindImageMemory()");
@@ -9924,7 +10454,7 @@ static bool PreCallValidateBindImageMemory(layer_data *dev_data, VkImage image,
 static void PostCallRecordBindImageMemory(layer_data *dev_data, VkImage image, IMAGE_STATE *image_state, VkDeviceMemory mem,
                                           VkDeviceSize memoryOffset) {
     if (image_state) {
-        std::unique_lock<std::mutex> lock(global_lock);
+        std::unique_lock<rw_lock> lock(global_lock);
         // Track bound memory range information
         auto mem_info = GetMemObjInfo(dev_data, mem);
         if (mem_info) {
@@ -9960,7 +10490,7 @@ VKAPI_ATTR VkResult VKAPI_CALL SetEvent(VkDevice device, VkEvent event) {
     bool skip = false;
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto event_state = GetEventNode(dev_data, event);
     if (event_state) {
         event_state->needsSignaled = false;
@@ -9991,7 +10521,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(VkQueue queue, uint32_t bindInfoC
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
     bool skip = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto pFence = GetFenceNode(dev_data, fence);
     auto pQueue = GetQueueState(dev_data, queue);
 
@@ -10076,6 +10606,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(VkQueue queue, uint32_t bindInfoC
 
         pQueue->submissions.emplace_back(std::vector<VkCommandBuffer>(), semaphore_waits, semaphore_signals,
                                          bindIdx == bindInfoCount - 1 ? fence : VK_NULL_HANDLE);
+        IndexSubmissionForVerify(pQueue);
     }
 
     if (pFence && !bindInfoCount) {
@@ -10096,7 +10627,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(VkDevice device, const VkSemaphor
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->dispatch_table.CreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     if (result == VK_SUCCESS) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         SEMAPHORE_NODE *sNode = &dev_data->semaphoreMap[*pSemaphore];
         sNode->signaler.first = VK_NULL_HANDLE;
         sNode->signaler.second = 0;
@@ -10110,7 +10641,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(VkDevice device, const VkEventCreateI
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->dispatch_table.CreateEvent(device, pCreateInfo, pAllocator, pEvent);
     if (result == VK_SUCCESS) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         dev_data->eventMap[*pEvent].needsSignaled = false;
         dev_data->eventMap[*pEvent].write_in_use = 0;
         dev_data->eventMap[*pEvent].stageMask = VkPipelineStageFlags(0);
@@ -10350,7 +10881,7 @@ static void PostCallRecordCreateSwapchainKHR(layer_data *dev_data, VkResult resu
                                              VkSwapchainKHR *pSwapchain, SURFACE_STATE *surface_state,
                                              SWAPCHAIN_NODE *old_swapchain_state) {
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         auto swapchain_state = unique_ptr<SWAPCHAIN_NODE>(new SWAPCHAIN_NODE(pCreateInfo, *pSwapchain));
         surface_state->swapchain = swapchain_state.get();
         dev_data->swapchainMap[*pSwapchain] = std::move(swapchain_state);
@@ -10386,21 +10917,12 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(VkDevice device, VkSwapchainKHR s
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto swapchain_data = GetSwapchainNode(dev_data, swapchain);
     if (swapchain_data) {
         if (swapchain_data->images.size() > 0) {
             for (auto swapchain_image : swapchain_data->images) {
-                auto image_sub = dev_data->imageSubresourceMap.find(swapchain_image);
-                if (image_sub != dev_data->imageSubresourceMap.end()) {
-                    for (auto imgsubpair : image_sub->second) {
-                        auto image_item = dev_data->imageLayoutMap.find(imgsubpair);
-                        if (image_item != dev_data->imageLayoutMap.end()) {
-                            dev_data->imageLayoutMap.erase(image_item);
-                        }
-                    }
-                    dev_data->imageSubresourceMap.erase(image_sub);
-                }
+                dev_data->imageLayoutMap.erase(swapchain_image);
                 skip = ClearMemoryObjectBindings(dev_data, (uint64_t)swapchain_image, kVulkanObjectTypeSwapchainKHR);
                 dev_data->imageMap.erase(swapchain_image);
             }
@@ -10426,7 +10948,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkSwapchai
     if (result == VK_SUCCESS && pSwapchainImages != NULL) {
         // This should never happen and is checked by param checker.
         if (!pCount) return result;
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         const size_t count = *pCount;
         auto swapchain_node = GetSwapchainNode(dev_data, swapchain);
         if (swapchain_node && !swapchain_node->images.empty()) {
@@ -10465,9 +10987,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkSwapchai
             image_state->valid = false;
             image_state->binding.mem = MEMTRACKER_SWAP_CHAIN_IMAGE_KEY;
             swapchain_node->images.push_back(pSwapchainImages[i]);
-            ImageSubresourcePair subpair = {pSwapchainImages[i], false, VkImageSubresource()};
-            dev_data->imageSubresourceMap[pSwapchainImages[i]].push_back(subpair);
-            dev_data->imageLayoutMap[subpair] = image_layout_node;
+            dev_data->imageLayoutMap[pSwapchainImages[i]].SetWholeImage(image_layout_node);
             dev_data->imageToSwapchainMap[pSwapchainImages[i]] = swapchain;
         }
     }
@@ -10478,7 +10998,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
 
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(global_lock);
     auto queue_state = GetQueueState(dev_data, queue);
 
     for (uint32_t i = 0; i < pPresentInfo->waitSemaphoreCount; ++i) {
@@ -10667,7 +11187,7 @@ static bool PreCallValidateCreateSharedSwapchainsKHR(layer_data *dev_data, uint3
                                                      std::vector<SURFACE_STATE *> &surface_state,
                                                      std::vector<SWAPCHAIN_NODE *> &old_swapchain_state) {
     if (pCreateInfos) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         for (uint32_t i = 0; i < swapchainCount; i++) {
             surface_state.push_back(GetSurfaceState(dev_data->instance_data, pCreateInfos[i].surface));
             old_swapchain_state.push_back(GetSwapchainNode(dev_data, pCreateInfos[i].oldSwapchain));
@@ -10733,7 +11253,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(VkDevice device, VkSwapchainK
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 
     if (fence == VK_NULL_HANDLE && semaphore == VK_NULL_HANDLE) {
         skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT,
@@ -10953,7 +11473,7 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevi
     instance_layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), instance_layer_data_map);
     auto physical_device_state = GetPhysicalDeviceState(instance_data, physicalDevice);
     assert(physical_device_state);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 
     bool skip = PreCallValidateGetPhysicalDeviceQueueFamilyProperties(instance_data, physical_device_state,
                                                                       pQueueFamilyPropertyCount, pQueueFamilyProperties);
@@ -10975,7 +11495,7 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties2KHR(VkPhysical
     instance_layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), instance_layer_data_map);
     auto physical_device_state = GetPhysicalDeviceState(instance_data, physicalDevice);
     assert(physical_device_state);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
 
     bool skip = PreCallValidateGetPhysicalDeviceQueueFamilyProperties2KHR(instance_data, physical_device_state,
                                                                           pQueueFamilyPropertyCount, pQueueFamilyProperties);
@@ -11001,7 +11521,7 @@ static VkResult CreateSurface(VkInstance instance, TCreateInfo const *pCreateInf
     VkResult result = (instance_data->dispatch_table.*fptr)(instance, pCreateInfo, pAllocator, pSurface);
 
     if (result == VK_SUCCESS) {
-        std::unique_lock<std::mutex> lock(global_lock);
+        std::unique_lock<rw_lock> lock(global_lock);
         instance_data->surface_map[*pSurface] = SURFACE_STATE(*pSurface);
         lock.unlock();
     }
@@ -11012,7 +11532,7 @@ static VkResult CreateSurface(VkInstance instance, TCreateInfo const *pCreateInf
 VKAPI_ATTR void VKAPI_CALL DestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks *pAllocator) {
     bool skip = false;
     instance_layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(instance), instance_layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto surface_state = GetSurfaceState(instance_data, surface);
 
     if (surface_state) {
@@ -11050,7 +11570,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceMirPresentationSupportKHR(VkPhys
     bool skip = false;
     instance_layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), instance_layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     const auto pd_state = GetPhysicalDeviceState(instance_data, physicalDevice);
 
     skip |= ValidatePhysicalDeviceQueueFamily(instance_data, pd_state, queueFamilyIndex, VALIDATION_ERROR_01893,
@@ -11080,7 +11600,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWaylandPresentationSupportKHR(Vk
     bool skip = false;
     instance_layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), instance_layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     const auto pd_state = GetPhysicalDeviceState(instance_data, physicalDevice);
 
     skip |= ValidatePhysicalDeviceQueueFamily(instance_data, pd_state, queueFamilyIndex, VALIDATION_ERROR_01896,
@@ -11109,7 +11629,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWin32PresentationSupportKHR(VkPh
     bool skip = false;
     instance_layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), instance_layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     const auto pd_state = GetPhysicalDeviceState(instance_data, physicalDevice);
 
     skip |= ValidatePhysicalDeviceQueueFamily(instance_data, pd_state, queueFamilyIndex, VALIDATION_ERROR_01899,
@@ -11138,7 +11658,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXcbPresentationSupportKHR(VkPhys
     bool skip = false;
     instance_layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), instance_layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     const auto pd_state = GetPhysicalDeviceState(instance_data, physicalDevice);
 
     skip |= ValidatePhysicalDeviceQueueFamily(instance_data, pd_state, queueFamilyIndex, VALIDATION_ERROR_01901,
@@ -11168,7 +11688,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXlibPresentationSupportKHR(VkPhy
     bool skip = false;
     instance_layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), instance_layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     const auto pd_state = GetPhysicalDeviceState(instance_data, physicalDevice);
 
     skip |= ValidatePhysicalDeviceQueueFamily(instance_data, pd_state, queueFamilyIndex, VALIDATION_ERROR_01904,
@@ -11190,7 +11710,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysica
                                                                        VkSurfaceCapabilitiesKHR *pSurfaceCapabilities) {
     auto instance_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), instance_layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto physical_device_state = GetPhysicalDeviceState(instance_data, physicalDevice);
     lock.unlock();
 
@@ -11210,7 +11730,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevi
     bool skip = false;
     auto instance_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), instance_layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     const auto pd_state = GetPhysicalDeviceState(instance_data, physicalDevice);
     auto surface_state = GetSurfaceState(instance_data, surface);
 
@@ -11236,7 +11756,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModesKHR(VkPhysica
                                                                        VkPresentModeKHR *pPresentModes) {
     bool skip = false;
     auto instance_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), instance_layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     // TODO: this isn't quite right. available modes may differ by surface AND physical device.
     auto physical_device_state = GetPhysicalDeviceState(instance_data, physicalDevice);
     auto &call_state = physical_device_state->vkGetPhysicalDeviceSurfacePresentModesKHRState;
@@ -11297,7 +11817,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevi
                                                                   VkSurfaceFormatKHR *pSurfaceFormats) {
     bool skip = false;
     auto instance_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), instance_layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     auto physical_device_state = GetPhysicalDeviceState(instance_data, physicalDevice);
     auto &call_state = physical_device_state->vkGetPhysicalDeviceSurfaceFormatsKHRState;
 
@@ -11363,7 +11883,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDebugReportCallbackEXT(VkInstance instance,
     instance_layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(instance), instance_layer_data_map);
     VkResult res = instance_data->dispatch_table.CreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pMsgCallback);
     if (VK_SUCCESS == res) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         res = layer_create_msg_callback(instance_data->report_data, false, pCreateInfo, pAllocator, pMsgCallback);
     }
     return res;
@@ -11373,7 +11893,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDebugReportCallbackEXT(VkInstance instance, Vk
                                                          const VkAllocationCallbacks *pAllocator) {
     instance_layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(instance), instance_layer_data_map);
     instance_data->dispatch_table.DestroyDebugReportCallbackEXT(instance, msgCallback, pAllocator);
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(global_lock);
     layer_destroy_msg_callback(instance_data->report_data, msgCallback, pAllocator);
 }
 
@@ -11477,7 +11997,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplateKHR(VkDevice device
     VkResult result =
         dev_data->dispatch_table.CreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         // Shadow template createInfo for later updates
         safe_VkDescriptorUpdateTemplateCreateInfoKHR *local_create_info =
             new safe_VkDescriptorUpdateTemplateCreateInfoKHR(pCreateInfo);
@@ -11491,7 +12011,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplateKHR(VkDevice device,
                                                               VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate,
                                                               const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     dev_data->desc_template_map.erase(descriptorUpdateTemplate);
     lock.unlock();
     dev_data->dispatch_table.DestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
@@ -11525,25 +12045,25 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer c
     dev_data->dispatch_table.CmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
 }
 
-static PFN_vkVoidFunction intercept_core_instance_command(const char *name);
+static PFN_vkVoidFunction intercept_core_instance_command(VulkanCommand command);
 
-static PFN_vkVoidFunction intercept_core_device_command(const char *name);
+static PFN_vkVoidFunction intercept_core_device_command(VulkanCommand command);
 
-static PFN_vkVoidFunction intercept_device_extension_command(const char *name, VkDevice device);
+static PFN_vkVoidFunction intercept_device_extension_command(VulkanCommand command, VkDevice device);
 
-static PFN_vkVoidFunction intercept_khr_swapchain_command(const char *name, VkDevice dev);
+static PFN_vkVoidFunction intercept_khr_swapchain_command(VulkanCommand command, VkDevice dev);
 
-static PFN_vkVoidFunction intercept_khr_surface_command(const char *name, VkInstance instance);
+static PFN_vkVoidFunction intercept_khr_surface_command(VulkanCommand command, VkInstance instance);
 
-static PFN_vkVoidFunction
-intercept_extension_instance_commands(const char *name, VkInstance instance);
+static PFN_vkVoidFunction intercept_extension_instance_commands(VulkanCommand command, VkInstance instance);
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice dev, const char *funcName) {
     assert(dev);
 
-    PFN_vkVoidFunction proc = intercept_core_device_command(funcName);
-    if (!proc) proc = intercept_device_extension_command(funcName, dev);
-    if (!proc) proc = intercept_khr_swapchain_command(funcName, dev);
+    const VulkanCommand command = LookupVulkanCommand(funcName);
+    PFN_vkVoidFunction proc = intercept_core_device_command(command);
+    if (!proc) proc = intercept_device_extension_command(command, dev);
+    if (!proc) proc = intercept_khr_swapchain_command(command, dev);
     if (proc) return proc;
 
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(dev), layer_data_map);
@@ -11553,10 +12073,11 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice dev, const c
 }
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance, const char *funcName) {
-    PFN_vkVoidFunction proc = intercept_core_instance_command(funcName);
-    if (!proc) proc = intercept_core_device_command(funcName);
-    if (!proc) proc = intercept_khr_swapchain_command(funcName, VK_NULL_HANDLE);
-    if (!proc) proc = intercept_khr_surface_command(funcName, instance);
+    const VulkanCommand command = LookupVulkanCommand(funcName);
+    PFN_vkVoidFunction proc = intercept_core_instance_command(command);
+    if (!proc) proc = intercept_core_device_command(command);
+    if (!proc) proc = intercept_khr_swapchain_command(command, VK_NULL_HANDLE);
+    if (!proc) proc = intercept_khr_surface_command(command, instance);
     if (proc) return proc;
 
     assert(instance);
@@ -11565,7 +12086,7 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance
     proc = debug_report_get_instance_proc_addr(instance_data->report_data, funcName);
     if (proc) return proc;
 
-    proc = intercept_extension_instance_commands(funcName, instance);
+    proc = intercept_extension_instance_commands(command, instance);
     if (proc) return proc;
 
     auto &table = instance_data->dispatch_table;
@@ -11583,7 +12104,7 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance in
     return table.GetPhysicalDeviceProcAddr(instance, funcName);
 }
 
-static PFN_vkVoidFunction intercept_core_instance_command(const char *name) {
+static PFN_vkVoidFunction intercept_core_instance_command(VulkanCommand command) {
     static const struct {
         const char *name;
         PFN_vkVoidFunction proc;
@@ -11602,14 +12123,13 @@ static PFN_vkVoidFunction intercept_core_instance_command(const char *name) {
         {"vkEnumerateDeviceExtensionProperties", reinterpret_cast<PFN_vkVoidFunction>(EnumerateDeviceExtensionProperties)},
     };
 
-    for (size_t i = 0; i < ARRAY_SIZE(core_instance_commands); i++) {
-        if (!strcmp(core_instance_commands[i].name, name)) return core_instance_commands[i].proc;
-    }
+    static const auto core_instance_table = MakeCommandTable(core_instance_commands);
 
-    return nullptr;
+    auto entry = core_instance_table.find(command);
+    return entry ? entry->proc : nullptr;
 }
 
-static PFN_vkVoidFunction intercept_core_device_command(const char *name) {
+static PFN_vkVoidFunction intercept_core_device_command(VulkanCommand command) {
     static const struct {
         const char *name;
         PFN_vkVoidFunction proc;
@@ -11733,42 +12253,39 @@ static PFN_vkVoidFunction intercept_core_device_command(const char *name) {
         {"vkCreateEvent", reinterpret_cast<PFN_vkVoidFunction>(CreateEvent)},
     };
 
-    for (size_t i = 0; i < ARRAY_SIZE(core_device_commands); i++) {
-        if (!strcmp(core_device_commands[i].name, name)) return core_device_commands[i].proc;
-    }
+    static const auto core_device_table = MakeCommandTable(core_device_commands);
 
-    return nullptr;
+    auto entry = core_device_table.find(command);
+    return entry ? entry->proc : nullptr;
 }
 
-static PFN_vkVoidFunction intercept_device_extension_command(const char *name, VkDevice device) {
-    layer_data *device_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-
-    const struct {
+static PFN_vkVoidFunction intercept_device_extension_command(VulkanCommand command, VkDevice device) {
+    using E = DeviceExtensions;
+    static const struct {
         const char *name;
         PFN_vkVoidFunction proc;
-        bool enabled;
+        bool E::*enable;
     } device_extension_commands[] = {
         {"vkCreateDescriptorUpdateTemplateKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateDescriptorUpdateTemplateKHR),
-         device_data->device_extensions.khr_descriptor_update_template},
+         &E::khr_descriptor_update_template},
         {"vkDestroyDescriptorUpdateTemplateKHR", reinterpret_cast<PFN_vkVoidFunction>(DestroyDescriptorUpdateTemplateKHR),
-         device_data->device_extensions.khr_descriptor_update_template},
+         &E::khr_descriptor_update_template},
         {"vkUpdateDescriptorSetWithTemplateKHR", reinterpret_cast<PFN_vkVoidFunction>(UpdateDescriptorSetWithTemplateKHR),
-         device_data->device_extensions.khr_descriptor_update_template},
+         &E::khr_descriptor_update_template},
         {"vkCmdPushDescriptorSetWithTemplateKHR", reinterpret_cast<PFN_vkVoidFunction>(CmdPushDescriptorSetWithTemplateKHR),
-         device_data->device_extensions.khr_descriptor_update_template},
+         &E::khr_descriptor_update_template},
     };
+    static const auto device_extension_table = MakeCommandTable(device_extension_commands);
 
-    if (!device_data) return nullptr;
-
-    for (size_t i = 0; i < ARRAY_SIZE(device_extension_commands); i++) {
-        if (!strcmp(device_extension_commands[i].name, name) && device_extension_commands[i].enabled)
-            return device_extension_commands[i].proc;
-    }
+    auto entry = device_extension_table.find(command);
+    if (!entry) return nullptr;
 
-    return nullptr;
+    layer_data *device_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    if (!device_data || !(device_data->device_extensions.*(entry->enable))) return nullptr;
+    return entry->proc;
 }
 
-static PFN_vkVoidFunction intercept_khr_swapchain_command(const char *name, VkDevice dev) {
+static PFN_vkVoidFunction intercept_khr_swapchain_command(VulkanCommand command, VkDevice dev) {
     static const struct {
         const char *name;
         PFN_vkVoidFunction proc;
@@ -11779,6 +12296,7 @@ static PFN_vkVoidFunction intercept_khr_swapchain_command(const char *name, VkDe
         {"vkAcquireNextImageKHR", reinterpret_cast<PFN_vkVoidFunction>(AcquireNextImageKHR)},
         {"vkQueuePresentKHR", reinterpret_cast<PFN_vkVoidFunction>(QueuePresentKHR)},
     };
+    static const auto khr_swapchain_table = MakeCommandTable(khr_swapchain_commands);
     layer_data *dev_data = nullptr;
 
     if (dev) {
@@ -11786,20 +12304,19 @@ static PFN_vkVoidFunction intercept_khr_swapchain_command(const char *name, VkDe
         if (!dev_data->device_extensions.khr_swapchain) return nullptr;
     }
 
-    for (size_t i = 0; i < ARRAY_SIZE(khr_swapchain_commands); i++) {
-        if (!strcmp(khr_swapchain_commands[i].name, name)) return khr_swapchain_commands[i].proc;
-    }
+    auto entry = khr_swapchain_table.find(command);
+    if (entry) return entry->proc;
 
     if (dev_data) {
         if (!dev_data->device_extensions.khr_display_swapchain) return nullptr;
     }
 
-    if (!strcmp("vkCreateSharedSwapchainsKHR", name)) return reinterpret_cast<PFN_vkVoidFunction>(CreateSharedSwapchainsKHR);
+    if (command == kVulkanCommandCreateSharedSwapchainsKHR) return reinterpret_cast<PFN_vkVoidFunction>(CreateSharedSwapchainsKHR);
 
     return nullptr;
 }
 
-static PFN_vkVoidFunction intercept_khr_surface_command(const char *name, VkInstance instance) {
+static PFN_vkVoidFunction intercept_khr_surface_command(VulkanCommand command, VkInstance instance) {
     using E = InstanceExtensions;
     static const struct {
         const char *name;
@@ -11845,23 +12362,19 @@ static PFN_vkVoidFunction intercept_khr_surface_command(const char *name, VkInst
         {"vkGetPhysicalDeviceSurfaceFormatsKHR", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceSurfaceFormatsKHR),
          &E::khr_surface},
     };
+    static const auto khr_surface_table = MakeCommandTable(khr_surface_commands);
 
-    instance_layer_data *instance_data = nullptr;
-    if (instance) {
-        instance_data = GetLayerDataPtr(get_dispatch_key(instance), instance_layer_data_map);
-    }
+    auto entry = khr_surface_table.find(command);
+    if (!entry) return nullptr;
 
-    for (size_t i = 0; i < ARRAY_SIZE(khr_surface_commands); i++) {
-        if (!strcmp(khr_surface_commands[i].name, name)) {
-            if (instance_data && !(instance_data->extensions.*(khr_surface_commands[i].enable))) return nullptr;
-            return khr_surface_commands[i].proc;
-        }
+    if (instance) {
+        instance_layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(instance), instance_layer_data_map);
+        if (!(instance_data->extensions.*(entry->enable))) return nullptr;
     }
-
-    return nullptr;
+    return entry->proc;
 }
 
-static PFN_vkVoidFunction intercept_extension_instance_commands(const char *name, VkInstance instance) {
+static PFN_vkVoidFunction intercept_extension_instance_commands(VulkanCommand command, VkInstance instance) {
     // TODO: sort this out.
     static const struct {
         const char *name;
@@ -11874,12 +12387,10 @@ static PFN_vkVoidFunction intercept_extension_instance_commands(const char *name
          reinterpret_cast<PFN_vkVoidFunction>(EnumeratePhysicalDeviceGroupsKHX)},
     };
 
-    for (size_t i = 0; i < ARRAY_SIZE(instance_extension_commands); i++) {
-        if (!strcmp(instance_extension_commands[i].name, name)) {
-            return instance_extension_commands[i].proc;
-        }
-    }
-    return nullptr;
+    static const auto instance_extension_table = MakeCommandTable(instance_extension_commands);
+
+    auto entry = instance_extension_table.find(command);
+    return entry ? entry->proc : nullptr;
 }
 
 }  // namespace core_validation
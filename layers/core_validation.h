@@ -133,6 +133,9 @@ class QUEUE_STATE {
 
     uint64_t seq;
     std::deque<CB_SUBMISSION> submissions;
+    // Ascending seqs of pending submissions that wait on another queue or have guarded query resets. These are the only
+    // ones VerifyQueueStateToSeq needs to visit.
+    std::deque<uint64_t> verify_seqs;
 };
 
 class QUERY_POOL_NODE : public BASE_NODE {
@@ -52,9 +52,14 @@
 #include "vk_layer_logging.h"
 #include "vk_object_types.h"
 #include "device_extensions.h"
+#include "vk_layer_node_pool.h"
+#include <algorithm>
 #include <atomic>
+#include <cassert>
 #include <functional>
+#include <iterator>
 #include <map>
+#include <mutex>
 #include <string.h>
 #include <unordered_map>
 #include <unordered_set>
@@ -81,6 +86,20 @@ class BASE_NODE {
     std::unordered_set<GLOBAL_CB_NODE *> cb_bindings;
 
     BASE_NODE() { in_use.store(0); };
+
+    // Add cb_node to cb_bindings. Command buffers referencing the same object may be recorded on different threads at the
+    // same time, so inserts are serialized on a lock picked by object address.
+    void AddBoundCommandBuffer(GLOBAL_CB_NODE *cb_node) {
+        std::lock_guard<std::mutex> lock(BindingLock());
+        cb_bindings.insert(cb_node);
+    }
+
+   private:
+    std::mutex &BindingLock() const {
+        static const size_t kBindingLockCount = 64;
+        static std::mutex binding_locks[kBindingLockCount];
+        return binding_locks[(reinterpret_cast<uintptr_t>(this) >> 4) % kBindingLockCount];
+    }
 };
 
 // Track command pools and their command buffers
@@ -305,6 +324,52 @@ struct MEMORY_RANGE {
     std::unordered_set<MEMORY_RANGE *> aliases;
 };
 
+// Sorted index over the ranges bound to one memory object, so that finding the ranges overlapping a span doesn't visit every
+// binding. Ranges are grouped by the power of two at or below their size and kept sorted by start within each group. A range in
+// group b is shorter than 2^(b+1) bytes, so only those starting less than that far before the span can reach into it, and a
+// query costs one lower_bound per non-empty group plus the ranges walked. Two ranges of group b starting within 2^b bytes of
+// each other must overlap, so unless bindings alias, each group's walk passes at most one range that misses the span.
+class MemoryRangeIndex {
+   public:
+    void insert(MEMORY_RANGE *range) { ranges_[SizeClass(range->size)].emplace(range->start, range); }
+    void erase(MEMORY_RANGE *range) {
+        auto &ranges = ranges_[SizeClass(range->size)];
+        auto matches = ranges.equal_range(range->start);
+        for (auto it = matches.first; it != matches.second; ++it) {
+            if (it->second == range) {
+                ranges.erase(it);
+                return;
+            }
+        }
+    }
+
+    // Call func(range) for every indexed range that overlaps [start, end]
+    template <typename Func>
+    void ForEachOverlapping(VkDeviceSize start, VkDeviceSize end, Func func) const {
+        for (uint32_t size_class = 0; size_class < kSizeClassCount; ++size_class) {
+            const auto &ranges = ranges_[size_class];
+            if (ranges.empty()) continue;
+            const VkDeviceSize max_size =
+                (size_class + 1 < kSizeClassCount) ? (VkDeviceSize(2) << size_class) - 1 : ~VkDeviceSize(0);
+            const VkDeviceSize first_start = (start >= max_size) ? start - max_size + 1 : 0;
+            for (auto it = ranges.lower_bound(first_start); it != ranges.end() && it->first <= end; ++it) {
+                if (it->second->end >= start) func(it->second);
+            }
+        }
+    }
+
+   private:
+    static const uint32_t kSizeClassCount = 64;
+
+    static uint32_t SizeClass(VkDeviceSize size) {
+        uint32_t size_class = 0;
+        while (size >>= 1) ++size_class;
+        return size_class;
+    }
+
+    std::multimap<VkDeviceSize, MEMORY_RANGE *> ranges_[kSizeClassCount];
+};
+
 // Data struct for tracking memory object
 struct DEVICE_MEM_INFO : public BASE_NODE {
     void *object;       // Dispatchable object used to create this memory (device of swapchain)
@@ -313,6 +378,7 @@ struct DEVICE_MEM_INFO : public BASE_NODE {
     VkMemoryAllocateInfo alloc_info;
     std::unordered_set<VK_OBJECT> obj_bindings;               // objects bound to this memory
     std::unordered_map<uint64_t, MEMORY_RANGE> bound_ranges;  // Map of object to its binding range
+    MemoryRangeIndex bound_range_index;                       // The same ranges, for overlap queries
     // Convenience vectors image/buff handles to speed up iterating over images or buffers independently
     std::unordered_set<uint64_t> bound_images;
     std::unordered_set<uint64_t> bound_buffers;
@@ -356,6 +422,174 @@ class IMAGE_CMD_BUF_LAYOUT_NODE {
     VkImageLayout layout;
 };
 
+inline bool operator==(const IMAGE_CMD_BUF_LAYOUT_NODE &a, const IMAGE_CMD_BUF_LAYOUT_NODE &b) {
+    return a.initialLayout == b.initialLayout && a.layout == b.layout;
+}
+
+// Layout nodes for the subresources of one image. Each aspect and mip level holds runs of consecutive array layers sharing a
+// node, with neighbouring runs merged when their nodes are equal, so that a barrier, clear or copy covering many layers costs
+// O(runs) rather than one entry per subresource. Subresources outside every run may fall back to an optional whole-image node.
+// Levels and layers passed in must lie within the image; callers clip ranges taken from the app before using them here.
+template <typename NODE>
+class ImageSubresourceLayouts {
+   public:
+    static const uint32_t kAspectCount = 4;  // Color, depth, stencil and metadata, indexed by bit position
+
+    const NODE *whole_image() const { return has_whole_image_ ? &whole_image_ : nullptr; }
+    void SetWholeImage(const NODE &node) {
+        whole_image_ = node;
+        has_whole_image_ = true;
+    }
+
+    bool empty() const {
+        for (const auto &levels : levels_) {
+            for (const auto &runs : levels) {
+                if (!runs.empty()) return false;
+            }
+        }
+        return true;
+    }
+
+    // Number of subresources covered by runs, counting each aspect separately
+    uint64_t SubresourceCount() const {
+        uint64_t count = 0;
+        ForEachRun([&count](VkImageAspectFlags, uint32_t, uint32_t, uint32_t layer_count, const NODE &) { count += layer_count; });
+        return count;
+    }
+
+    // Calls func(aspect, level, first_layer, layer_count, node) for every run
+    template <typename Func>
+    void ForEachRun(Func func) const {
+        for (uint32_t aspect_index = 0; aspect_index < kAspectCount; ++aspect_index) {
+            const auto &levels = levels_[aspect_index];
+            for (uint32_t level = 0; level < levels.size(); ++level) {
+                for (const auto &run : levels[level]) {
+                    func(VkImageAspectFlags(1) << aspect_index, level, run.first, run.second.end - run.first, run.second.node);
+                }
+            }
+        }
+    }
+
+    // Calls func(first_layer, layer_count, nodes) for consecutive pieces of layers [first_layer, first_layer + layer_count) of
+    // level, split wherever the node of any aspect in aspect_mask changes. nodes[i] is the node of aspect bit i, or null where
+    // that aspect has no run.
+    template <typename Func>
+    void ForEachSegment(VkImageAspectFlags aspect_mask, uint32_t level, uint32_t first_layer, uint32_t layer_count,
+                        Func func) const {
+        const uint32_t end = first_layer + layer_count;
+        const NODE *nodes[kAspectCount] = {};
+        const Runs *runs[kAspectCount] = {};
+        typename Runs::const_iterator next[kAspectCount];
+        for (uint32_t aspect_index = 0; aspect_index < kAspectCount; ++aspect_index) {
+            if (!(aspect_mask & (1u << aspect_index)) || level >= levels_[aspect_index].size()) continue;
+            runs[aspect_index] = &levels_[aspect_index][level];
+            next[aspect_index] = runs[aspect_index]->upper_bound(first_layer);
+            if (next[aspect_index] != runs[aspect_index]->begin()) {
+                auto prev = std::prev(next[aspect_index]);
+                if (prev->second.end > first_layer) next[aspect_index] = prev;
+            }
+        }
+        uint32_t layer = first_layer;
+        while (layer < end) {
+            // Pick up the node covering layer in each aspect, and find where the next change in any of them happens
+            uint32_t segment_end = end;
+            for (uint32_t aspect_index = 0; aspect_index < kAspectCount; ++aspect_index) {
+                if (!runs[aspect_index]) continue;
+                auto &it = next[aspect_index];
+                if (it != runs[aspect_index]->end() && it->second.end <= layer) ++it;
+                nodes[aspect_index] = nullptr;
+                if (it == runs[aspect_index]->end()) continue;
+                if (it->first <= layer) {
+                    nodes[aspect_index] = &it->second.node;
+                    segment_end = std::min(segment_end, it->second.end);
+                } else {
+                    segment_end = std::min(segment_end, it->first);
+                }
+            }
+            func(layer, segment_end - layer, static_cast<const NODE *const *>(nodes));
+            layer = segment_end;
+        }
+    }
+
+    // Sets the node of layers [first_layer, first_layer + layer_count) of one aspect bit and level
+    void Set(VkImageAspectFlags aspect, uint32_t level, uint32_t first_layer, uint32_t layer_count, const NODE &node) {
+        if (!layer_count) return;
+        auto &levels = levels_[AspectIndex(aspect)];
+        if (level >= levels.size()) levels.resize(level + 1);
+        auto &runs = levels[level];
+        uint32_t start = first_layer;
+        uint32_t end = first_layer + layer_count;
+
+        // Trim a run that starts before the new one and overlaps it, keeping any part of it that lies past the new run
+        auto it = runs.lower_bound(start);
+        if (it != runs.begin()) {
+            auto prev = std::prev(it);
+            if (prev->second.end > start) {
+                if (prev->second.end > end) it = runs.emplace_hint(it, end, prev->second);
+                prev->second.end = start;
+            }
+        }
+        // Drop runs starting inside the new one, keeping the part of the last that lies past it
+        while (it != runs.end() && it->first < end) {
+            if (it->second.end > end) {
+                Run rest = it->second;
+                it = runs.erase(it);
+                it = runs.emplace_hint(it, end, rest);
+                break;
+            }
+            it = runs.erase(it);
+        }
+        // Merge with equal neighbours
+        if (it != runs.end() && it->first == end && it->second.node == node) {
+            end = it->second.end;
+            it = runs.erase(it);
+        }
+        if (it != runs.begin()) {
+            auto prev = std::prev(it);
+            if (prev->second.end == start && prev->second.node == node) {
+                prev->second.end = end;
+                return;
+            }
+        }
+        runs.emplace_hint(it, start, Run{end, node});
+    }
+
+    // Sets each piece of layers [first_layer, first_layer + layer_count) of one aspect bit and level that has a single current
+    // node to update(first, count, node), where node is that node or null if the piece has none
+    template <typename Func>
+    void Update(VkImageAspectFlags aspect, uint32_t level, uint32_t first_layer, uint32_t layer_count, Func update) {
+        struct Piece {
+            uint32_t first_layer;
+            uint32_t layer_count;
+            NODE node;
+        };
+        std::vector<Piece> pieces;
+        ForEachSegment(aspect, level, first_layer, layer_count,
+                       [&](uint32_t first, uint32_t count, const NODE *const *nodes) {
+                           pieces.push_back(Piece{first, count, update(first, count, nodes[AspectIndex(aspect)])});
+                       });
+        for (const auto &piece : pieces) Set(aspect, level, piece.first_layer, piece.layer_count, piece.node);
+    }
+
+   private:
+    struct Run {
+        uint32_t end;  // One past the last layer
+        NODE node;
+    };
+    typedef std::map<uint32_t, Run> Runs;  // Keyed by first layer
+
+    static uint32_t AspectIndex(VkImageAspectFlags aspect) {
+        uint32_t aspect_index = 0;
+        while (aspect >>= 1) ++aspect_index;
+        assert(aspect_index < kAspectCount);
+        return aspect_index;
+    }
+
+    std::vector<Runs> levels_[kAspectCount];
+    NODE whole_image_ = {};
+    bool has_whole_image_ = false;
+};
+
 // Store the DAG.
 struct DAGNode {
     uint32_t pass;
@@ -482,35 +716,6 @@ struct DRAW_DATA {
     std::vector<VkBuffer> buffers;
 };
 
-struct ImageSubresourcePair {
-    VkImage image;
-    bool hasSubresource;
-    VkImageSubresource subresource;
-};
-
-inline bool operator==(const ImageSubresourcePair &img1, const ImageSubresourcePair &img2) {
-    if (img1.image != img2.image || img1.hasSubresource != img2.hasSubresource) return false;
-    return !img1.hasSubresource ||
-           (img1.subresource.aspectMask == img2.subresource.aspectMask && img1.subresource.mipLevel == img2.subresource.mipLevel &&
-            img1.subresource.arrayLayer == img2.subresource.arrayLayer);
-}
-
-namespace std {
-template <>
-struct hash<ImageSubresourcePair> {
-    size_t operator()(ImageSubresourcePair img) const throw() {
-        size_t hashVal = hash<uint64_t>()(reinterpret_cast<uint64_t &>(img.image));
-        hashVal ^= hash<bool>()(img.hasSubresource);
-        if (img.hasSubresource) {
-            hashVal ^= hash<uint32_t>()(reinterpret_cast<uint32_t &>(img.subresource.aspectMask));
-            hashVal ^= hash<uint32_t>()(img.subresource.mipLevel);
-            hashVal ^= hash<uint32_t>()(img.subresource.arrayLayer);
-        }
-        return hashVal;
-    }
-};
-}
-
 // Store layouts and pushconstants for PipelineLayout
 struct PIPELINE_LAYOUT_NODE {
     VkPipelineLayout layout;
@@ -599,6 +804,14 @@ class PIPELINE_STATE : public BASE_NODE {
     }
 };
 
+// Snapshot of a bind point taken when the descriptor sets active for its pipeline last passed draw-time validation
+struct VALIDATED_DRAW_STATE {
+    uint64_t bind_generation;                 // LAST_BOUND_STATE::bind_generation at the time, 0 if there is no snapshot
+    uint64_t image_layout_generation;         // GLOBAL_CB_NODE::image_layout_generation at the time
+    std::vector<uint64_t> set_change_counts;  // DescriptorSet::GetChangeCount() of each bound set at the time
+    bool sets_bound;                          // Set once UpdateDrawState has bound these sets to the command buffer
+};
+
 // Track last states that are bound per pipeline bind point (Gfx & Compute)
 struct LAST_BOUND_STATE {
     PIPELINE_STATE *pipeline_state;
@@ -608,16 +821,174 @@ struct LAST_BOUND_STATE {
     std::vector<cvdescriptorset::DescriptorSet *> boundDescriptorSets;
     // one dynamic offset per dynamic descriptor bound to this CB
     std::vector<std::vector<uint32_t>> dynamicOffsets;
+    // Bumped by every vkCmdBindPipeline and vkCmdBindDescriptorSets on this bind point
+    uint64_t bind_generation;
+    // While this still matches the bound state, draws skip descriptor set validation and binding
+    VALIDATED_DRAW_STATE validated;
 
     void reset() {
         pipeline_state = nullptr;
         pipeline_layout.reset();
         boundDescriptorSets.clear();
         dynamicOffsets.clear();
+        bind_generation = 1;
+        validated.bind_generation = 0;
+        validated.image_layout_generation = 0;
+        validated.set_change_counts.clear();
+        validated.sets_bound = false;
     }
 };
+
+// Work that a command buffer records for QueueSubmit to perform: checks that depend on state at submit time, and updates to
+// that state. Named after the function each one is replayed with.
+enum DeferredCheckType {
+    DEFERRED_VALIDATE_IMAGE_MEMORY,        // ValidateImageMemoryIsValid(image_state, function)
+    DEFERRED_VALIDATE_BUFFER_MEMORY,       // ValidateBufferMemoryIsValid(buffer_state, function)
+    DEFERRED_SET_IMAGE_MEMORY_VALID,       // SetImageMemoryValid(image_state, valid)
+    DEFERRED_SET_BUFFER_MEMORY_VALID,      // SetBufferMemoryValid(buffer_state, valid)
+    DEFERRED_VALIDATE_ATTACHMENT_MEMORY,   // ValidateImageMemoryIsValid(GetImageState(image), function)
+    DEFERRED_SET_ATTACHMENT_MEMORY_VALID,  // SetImageMemoryValid(GetImageState(image), valid)
+    DEFERRED_SET_EVENT_STAGE_MASK,         // setEventStageMask(event, stage_mask)
+    DEFERRED_VALIDATE_EVENT_STAGE_MASK,    // validateEventStageMask(count events from index first, stage_mask)
+    DEFERRED_SET_QUERY_STATE,              // setQueryState({query_pool, first}, valid)
+    DEFERRED_VALIDATE_QUERY,               // validateQuery(query_pool, count queries from first)
+    DEFERRED_EXECUTE_COMMANDS,             // Replay the query updates of the secondary command buffer at index first
+};
+
+// One entry in a DeferredCheckQueue. Only the fields named next to its type above are meaningful.
+struct DEFERRED_CHECK {
+    DeferredCheckType type;
+    bool valid;
+    uint32_t first;
+    uint32_t count;
+    VkPipelineStageFlags stage_mask;
+    const char *function;
+    union {
+        IMAGE_STATE *image_state;
+        BUFFER_STATE *buffer_state;
+        VkImage image;
+        VkEvent event;
+        VkQueryPool query_pool;
+    };
+};
+
+// Plain-data stream of the deferred checks recorded into one command buffer, in recording order. Recording a check is an
+// append to a vector that keeps its capacity across resets. vkCmdExecuteCommands shares a secondary command buffer's queue
+// with the primary instead of copying it.
+class DeferredCheckQueue {
+   public:
+    void ValidateImageMemory(IMAGE_STATE *image_state, const char *function) {
+        DEFERRED_CHECK &check = Append(DEFERRED_VALIDATE_IMAGE_MEMORY);
+        check.image_state = image_state;
+        check.function = function;
+    }
+    void ValidateBufferMemory(BUFFER_STATE *buffer_state, const char *function) {
+        DEFERRED_CHECK &check = Append(DEFERRED_VALIDATE_BUFFER_MEMORY);
+        check.buffer_state = buffer_state;
+        check.function = function;
+    }
+    void SetImageMemoryValid(IMAGE_STATE *image_state, bool valid) {
+        DEFERRED_CHECK &check = Append(DEFERRED_SET_IMAGE_MEMORY_VALID);
+        check.image_state = image_state;
+        check.valid = valid;
+    }
+    void SetBufferMemoryValid(BUFFER_STATE *buffer_state, bool valid) {
+        DEFERRED_CHECK &check = Append(DEFERRED_SET_BUFFER_MEMORY_VALID);
+        check.buffer_state = buffer_state;
+        check.valid = valid;
+    }
+    // Framebuffer attachments are recorded by image handle and looked up at submit time
+    void ValidateAttachmentMemory(VkImage image, const char *function) {
+        DEFERRED_CHECK &check = Append(DEFERRED_VALIDATE_ATTACHMENT_MEMORY);
+        check.image = image;
+        check.function = function;
+    }
+    void SetAttachmentMemoryValid(VkImage image, bool valid) {
+        DEFERRED_CHECK &check = Append(DEFERRED_SET_ATTACHMENT_MEMORY_VALID);
+        check.image = image;
+        check.valid = valid;
+    }
+    void SetEventStageMask(VkEvent event, VkPipelineStageFlags stage_mask) {
+        DEFERRED_CHECK &check = Append(DEFERRED_SET_EVENT_STAGE_MASK);
+        check.event = event;
+        check.stage_mask = stage_mask;
+    }
+    // Events are given as a range of GLOBAL_CB_NODE::events
+    void ValidateEventStageMask(uint32_t first_event_index, uint32_t event_count, VkPipelineStageFlags stage_mask) {
+        DEFERRED_CHECK &check = Append(DEFERRED_VALIDATE_EVENT_STAGE_MASK);
+        check.first = first_event_index;
+        check.count = event_count;
+        check.stage_mask = stage_mask;
+    }
+    void SetQueryState(QueryObject query, bool valid) {
+        DEFERRED_CHECK &check = Append(DEFERRED_SET_QUERY_STATE);
+        check.query_pool = query.pool;
+        check.first = query.index;
+        check.valid = valid;
+    }
+    void ValidateQuery(VkQueryPool query_pool, uint32_t first_query, uint32_t query_count) {
+        DEFERRED_CHECK &check = Append(DEFERRED_VALIDATE_QUERY);
+        check.query_pool = query_pool;
+        check.first = first_query;
+        check.count = query_count;
+    }
+    void ExecuteCommands(VkCommandBuffer secondary, std::shared_ptr<const DeferredCheckQueue> secondary_checks) {
+        DEFERRED_CHECK &check = Append(DEFERRED_EXECUTE_COMMANDS);
+        check.first = static_cast<uint32_t>(secondaries_.size());
+        secondaries_.emplace_back(secondary, std::move(secondary_checks));
+    }
+
+    void clear() {
+        checks_.clear();
+        secondaries_.clear();
+    }
+
+    const std::vector<DEFERRED_CHECK> &checks() const { return checks_; }
+    const std::pair<VkCommandBuffer, std::shared_ptr<const DeferredCheckQueue>> &secondary(uint32_t index) const {
+        return secondaries_[index];
+    }
+
+   private:
+    DEFERRED_CHECK &Append(DeferredCheckType type) {
+        checks_.emplace_back();  // Value-initialized, so every field starts out zeroed
+        DEFERRED_CHECK &check = checks_.back();
+        check.type = type;
+        return check;
+    }
+
+    std::vector<DEFERRED_CHECK> checks_;
+    std::vector<std::pair<VkCommandBuffer, std::shared_ptr<const DeferredCheckQueue>>> secondaries_;
+};
+
+// Hash containers for per-command-buffer tracking. Their nodes come from the command buffer's NodePool, so resetting and
+// re-recording a command buffer refills the same memory instead of freeing and reallocating every element.
+template <typename Key>
+using cb_unordered_set = std::unordered_set<Key, std::hash<Key>, std::equal_to<Key>, NodePoolAllocator<Key>>;
+template <typename Key, typename T>
+using cb_unordered_map =
+    std::unordered_map<Key, T, std::hash<Key>, std::equal_to<Key>, NodePoolAllocator<std::pair<const Key, T>>>;
+
 // Cmd Buffer Wrapper Struct - TODO : This desperately needs its own class
 struct GLOBAL_CB_NODE : public BASE_NODE {
+    GLOBAL_CB_NODE()
+        : framebuffers(NodePoolAllocator<VkFramebuffer>(&node_pool)),
+          object_bindings(NodePoolAllocator<VK_OBJECT>(&node_pool)),
+          waitedEvents(NodePoolAllocator<VkEvent>(&node_pool)),
+          waitedEventsBeforeQueryReset(NodePoolAllocator<std::pair<const QueryObject, std::unordered_set<VkEvent>>>(&node_pool)),
+          queryToStateMap(NodePoolAllocator<std::pair<const QueryObject, bool>>(&node_pool)),
+          activeQueries(NodePoolAllocator<QueryObject>(&node_pool)),
+          startedQueries(NodePoolAllocator<QueryObject>(&node_pool)),
+          imageLayoutMap(
+              NodePoolAllocator<std::pair<const VkImage, ImageSubresourceLayouts<IMAGE_CMD_BUF_LAYOUT_NODE>>>(&node_pool)),
+          eventToStageMap(NodePoolAllocator<std::pair<const VkEvent, VkPipelineStageFlags>>(&node_pool)),
+          updateImages(NodePoolAllocator<VkImageView>(&node_pool)),
+          updateBuffers(NodePoolAllocator<VkBuffer>(&node_pool)),
+          secondaryCommandBuffers(NodePoolAllocator<VkCommandBuffer>(&node_pool)),
+          memObjs(NodePoolAllocator<VkDeviceMemory>(&node_pool)),
+          deferred_checks(std::make_shared<DeferredCheckQueue>()) {}
+
+    // Backs the hash containers below; declared first so that it is destroyed after them
+    NodePool node_pool;
     VkCommandBuffer commandBuffer;
     VkCommandBufferAllocateInfo createInfo;
     VkCommandBufferBeginInfo beginInfo;
@@ -641,36 +1012,36 @@ struct GLOBAL_CB_NODE : public BASE_NODE {
     VkSubpassContents activeSubpassContents;
     uint32_t activeSubpass;
     VkFramebuffer activeFramebuffer;
-    std::unordered_set<VkFramebuffer> framebuffers;
+    cb_unordered_set<VkFramebuffer> framebuffers;
     // Unified data structs to track objects bound to this command buffer as well as object
     //  dependencies that have been broken : either destroyed objects, or updated descriptor sets
-    std::unordered_set<VK_OBJECT> object_bindings;
+    cb_unordered_set<VK_OBJECT> object_bindings;
     std::vector<VK_OBJECT> broken_bindings;
 
-    std::unordered_set<VkEvent> waitedEvents;
+    cb_unordered_set<VkEvent> waitedEvents;
     std::vector<VkEvent> writeEventsBeforeWait;
     std::vector<VkEvent> events;
-    std::unordered_map<QueryObject, std::unordered_set<VkEvent>> waitedEventsBeforeQueryReset;
-    std::unordered_map<QueryObject, bool> queryToStateMap;  // 0 is unavailable, 1 is available
-    std::unordered_set<QueryObject> activeQueries;
-    std::unordered_set<QueryObject> startedQueries;
-    std::unordered_map<ImageSubresourcePair, IMAGE_CMD_BUF_LAYOUT_NODE> imageLayoutMap;
-    std::unordered_map<VkEvent, VkPipelineStageFlags> eventToStageMap;
+    cb_unordered_map<QueryObject, std::unordered_set<VkEvent>> waitedEventsBeforeQueryReset;
+    cb_unordered_map<QueryObject, bool> queryToStateMap;  // 0 is unavailable, 1 is available
+    cb_unordered_set<QueryObject> activeQueries;
+    cb_unordered_set<QueryObject> startedQueries;
+    cb_unordered_map<VkImage, ImageSubresourceLayouts<IMAGE_CMD_BUF_LAYOUT_NODE>> imageLayoutMap;
+    uint64_t image_layout_generation;  // Bumped whenever imageLayoutMap changes
+    cb_unordered_map<VkEvent, VkPipelineStageFlags> eventToStageMap;
     std::vector<DRAW_DATA> drawData;
     DRAW_DATA currentDrawData;
     bool vertex_buffer_used;  // Track for perf warning to make sure any bound vtx buffer used
     VkCommandBuffer primaryCommandBuffer;
     // Track images and buffers that are updated by this CB at the point of a draw
-    std::unordered_set<VkImageView> updateImages;
-    std::unordered_set<VkBuffer> updateBuffers;
+    cb_unordered_set<VkImageView> updateImages;
+    cb_unordered_set<VkBuffer> updateBuffers;
     // If cmd buffer is primary, track secondary command buffers pending
     // execution
-    std::unordered_set<VkCommandBuffer> secondaryCommandBuffers;
+    cb_unordered_set<VkCommandBuffer> secondaryCommandBuffers;
     // MTMTODO : Scrub these data fields and merge active sets w/ lastBound as appropriate
-    std::vector<std::function<bool()>> validate_functions;
-    std::unordered_set<VkDeviceMemory> memObjs;
-    std::vector<std::function<bool(VkQueue)>> eventUpdates;
-    std::vector<std::function<bool(VkQueue)>> queryUpdates;
+    cb_unordered_set<VkDeviceMemory> memObjs;
+    // Checks and state updates to perform at submit time. Shared with the primaries this command buffer is executed in.
+    std::shared_ptr<DeferredCheckQueue> deferred_checks;
 };
 
 struct SEMAPHORE_WAIT {
@@ -682,12 +1053,17 @@ struct SEMAPHORE_WAIT {
 struct CB_SUBMISSION {
     CB_SUBMISSION(std::vector<VkCommandBuffer> const &cbs, std::vector<SEMAPHORE_WAIT> const &waitSemaphores,
                   std::vector<VkSemaphore> const &signalSemaphores, VkFence fence)
-        : cbs(cbs), waitSemaphores(waitSemaphores), signalSemaphores(signalSemaphores), fence(fence) {}
+        : cbs(cbs), waitSemaphores(waitSemaphores), signalSemaphores(signalSemaphores), fence(fence),
+          has_guarded_query_resets(false) {}
 
     std::vector<VkCommandBuffer> cbs;
     std::vector<SEMAPHORE_WAIT> waitSemaphores;
     std::vector<VkSemaphore> signalSemaphores;
     VkFence fence;
+    // Objects whose in_use count was raised for this submission, one entry per increment, released as a flat list on retire
+    std::vector<VK_OBJECT> retire_objects;
+    // Set if any of the command buffers resets queries guarded by events, which fence waits have to verify
+    bool has_guarded_query_resets;
 };
 
 struct IMAGE_LAYOUT_NODE {
@@ -695,6 +1071,13 @@ struct IMAGE_LAYOUT_NODE {
     VkFormat format;
 };
 
+inline bool operator==(const IMAGE_LAYOUT_NODE &a, const IMAGE_LAYOUT_NODE &b) {
+    return a.layout == b.layout && a.format == b.format;
+}
+
+// Device-level image layouts, as left by the command buffers submitted so far
+typedef std::unordered_map<VkImage, ImageSubresourceLayouts<IMAGE_LAYOUT_NODE>> GlobalImageLayoutMap;
+
 // CHECK_DISABLED struct is a container for bools that can block validation checks from being performed.
 // The end goal is to have all checks guarded by a bool. The bools are all "false" by default meaning that all checks
 // are enabled. At CreateInstance time, the user can use the VK_EXT_validation_flags extension to pass in enum values
@@ -791,8 +1174,6 @@ bool insideRenderPass(const layer_data *my_data, GLOBAL_CB_NODE *pCB, const char
 void SetImageMemoryValid(layer_data *dev_data, IMAGE_STATE *image_state, bool valid);
 void UpdateCmdBufferLastCmd(GLOBAL_CB_NODE *cb_state, const CMD_TYPE cmd);
 bool outsideRenderPass(const layer_data *my_data, GLOBAL_CB_NODE *pCB, const char *apiName, UNIQUE_VALIDATION_ERROR_CODE msgCode);
-void SetLayout(GLOBAL_CB_NODE *pCB, ImageSubresourcePair imgpair, const IMAGE_CMD_BUF_LAYOUT_NODE &node);
-void SetLayout(GLOBAL_CB_NODE *pCB, ImageSubresourcePair imgpair, const VkImageLayout &layout);
 bool ValidateImageMemoryIsValid(layer_data *dev_data, IMAGE_STATE *image_state, const char *functionName);
 bool ValidateImageSampleCount(layer_data *dev_data, IMAGE_STATE *image_state, VkSampleCountFlagBits sample_count,
                               const char *location, UNIQUE_VALIDATION_ERROR_CODE msgCode);
@@ -812,9 +1193,8 @@ const debug_report_data *GetReportData(const layer_data *);
 const VkPhysicalDeviceProperties *GetPhysicalDeviceProperties(layer_data *);
 const CHECK_DISABLED *GetDisables(layer_data *);
 std::unordered_map<VkImage, std::unique_ptr<IMAGE_STATE>> *GetImageMap(core_validation::layer_data *);
-std::unordered_map<VkImage, std::vector<ImageSubresourcePair>> *GetImageSubresourceMap(layer_data *);
-std::unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> *GetImageLayoutMap(layer_data *);
-std::unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> const *GetImageLayoutMap(layer_data const *);
+GlobalImageLayoutMap *GetImageLayoutMap(layer_data *);
+GlobalImageLayoutMap const *GetImageLayoutMap(layer_data const *);
 std::unordered_map<VkBuffer, std::unique_ptr<BUFFER_STATE>> *GetBufferMap(layer_data *device_data);
 std::unordered_map<VkBufferView, std::unique_ptr<BUFFER_VIEW_STATE>> *GetBufferViewMap(layer_data *device_data);
 std::unordered_map<VkImageView, std::unique_ptr<IMAGE_VIEW_STATE>> *GetImageViewMap(layer_data *device_data);
@@ -27,6 +27,11 @@
 #include "buffer_validation.h"
 #include <sstream>
 #include <algorithm>
+#include <atomic>
+
+// Source of DescriptorSet change stamps. Sets draw from one counter so that a stamp is never repeated, even by a new set
+// created at the address of a freed one.
+static std::atomic<uint64_t> descriptor_set_change_counter(0);
 
 // Construct DescriptorSetLayout instance from given create info
 cvdescriptorset::DescriptorSetLayout::DescriptorSetLayout(const VkDescriptorSetLayoutCreateInfo *p_create_info,
@@ -314,6 +319,7 @@ cvdescriptorset::AllocateDescriptorSetsData::AllocateDescriptorSetsData(uint32_t
 cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, const VkDescriptorPool pool,
                                               const DescriptorSetLayout *layout, const layer_data *dev_data)
     : some_update_(false),
+      change_count_(++descriptor_set_change_counter),
       set_(set),
       pool_state_(nullptr),
       p_layout_(layout),
@@ -546,8 +552,8 @@ bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::map<uint32_t,
 
 // For given bindings, place any update buffers or images into the passed-in unordered_sets
 uint32_t cvdescriptorset::DescriptorSet::GetStorageUpdates(const std::map<uint32_t, descriptor_req> &bindings,
-                                                           std::unordered_set<VkBuffer> *buffer_set,
-                                                           std::unordered_set<VkImageView> *image_set) const {
+                                                           cb_unordered_set<VkBuffer> *buffer_set,
+                                                           cb_unordered_set<VkImageView> *image_set) const {
     auto num_updates = 0;
     for (auto binding_pair : bindings) {
         auto binding = binding_pair.first;
@@ -611,6 +617,7 @@ void cvdescriptorset::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorS
         binding_being_updated++;
     }
     if (update->descriptorCount) some_update_ = true;
+    change_count_ = ++descriptor_set_change_counter;
 
     InvalidateBoundCmdBuffers();
 }
@@ -714,6 +721,7 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet
         descriptors_[dst_start_idx + di]->CopyUpdate(src_set->descriptors_[src_start_idx + di].get());
     }
     if (update->descriptorCount) some_update_ = true;
+    change_count_ = ++descriptor_set_change_counter;
 
     InvalidateBoundCmdBuffers();
 }
@@ -724,10 +732,10 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet
 void cvdescriptorset::DescriptorSet::BindCommandBuffer(GLOBAL_CB_NODE *cb_node,
                                                        const std::map<uint32_t, descriptor_req> &binding_req_map) {
     // bind cb to this descriptor set
-    cb_bindings.insert(cb_node);
+    AddBoundCommandBuffer(cb_node);
     // Add bindings for descriptor set, the set's pool, and individual objects in the set
     cb_node->object_bindings.insert({reinterpret_cast<uint64_t &>(set_), kVulkanObjectTypeDescriptorSet });
-    pool_state_->cb_bindings.insert(cb_node);
+    pool_state_->AddBoundCommandBuffer(cb_node);
     cb_node->object_bindings.insert(
         {reinterpret_cast<uint64_t &>(pool_state_->pool), kVulkanObjectTypeDescriptorPool });
     // For the active slots, use set# to look up descriptorSet from boundDescriptorSets, and bind all of that descriptor set's
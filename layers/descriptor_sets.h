@@ -355,8 +355,8 @@ class DescriptorSet : public BASE_NODE {
                            const char *caller, std::string *) const;
     // For given set of bindings, add any buffers and images that will be updated to their respective unordered_sets & return number
     // of objects inserted
-    uint32_t GetStorageUpdates(const std::map<uint32_t, descriptor_req> &, std::unordered_set<VkBuffer> *,
-                               std::unordered_set<VkImageView> *) const;
+    uint32_t GetStorageUpdates(const std::map<uint32_t, descriptor_req> &, cb_unordered_set<VkBuffer> *,
+                               cb_unordered_set<VkImageView> *) const;
 
     // Descriptor Update functions. These functions validate state and perform update separately
     // Validate contents of a WriteUpdate
@@ -390,6 +390,8 @@ class DescriptorSet : public BASE_NODE {
     };
     // Return true if any part of set has ever been updated
     bool IsUpdated() const { return some_update_; };
+    // Return a device-wide unique stamp that changes whenever the contents of the set change
+    uint64_t GetChangeCount() const { return change_count_; };
 
    private:
     bool VerifyWriteUpdateContents(const VkWriteDescriptorSet *, const uint32_t, UNIQUE_VALIDATION_ERROR_CODE *,
@@ -401,7 +403,8 @@ class DescriptorSet : public BASE_NODE {
                               std::string *) const;
     // Private helper to set all bound cmd buffers to INVALID state
     void InvalidateBoundCmdBuffers();
-    bool some_update_;  // has any part of the set ever been updated?
+    bool some_update_;       // has any part of the set ever been updated?
+    uint64_t change_count_;  // stamp taken from a global counter at creation and on every update
     VkDescriptorSet set_;
     DESCRIPTOR_POOL_STATE *pool_state_;
     const DescriptorSetLayout *p_layout_;
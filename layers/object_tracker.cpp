@@ -39,6 +39,7 @@
 #include "vk_layer_logging.h"
 #include "vk_layer_table.h"
 #include "vk_object_types.h"
+#include "vk_command_name_hash.h"
 #include "vulkan/vk_layer.h"
 
 #include "object_tracker.h"
@@ -5096,170 +5097,313 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceFormats2KHR(VkPhysicalDev
 }
 
 static inline PFN_vkVoidFunction InterceptCoreDeviceCommand(const char *name) {
-    if (!name || name[0] != 'v' || name[1] != 'k') return NULL;
-
-    name += 2;
-    if (!strcmp(name, "GetDeviceProcAddr")) return (PFN_vkVoidFunction)GetDeviceProcAddr;
-    if (!strcmp(name, "DestroyDevice")) return (PFN_vkVoidFunction)DestroyDevice;
-    if (!strcmp(name, "GetDeviceQueue")) return (PFN_vkVoidFunction)GetDeviceQueue;
-    if (!strcmp(name, "QueueSubmit")) return (PFN_vkVoidFunction)QueueSubmit;
-    if (!strcmp(name, "QueueWaitIdle")) return (PFN_vkVoidFunction)QueueWaitIdle;
-    if (!strcmp(name, "DeviceWaitIdle")) return (PFN_vkVoidFunction)DeviceWaitIdle;
-    if (!strcmp(name, "AllocateMemory")) return (PFN_vkVoidFunction)AllocateMemory;
-    if (!strcmp(name, "FreeMemory")) return (PFN_vkVoidFunction)FreeMemory;
-    if (!strcmp(name, "MapMemory")) return (PFN_vkVoidFunction)MapMemory;
-    if (!strcmp(name, "UnmapMemory")) return (PFN_vkVoidFunction)UnmapMemory;
-    if (!strcmp(name, "FlushMappedMemoryRanges")) return (PFN_vkVoidFunction)FlushMappedMemoryRanges;
-    if (!strcmp(name, "InvalidateMappedMemoryRanges")) return (PFN_vkVoidFunction)InvalidateMappedMemoryRanges;
-    if (!strcmp(name, "GetDeviceMemoryCommitment")) return (PFN_vkVoidFunction)GetDeviceMemoryCommitment;
-    if (!strcmp(name, "BindBufferMemory")) return (PFN_vkVoidFunction)BindBufferMemory;
-    if (!strcmp(name, "BindImageMemory")) return (PFN_vkVoidFunction)BindImageMemory;
-    if (!strcmp(name, "GetBufferMemoryRequirements")) return (PFN_vkVoidFunction)GetBufferMemoryRequirements;
-    if (!strcmp(name, "GetImageMemoryRequirements")) return (PFN_vkVoidFunction)GetImageMemoryRequirements;
-    if (!strcmp(name, "GetImageSparseMemoryRequirements")) return (PFN_vkVoidFunction)GetImageSparseMemoryRequirements;
-    if (!strcmp(name, "QueueBindSparse")) return (PFN_vkVoidFunction)QueueBindSparse;
-    if (!strcmp(name, "CreateFence")) return (PFN_vkVoidFunction)CreateFence;
-    if (!strcmp(name, "DestroyFence")) return (PFN_vkVoidFunction)DestroyFence;
-    if (!strcmp(name, "ResetFences")) return (PFN_vkVoidFunction)ResetFences;
-    if (!strcmp(name, "GetFenceStatus")) return (PFN_vkVoidFunction)GetFenceStatus;
-    if (!strcmp(name, "WaitForFences")) return (PFN_vkVoidFunction)WaitForFences;
-    if (!strcmp(name, "CreateSemaphore")) return (PFN_vkVoidFunction)CreateSemaphore;
-    if (!strcmp(name, "DestroySemaphore")) return (PFN_vkVoidFunction)DestroySemaphore;
-    if (!strcmp(name, "CreateEvent")) return (PFN_vkVoidFunction)CreateEvent;
-    if (!strcmp(name, "DestroyEvent")) return (PFN_vkVoidFunction)DestroyEvent;
-    if (!strcmp(name, "GetEventStatus")) return (PFN_vkVoidFunction)GetEventStatus;
-    if (!strcmp(name, "SetEvent")) return (PFN_vkVoidFunction)SetEvent;
-    if (!strcmp(name, "ResetEvent")) return (PFN_vkVoidFunction)ResetEvent;
-    if (!strcmp(name, "CreateQueryPool")) return (PFN_vkVoidFunction)CreateQueryPool;
-    if (!strcmp(name, "DestroyQueryPool")) return (PFN_vkVoidFunction)DestroyQueryPool;
-    if (!strcmp(name, "GetQueryPoolResults")) return (PFN_vkVoidFunction)GetQueryPoolResults;
-    if (!strcmp(name, "CreateBuffer")) return (PFN_vkVoidFunction)CreateBuffer;
-    if (!strcmp(name, "DestroyBuffer")) return (PFN_vkVoidFunction)DestroyBuffer;
-    if (!strcmp(name, "CreateBufferView")) return (PFN_vkVoidFunction)CreateBufferView;
-    if (!strcmp(name, "DestroyBufferView")) return (PFN_vkVoidFunction)DestroyBufferView;
-    if (!strcmp(name, "CreateImage")) return (PFN_vkVoidFunction)CreateImage;
-    if (!strcmp(name, "DestroyImage")) return (PFN_vkVoidFunction)DestroyImage;
-    if (!strcmp(name, "GetImageSubresourceLayout")) return (PFN_vkVoidFunction)GetImageSubresourceLayout;
-    if (!strcmp(name, "CreateImageView")) return (PFN_vkVoidFunction)CreateImageView;
-    if (!strcmp(name, "DestroyImageView")) return (PFN_vkVoidFunction)DestroyImageView;
-    if (!strcmp(name, "CreateShaderModule")) return (PFN_vkVoidFunction)CreateShaderModule;
-    if (!strcmp(name, "DestroyShaderModule")) return (PFN_vkVoidFunction)DestroyShaderModule;
-    if (!strcmp(name, "CreatePipelineCache")) return (PFN_vkVoidFunction)CreatePipelineCache;
-    if (!strcmp(name, "DestroyPipelineCache")) return (PFN_vkVoidFunction)DestroyPipelineCache;
-    if (!strcmp(name, "GetPipelineCacheData")) return (PFN_vkVoidFunction)GetPipelineCacheData;
-    if (!strcmp(name, "MergePipelineCaches")) return (PFN_vkVoidFunction)MergePipelineCaches;
-    if (!strcmp(name, "CreateGraphicsPipelines")) return (PFN_vkVoidFunction)CreateGraphicsPipelines;
-    if (!strcmp(name, "CreateComputePipelines")) return (PFN_vkVoidFunction)CreateComputePipelines;
-    if (!strcmp(name, "DestroyPipeline")) return (PFN_vkVoidFunction)DestroyPipeline;
-    if (!strcmp(name, "CreatePipelineLayout")) return (PFN_vkVoidFunction)CreatePipelineLayout;
-    if (!strcmp(name, "DestroyPipelineLayout")) return (PFN_vkVoidFunction)DestroyPipelineLayout;
-    if (!strcmp(name, "CreateSampler")) return (PFN_vkVoidFunction)CreateSampler;
-    if (!strcmp(name, "DestroySampler")) return (PFN_vkVoidFunction)DestroySampler;
-    if (!strcmp(name, "CreateDescriptorSetLayout")) return (PFN_vkVoidFunction)CreateDescriptorSetLayout;
-    if (!strcmp(name, "DestroyDescriptorSetLayout")) return (PFN_vkVoidFunction)DestroyDescriptorSetLayout;
-    if (!strcmp(name, "CreateDescriptorPool")) return (PFN_vkVoidFunction)CreateDescriptorPool;
-    if (!strcmp(name, "DestroyDescriptorPool")) return (PFN_vkVoidFunction)DestroyDescriptorPool;
-    if (!strcmp(name, "ResetDescriptorPool")) return (PFN_vkVoidFunction)ResetDescriptorPool;
-    if (!strcmp(name, "AllocateDescriptorSets")) return (PFN_vkVoidFunction)AllocateDescriptorSets;
-    if (!strcmp(name, "FreeDescriptorSets")) return (PFN_vkVoidFunction)FreeDescriptorSets;
-    if (!strcmp(name, "UpdateDescriptorSets")) return (PFN_vkVoidFunction)UpdateDescriptorSets;
-    if (!strcmp(name, "CreateFramebuffer")) return (PFN_vkVoidFunction)CreateFramebuffer;
-    if (!strcmp(name, "DestroyFramebuffer")) return (PFN_vkVoidFunction)DestroyFramebuffer;
-    if (!strcmp(name, "CreateRenderPass")) return (PFN_vkVoidFunction)CreateRenderPass;
-    if (!strcmp(name, "DestroyRenderPass")) return (PFN_vkVoidFunction)DestroyRenderPass;
-    if (!strcmp(name, "GetRenderAreaGranularity")) return (PFN_vkVoidFunction)GetRenderAreaGranularity;
-    if (!strcmp(name, "CreateCommandPool")) return (PFN_vkVoidFunction)CreateCommandPool;
-    if (!strcmp(name, "DestroyCommandPool")) return (PFN_vkVoidFunction)DestroyCommandPool;
-    if (!strcmp(name, "ResetCommandPool")) return (PFN_vkVoidFunction)ResetCommandPool;
-    if (!strcmp(name, "AllocateCommandBuffers")) return (PFN_vkVoidFunction)AllocateCommandBuffers;
-    if (!strcmp(name, "FreeCommandBuffers")) return (PFN_vkVoidFunction)FreeCommandBuffers;
-    if (!strcmp(name, "BeginCommandBuffer")) return (PFN_vkVoidFunction)BeginCommandBuffer;
-    if (!strcmp(name, "EndCommandBuffer")) return (PFN_vkVoidFunction)EndCommandBuffer;
-    if (!strcmp(name, "ResetCommandBuffer")) return (PFN_vkVoidFunction)ResetCommandBuffer;
-    if (!strcmp(name, "CmdBindPipeline")) return (PFN_vkVoidFunction)CmdBindPipeline;
-    if (!strcmp(name, "CmdSetViewport")) return (PFN_vkVoidFunction)CmdSetViewport;
-    if (!strcmp(name, "CmdSetScissor")) return (PFN_vkVoidFunction)CmdSetScissor;
-    if (!strcmp(name, "CmdSetLineWidth")) return (PFN_vkVoidFunction)CmdSetLineWidth;
-    if (!strcmp(name, "CmdSetDepthBias")) return (PFN_vkVoidFunction)CmdSetDepthBias;
-    if (!strcmp(name, "CmdSetBlendConstants")) return (PFN_vkVoidFunction)CmdSetBlendConstants;
-    if (!strcmp(name, "CmdSetDepthBounds")) return (PFN_vkVoidFunction)CmdSetDepthBounds;
-    if (!strcmp(name, "CmdSetStencilCompareMask")) return (PFN_vkVoidFunction)CmdSetStencilCompareMask;
-    if (!strcmp(name, "CmdSetStencilWriteMask")) return (PFN_vkVoidFunction)CmdSetStencilWriteMask;
-    if (!strcmp(name, "CmdSetStencilReference")) return (PFN_vkVoidFunction)CmdSetStencilReference;
-    if (!strcmp(name, "CmdBindDescriptorSets")) return (PFN_vkVoidFunction)CmdBindDescriptorSets;
-    if (!strcmp(name, "CmdBindIndexBuffer")) return (PFN_vkVoidFunction)CmdBindIndexBuffer;
-    if (!strcmp(name, "CmdBindVertexBuffers")) return (PFN_vkVoidFunction)CmdBindVertexBuffers;
-    if (!strcmp(name, "CmdDraw")) return (PFN_vkVoidFunction)CmdDraw;
-    if (!strcmp(name, "CmdDrawIndexed")) return (PFN_vkVoidFunction)CmdDrawIndexed;
-    if (!strcmp(name, "CmdDrawIndirect")) return (PFN_vkVoidFunction)CmdDrawIndirect;
-    if (!strcmp(name, "CmdDrawIndexedIndirect")) return (PFN_vkVoidFunction)CmdDrawIndexedIndirect;
-    if (!strcmp(name, "CmdDispatch")) return (PFN_vkVoidFunction)CmdDispatch;
-    if (!strcmp(name, "CmdDispatchIndirect")) return (PFN_vkVoidFunction)CmdDispatchIndirect;
-    if (!strcmp(name, "CmdCopyBuffer")) return (PFN_vkVoidFunction)CmdCopyBuffer;
-    if (!strcmp(name, "CmdCopyImage")) return (PFN_vkVoidFunction)CmdCopyImage;
-    if (!strcmp(name, "CmdBlitImage")) return (PFN_vkVoidFunction)CmdBlitImage;
-    if (!strcmp(name, "CmdCopyBufferToImage")) return (PFN_vkVoidFunction)CmdCopyBufferToImage;
-    if (!strcmp(name, "CmdCopyImageToBuffer")) return (PFN_vkVoidFunction)CmdCopyImageToBuffer;
-    if (!strcmp(name, "CmdUpdateBuffer")) return (PFN_vkVoidFunction)CmdUpdateBuffer;
-    if (!strcmp(name, "CmdFillBuffer")) return (PFN_vkVoidFunction)CmdFillBuffer;
-    if (!strcmp(name, "CmdClearColorImage")) return (PFN_vkVoidFunction)CmdClearColorImage;
-    if (!strcmp(name, "CmdClearDepthStencilImage")) return (PFN_vkVoidFunction)CmdClearDepthStencilImage;
-    if (!strcmp(name, "CmdClearAttachments")) return (PFN_vkVoidFunction)CmdClearAttachments;
-    if (!strcmp(name, "CmdResolveImage")) return (PFN_vkVoidFunction)CmdResolveImage;
-    if (!strcmp(name, "CmdSetEvent")) return (PFN_vkVoidFunction)CmdSetEvent;
-    if (!strcmp(name, "CmdResetEvent")) return (PFN_vkVoidFunction)CmdResetEvent;
-    if (!strcmp(name, "CmdWaitEvents")) return (PFN_vkVoidFunction)CmdWaitEvents;
-    if (!strcmp(name, "CmdPipelineBarrier")) return (PFN_vkVoidFunction)CmdPipelineBarrier;
-    if (!strcmp(name, "CmdBeginQuery")) return (PFN_vkVoidFunction)CmdBeginQuery;
-    if (!strcmp(name, "CmdEndQuery")) return (PFN_vkVoidFunction)CmdEndQuery;
-    if (!strcmp(name, "CmdResetQueryPool")) return (PFN_vkVoidFunction)CmdResetQueryPool;
-    if (!strcmp(name, "CmdWriteTimestamp")) return (PFN_vkVoidFunction)CmdWriteTimestamp;
-    if (!strcmp(name, "CmdCopyQueryPoolResults")) return (PFN_vkVoidFunction)CmdCopyQueryPoolResults;
-    if (!strcmp(name, "CmdPushConstants")) return (PFN_vkVoidFunction)CmdPushConstants;
-    if (!strcmp(name, "CmdBeginRenderPass")) return (PFN_vkVoidFunction)CmdBeginRenderPass;
-    if (!strcmp(name, "CmdNextSubpass")) return (PFN_vkVoidFunction)CmdNextSubpass;
-    if (!strcmp(name, "CmdEndRenderPass")) return (PFN_vkVoidFunction)CmdEndRenderPass;
-    if (!strcmp(name, "CmdExecuteCommands")) return (PFN_vkVoidFunction)CmdExecuteCommands;
-    if (!strcmp(name, "DebugMarkerSetObjectTagEXT")) return (PFN_vkVoidFunction)DebugMarkerSetObjectTagEXT;
-    if (!strcmp(name, "DebugMarkerSetObjectNameEXT")) return (PFN_vkVoidFunction)DebugMarkerSetObjectNameEXT;
-    if (!strcmp(name, "CmdDebugMarkerBeginEXT")) return (PFN_vkVoidFunction)CmdDebugMarkerBeginEXT;
-    if (!strcmp(name, "CmdDebugMarkerEndEXT")) return (PFN_vkVoidFunction)CmdDebugMarkerEndEXT;
-    if (!strcmp(name, "CmdDebugMarkerInsertEXT")) return (PFN_vkVoidFunction)CmdDebugMarkerInsertEXT;
+    switch (LookupVulkanCommand(name)) {
+        case kVulkanCommandGetDeviceProcAddr:
+            return (PFN_vkVoidFunction)GetDeviceProcAddr;
+        case kVulkanCommandDestroyDevice:
+            return (PFN_vkVoidFunction)DestroyDevice;
+        case kVulkanCommandGetDeviceQueue:
+            return (PFN_vkVoidFunction)GetDeviceQueue;
+        case kVulkanCommandQueueSubmit:
+            return (PFN_vkVoidFunction)QueueSubmit;
+        case kVulkanCommandQueueWaitIdle:
+            return (PFN_vkVoidFunction)QueueWaitIdle;
+        case kVulkanCommandDeviceWaitIdle:
+            return (PFN_vkVoidFunction)DeviceWaitIdle;
+        case kVulkanCommandAllocateMemory:
+            return (PFN_vkVoidFunction)AllocateMemory;
+        case kVulkanCommandFreeMemory:
+            return (PFN_vkVoidFunction)FreeMemory;
+        case kVulkanCommandMapMemory:
+            return (PFN_vkVoidFunction)MapMemory;
+        case kVulkanCommandUnmapMemory:
+            return (PFN_vkVoidFunction)UnmapMemory;
+        case kVulkanCommandFlushMappedMemoryRanges:
+            return (PFN_vkVoidFunction)FlushMappedMemoryRanges;
+        case kVulkanCommandInvalidateMappedMemoryRanges:
+            return (PFN_vkVoidFunction)InvalidateMappedMemoryRanges;
+        case kVulkanCommandGetDeviceMemoryCommitment:
+            return (PFN_vkVoidFunction)GetDeviceMemoryCommitment;
+        case kVulkanCommandBindBufferMemory:
+            return (PFN_vkVoidFunction)BindBufferMemory;
+        case kVulkanCommandBindImageMemory:
+            return (PFN_vkVoidFunction)BindImageMemory;
+        case kVulkanCommandGetBufferMemoryRequirements:
+            return (PFN_vkVoidFunction)GetBufferMemoryRequirements;
+        case kVulkanCommandGetImageMemoryRequirements:
+            return (PFN_vkVoidFunction)GetImageMemoryRequirements;
+        case kVulkanCommandGetImageSparseMemoryRequirements:
+            return (PFN_vkVoidFunction)GetImageSparseMemoryRequirements;
+        case kVulkanCommandQueueBindSparse:
+            return (PFN_vkVoidFunction)QueueBindSparse;
+        case kVulkanCommandCreateFence:
+            return (PFN_vkVoidFunction)CreateFence;
+        case kVulkanCommandDestroyFence:
+            return (PFN_vkVoidFunction)DestroyFence;
+        case kVulkanCommandResetFences:
+            return (PFN_vkVoidFunction)ResetFences;
+        case kVulkanCommandGetFenceStatus:
+            return (PFN_vkVoidFunction)GetFenceStatus;
+        case kVulkanCommandWaitForFences:
+            return (PFN_vkVoidFunction)WaitForFences;
+        case kVulkanCommandCreateSemaphore:
+            return (PFN_vkVoidFunction)CreateSemaphore;
+        case kVulkanCommandDestroySemaphore:
+            return (PFN_vkVoidFunction)DestroySemaphore;
+        case kVulkanCommandCreateEvent:
+            return (PFN_vkVoidFunction)CreateEvent;
+        case kVulkanCommandDestroyEvent:
+            return (PFN_vkVoidFunction)DestroyEvent;
+        case kVulkanCommandGetEventStatus:
+            return (PFN_vkVoidFunction)GetEventStatus;
+        case kVulkanCommandSetEvent:
+            return (PFN_vkVoidFunction)SetEvent;
+        case kVulkanCommandResetEvent:
+            return (PFN_vkVoidFunction)ResetEvent;
+        case kVulkanCommandCreateQueryPool:
+            return (PFN_vkVoidFunction)CreateQueryPool;
+        case kVulkanCommandDestroyQueryPool:
+            return (PFN_vkVoidFunction)DestroyQueryPool;
+        case kVulkanCommandGetQueryPoolResults:
+            return (PFN_vkVoidFunction)GetQueryPoolResults;
+        case kVulkanCommandCreateBuffer:
+            return (PFN_vkVoidFunction)CreateBuffer;
+        case kVulkanCommandDestroyBuffer:
+            return (PFN_vkVoidFunction)DestroyBuffer;
+        case kVulkanCommandCreateBufferView:
+            return (PFN_vkVoidFunction)CreateBufferView;
+        case kVulkanCommandDestroyBufferView:
+            return (PFN_vkVoidFunction)DestroyBufferView;
+        case kVulkanCommandCreateImage:
+            return (PFN_vkVoidFunction)CreateImage;
+        case kVulkanCommandDestroyImage:
+            return (PFN_vkVoidFunction)DestroyImage;
+        case kVulkanCommandGetImageSubresourceLayout:
+            return (PFN_vkVoidFunction)GetImageSubresourceLayout;
+        case kVulkanCommandCreateImageView:
+            return (PFN_vkVoidFunction)CreateImageView;
+        case kVulkanCommandDestroyImageView:
+            return (PFN_vkVoidFunction)DestroyImageView;
+        case kVulkanCommandCreateShaderModule:
+            return (PFN_vkVoidFunction)CreateShaderModule;
+        case kVulkanCommandDestroyShaderModule:
+            return (PFN_vkVoidFunction)DestroyShaderModule;
+        case kVulkanCommandCreatePipelineCache:
+            return (PFN_vkVoidFunction)CreatePipelineCache;
+        case kVulkanCommandDestroyPipelineCache:
+            return (PFN_vkVoidFunction)DestroyPipelineCache;
+        case kVulkanCommandGetPipelineCacheData:
+            return (PFN_vkVoidFunction)GetPipelineCacheData;
+        case kVulkanCommandMergePipelineCaches:
+            return (PFN_vkVoidFunction)MergePipelineCaches;
+        case kVulkanCommandCreateGraphicsPipelines:
+            return (PFN_vkVoidFunction)CreateGraphicsPipelines;
+        case kVulkanCommandCreateComputePipelines:
+            return (PFN_vkVoidFunction)CreateComputePipelines;
+        case kVulkanCommandDestroyPipeline:
+            return (PFN_vkVoidFunction)DestroyPipeline;
+        case kVulkanCommandCreatePipelineLayout:
+            return (PFN_vkVoidFunction)CreatePipelineLayout;
+        case kVulkanCommandDestroyPipelineLayout:
+            return (PFN_vkVoidFunction)DestroyPipelineLayout;
+        case kVulkanCommandCreateSampler:
+            return (PFN_vkVoidFunction)CreateSampler;
+        case kVulkanCommandDestroySampler:
+            return (PFN_vkVoidFunction)DestroySampler;
+        case kVulkanCommandCreateDescriptorSetLayout:
+            return (PFN_vkVoidFunction)CreateDescriptorSetLayout;
+        case kVulkanCommandDestroyDescriptorSetLayout:
+            return (PFN_vkVoidFunction)DestroyDescriptorSetLayout;
+        case kVulkanCommandCreateDescriptorPool:
+            return (PFN_vkVoidFunction)CreateDescriptorPool;
+        case kVulkanCommandDestroyDescriptorPool:
+            return (PFN_vkVoidFunction)DestroyDescriptorPool;
+        case kVulkanCommandResetDescriptorPool:
+            return (PFN_vkVoidFunction)ResetDescriptorPool;
+        case kVulkanCommandAllocateDescriptorSets:
+            return (PFN_vkVoidFunction)AllocateDescriptorSets;
+        case kVulkanCommandFreeDescriptorSets:
+            return (PFN_vkVoidFunction)FreeDescriptorSets;
+        case kVulkanCommandUpdateDescriptorSets:
+            return (PFN_vkVoidFunction)UpdateDescriptorSets;
+        case kVulkanCommandCreateFramebuffer:
+            return (PFN_vkVoidFunction)CreateFramebuffer;
+        case kVulkanCommandDestroyFramebuffer:
+            return (PFN_vkVoidFunction)DestroyFramebuffer;
+        case kVulkanCommandCreateRenderPass:
+            return (PFN_vkVoidFunction)CreateRenderPass;
+        case kVulkanCommandDestroyRenderPass:
+            return (PFN_vkVoidFunction)DestroyRenderPass;
+        case kVulkanCommandGetRenderAreaGranularity:
+            return (PFN_vkVoidFunction)GetRenderAreaGranularity;
+        case kVulkanCommandCreateCommandPool:
+            return (PFN_vkVoidFunction)CreateCommandPool;
+        case kVulkanCommandDestroyCommandPool:
+            return (PFN_vkVoidFunction)DestroyCommandPool;
+        case kVulkanCommandResetCommandPool:
+            return (PFN_vkVoidFunction)ResetCommandPool;
+        case kVulkanCommandAllocateCommandBuffers:
+            return (PFN_vkVoidFunction)AllocateCommandBuffers;
+        case kVulkanCommandFreeCommandBuffers:
+            return (PFN_vkVoidFunction)FreeCommandBuffers;
+        case kVulkanCommandBeginCommandBuffer:
+            return (PFN_vkVoidFunction)BeginCommandBuffer;
+        case kVulkanCommandEndCommandBuffer:
+            return (PFN_vkVoidFunction)EndCommandBuffer;
+        case kVulkanCommandResetCommandBuffer:
+            return (PFN_vkVoidFunction)ResetCommandBuffer;
+        case kVulkanCommandCmdBindPipeline:
+            return (PFN_vkVoidFunction)CmdBindPipeline;
+        case kVulkanCommandCmdSetViewport:
+            return (PFN_vkVoidFunction)CmdSetViewport;
+        case kVulkanCommandCmdSetScissor:
+            return (PFN_vkVoidFunction)CmdSetScissor;
+        case kVulkanCommandCmdSetLineWidth:
+            return (PFN_vkVoidFunction)CmdSetLineWidth;
+        case kVulkanCommandCmdSetDepthBias:
+            return (PFN_vkVoidFunction)CmdSetDepthBias;
+        case kVulkanCommandCmdSetBlendConstants:
+            return (PFN_vkVoidFunction)CmdSetBlendConstants;
+        case kVulkanCommandCmdSetDepthBounds:
+            return (PFN_vkVoidFunction)CmdSetDepthBounds;
+        case kVulkanCommandCmdSetStencilCompareMask:
+            return (PFN_vkVoidFunction)CmdSetStencilCompareMask;
+        case kVulkanCommandCmdSetStencilWriteMask:
+            return (PFN_vkVoidFunction)CmdSetStencilWriteMask;
+        case kVulkanCommandCmdSetStencilReference:
+            return (PFN_vkVoidFunction)CmdSetStencilReference;
+        case kVulkanCommandCmdBindDescriptorSets:
+            return (PFN_vkVoidFunction)CmdBindDescriptorSets;
+        case kVulkanCommandCmdBindIndexBuffer:
+            return (PFN_vkVoidFunction)CmdBindIndexBuffer;
+        case kVulkanCommandCmdBindVertexBuffers:
+            return (PFN_vkVoidFunction)CmdBindVertexBuffers;
+        case kVulkanCommandCmdDraw:
+            return (PFN_vkVoidFunction)CmdDraw;
+        case kVulkanCommandCmdDrawIndexed:
+            return (PFN_vkVoidFunction)CmdDrawIndexed;
+        case kVulkanCommandCmdDrawIndirect:
+            return (PFN_vkVoidFunction)CmdDrawIndirect;
+        case kVulkanCommandCmdDrawIndexedIndirect:
+            return (PFN_vkVoidFunction)CmdDrawIndexedIndirect;
+        case kVulkanCommandCmdDispatch:
+            return (PFN_vkVoidFunction)CmdDispatch;
+        case kVulkanCommandCmdDispatchIndirect:
+            return (PFN_vkVoidFunction)CmdDispatchIndirect;
+        case kVulkanCommandCmdCopyBuffer:
+            return (PFN_vkVoidFunction)CmdCopyBuffer;
+        case kVulkanCommandCmdCopyImage:
+            return (PFN_vkVoidFunction)CmdCopyImage;
+        case kVulkanCommandCmdBlitImage:
+            return (PFN_vkVoidFunction)CmdBlitImage;
+        case kVulkanCommandCmdCopyBufferToImage:
+            return (PFN_vkVoidFunction)CmdCopyBufferToImage;
+        case kVulkanCommandCmdCopyImageToBuffer:
+            return (PFN_vkVoidFunction)CmdCopyImageToBuffer;
+        case kVulkanCommandCmdUpdateBuffer:
+            return (PFN_vkVoidFunction)CmdUpdateBuffer;
+        case kVulkanCommandCmdFillBuffer:
+            return (PFN_vkVoidFunction)CmdFillBuffer;
+        case kVulkanCommandCmdClearColorImage:
+            return (PFN_vkVoidFunction)CmdClearColorImage;
+        case kVulkanCommandCmdClearDepthStencilImage:
+            return (PFN_vkVoidFunction)CmdClearDepthStencilImage;
+        case kVulkanCommandCmdClearAttachments:
+            return (PFN_vkVoidFunction)CmdClearAttachments;
+        case kVulkanCommandCmdResolveImage:
+            return (PFN_vkVoidFunction)CmdResolveImage;
+        case kVulkanCommandCmdSetEvent:
+            return (PFN_vkVoidFunction)CmdSetEvent;
+        case kVulkanCommandCmdResetEvent:
+            return (PFN_vkVoidFunction)CmdResetEvent;
+        case kVulkanCommandCmdWaitEvents:
+            return (PFN_vkVoidFunction)CmdWaitEvents;
+        case kVulkanCommandCmdPipelineBarrier:
+            return (PFN_vkVoidFunction)CmdPipelineBarrier;
+        case kVulkanCommandCmdBeginQuery:
+            return (PFN_vkVoidFunction)CmdBeginQuery;
+        case kVulkanCommandCmdEndQuery:
+            return (PFN_vkVoidFunction)CmdEndQuery;
+        case kVulkanCommandCmdResetQueryPool:
+            return (PFN_vkVoidFunction)CmdResetQueryPool;
+        case kVulkanCommandCmdWriteTimestamp:
+            return (PFN_vkVoidFunction)CmdWriteTimestamp;
+        case kVulkanCommandCmdCopyQueryPoolResults:
+            return (PFN_vkVoidFunction)CmdCopyQueryPoolResults;
+        case kVulkanCommandCmdPushConstants:
+            return (PFN_vkVoidFunction)CmdPushConstants;
+        case kVulkanCommandCmdBeginRenderPass:
+            return (PFN_vkVoidFunction)CmdBeginRenderPass;
+        case kVulkanCommandCmdNextSubpass:
+            return (PFN_vkVoidFunction)CmdNextSubpass;
+        case kVulkanCommandCmdEndRenderPass:
+            return (PFN_vkVoidFunction)CmdEndRenderPass;
+        case kVulkanCommandCmdExecuteCommands:
+            return (PFN_vkVoidFunction)CmdExecuteCommands;
+        case kVulkanCommandDebugMarkerSetObjectTagEXT:
+            return (PFN_vkVoidFunction)DebugMarkerSetObjectTagEXT;
+        case kVulkanCommandDebugMarkerSetObjectNameEXT:
+            return (PFN_vkVoidFunction)DebugMarkerSetObjectNameEXT;
+        case kVulkanCommandCmdDebugMarkerBeginEXT:
+            return (PFN_vkVoidFunction)CmdDebugMarkerBeginEXT;
+        case kVulkanCommandCmdDebugMarkerEndEXT:
+            return (PFN_vkVoidFunction)CmdDebugMarkerEndEXT;
+        case kVulkanCommandCmdDebugMarkerInsertEXT:
+            return (PFN_vkVoidFunction)CmdDebugMarkerInsertEXT;
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetMemoryWin32HandleNV")) return (PFN_vkVoidFunction)GetMemoryWin32HandleNV;
+        case kVulkanCommandGetMemoryWin32HandleNV:
+            return (PFN_vkVoidFunction)GetMemoryWin32HandleNV;
 #endif  // VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "CmdDrawIndirectCountAMD")) return (PFN_vkVoidFunction)CmdDrawIndirectCountAMD;
-    if (!strcmp(name, "CmdDrawIndexedIndirectCountAMD")) return (PFN_vkVoidFunction)CmdDrawIndexedIndirectCountAMD;
-    if (!strcmp(name, "SetHdrMetadataEXT")) return (PFN_vkVoidFunction)SetHdrMetadataEXT;
-
-    return NULL;
+        case kVulkanCommandCmdDrawIndirectCountAMD:
+            return (PFN_vkVoidFunction)CmdDrawIndirectCountAMD;
+        case kVulkanCommandCmdDrawIndexedIndirectCountAMD:
+            return (PFN_vkVoidFunction)CmdDrawIndexedIndirectCountAMD;
+        case kVulkanCommandSetHdrMetadataEXT:
+            return (PFN_vkVoidFunction)SetHdrMetadataEXT;
+        default:
+            return NULL;
+    }
 }
 
 static inline PFN_vkVoidFunction InterceptCoreInstanceCommand(const char *name) {
-    if (!name || name[0] != 'v' || name[1] != 'k') return NULL;
-
-    name += 2;
-    if (!strcmp(name, "CreateInstance")) return (PFN_vkVoidFunction)CreateInstance;
-    if (!strcmp(name, "DestroyInstance")) return (PFN_vkVoidFunction)DestroyInstance;
-    if (!strcmp(name, "EnumeratePhysicalDevices")) return (PFN_vkVoidFunction)EnumeratePhysicalDevices;
-    if (!strcmp(name, "_layerGetPhysicalDeviceProcAddr")) return (PFN_vkVoidFunction)GetPhysicalDeviceProcAddr;
-    if (!strcmp(name, "GetPhysicalDeviceFeatures")) return (PFN_vkVoidFunction)GetPhysicalDeviceFeatures;
-    if (!strcmp(name, "GetPhysicalDeviceFormatProperties")) return (PFN_vkVoidFunction)GetPhysicalDeviceFormatProperties;
-    if (!strcmp(name, "GetPhysicalDeviceImageFormatProperties")) return (PFN_vkVoidFunction)GetPhysicalDeviceImageFormatProperties;
-    if (!strcmp(name, "GetPhysicalDeviceProperties")) return (PFN_vkVoidFunction)GetPhysicalDeviceProperties;
-    if (!strcmp(name, "GetPhysicalDeviceQueueFamilyProperties")) return (PFN_vkVoidFunction)GetPhysicalDeviceQueueFamilyProperties;
-    if (!strcmp(name, "GetPhysicalDeviceMemoryProperties")) return (PFN_vkVoidFunction)GetPhysicalDeviceMemoryProperties;
-    if (!strcmp(name, "GetInstanceProcAddr")) return (PFN_vkVoidFunction)GetInstanceProcAddr;
-    if (!strcmp(name, "CreateDevice")) return (PFN_vkVoidFunction)CreateDevice;
-    if (!strcmp(name, "EnumerateInstanceExtensionProperties")) return (PFN_vkVoidFunction)EnumerateInstanceExtensionProperties;
-    if (!strcmp(name, "EnumerateInstanceLayerProperties")) return (PFN_vkVoidFunction)EnumerateInstanceLayerProperties;
-    if (!strcmp(name, "EnumerateDeviceLayerProperties")) return (PFN_vkVoidFunction)EnumerateDeviceLayerProperties;
-    if (!strcmp(name, "GetPhysicalDeviceSparseImageFormatProperties"))
-        return (PFN_vkVoidFunction)GetPhysicalDeviceSparseImageFormatProperties;
-    if (!strcmp(name, "GetPhysicalDeviceExternalImageFormatPropertiesNV"))
-        return (PFN_vkVoidFunction)GetPhysicalDeviceExternalImageFormatPropertiesNV;
-
-    return NULL;
+    switch (LookupVulkanCommand(name)) {
+        case kVulkanCommandCreateInstance:
+            return (PFN_vkVoidFunction)CreateInstance;
+        case kVulkanCommandDestroyInstance:
+            return (PFN_vkVoidFunction)DestroyInstance;
+        case kVulkanCommandEnumeratePhysicalDevices:
+            return (PFN_vkVoidFunction)EnumeratePhysicalDevices;
+        case kVulkanCommand_layerGetPhysicalDeviceProcAddr:
+            return (PFN_vkVoidFunction)GetPhysicalDeviceProcAddr;
+        case kVulkanCommandGetPhysicalDeviceFeatures:
+            return (PFN_vkVoidFunction)GetPhysicalDeviceFeatures;
+        case kVulkanCommandGetPhysicalDeviceFormatProperties:
+            return (PFN_vkVoidFunction)GetPhysicalDeviceFormatProperties;
+        case kVulkanCommandGetPhysicalDeviceImageFormatProperties:
+            return (PFN_vkVoidFunction)GetPhysicalDeviceImageFormatProperties;
+        case kVulkanCommandGetPhysicalDeviceProperties:
+            return (PFN_vkVoidFunction)GetPhysicalDeviceProperties;
+        case kVulkanCommandGetPhysicalDeviceQueueFamilyProperties:
+            return (PFN_vkVoidFunction)GetPhysicalDeviceQueueFamilyProperties;
+        case kVulkanCommandGetPhysicalDeviceMemoryProperties:
+            return (PFN_vkVoidFunction)GetPhysicalDeviceMemoryProperties;
+        case kVulkanCommandGetInstanceProcAddr:
+            return (PFN_vkVoidFunction)GetInstanceProcAddr;
+        case kVulkanCommandCreateDevice:
+            return (PFN_vkVoidFunction)CreateDevice;
+        case kVulkanCommandEnumerateInstanceExtensionProperties:
+            return (PFN_vkVoidFunction)EnumerateInstanceExtensionProperties;
+        case kVulkanCommandEnumerateInstanceLayerProperties:
+            return (PFN_vkVoidFunction)EnumerateInstanceLayerProperties;
+        case kVulkanCommandEnumerateDeviceLayerProperties:
+            return (PFN_vkVoidFunction)EnumerateDeviceLayerProperties;
+        case kVulkanCommandGetPhysicalDeviceSparseImageFormatProperties:
+            return (PFN_vkVoidFunction)GetPhysicalDeviceSparseImageFormatProperties;
+        case kVulkanCommandGetPhysicalDeviceExternalImageFormatPropertiesNV:
+            return (PFN_vkVoidFunction)GetPhysicalDeviceExternalImageFormatPropertiesNV;
+        default:
+            return NULL;
+    }
 }
 
 static inline PFN_vkVoidFunction InterceptInstanceExtensionCommand(const char *name) {
@@ -19,15 +19,16 @@
 #define PARAMETER_NAME_H
 
 #include <cassert>
+#include <cstring>
+#include <initializer_list>
 #include <sstream>
 #include <string>
-#include <vector>
 
 /**
  * Parameter name string supporting deferred formatting for array subscripts.
  *
  * Custom parameter name class with support for deferred formatting of names containing array subscripts.  The class stores
- * a format string and a vector of index values, and performs string formatting when an accessor function is called to
+ * a format string and a list of index values, and performs string formatting when an accessor function is called to
  * retrieve the name string.  This class was primarily designed to be used with validation functions that receive a parameter name
  * string and value as arguments, and print an error message that includes the parameter name when the value fails a validation
  * test.  Using standard strings with these validation functions requires that parameter names containing array subscripts be
@@ -36,19 +37,41 @@
  *         sprintf(name, "pCreateInfo[%d].sType", i);
  *         validate_stype(name, pCreateInfo[i].sType);
  *
- * With the ParameterName class, a format string and a vector of format values are stored by the ParameterName object that is
+ * With the ParameterName class, a format string and a list of format values are stored by the ParameterName object that is
  * provided to the validation function.  String formatting is then performed only when the validation function retrieves the
  * name string from the ParameterName object:
- *         validate_stype(ParameterName("pCreateInfo[%i].sType", IndexVector{ i }), pCreateInfo[i].sType);
+ *         validate_stype(ParameterName("pCreateInfo[%i].sType", ParameterName::IndexVector{ i }), pCreateInfo[i].sType);
+ *
+ * The format string is referenced rather than copied and the index values are stored inline, so constructing a ParameterName
+ * never allocates; only get_name() does.
  */
 class ParameterName {
    public:
-    /// Container for index values to be used with parameter name string formatting.
-    typedef std::vector<size_t> IndexVector;
+    /// Maximum number of index values that can be used to format a parameter name.
+    static const size_t kMaxIndexCount = 4;
+
+    /// Fixed-capacity container for index values to be used with parameter name string formatting.
+    class IndexVector {
+       public:
+        IndexVector() : size_(0) {}
+
+        IndexVector(std::initializer_list<size_t> values) : size_(0) {
+            assert(values.size() <= kMaxIndexCount);
+            for (size_t value : values) {
+                if (size_ == kMaxIndexCount) break;
+                values_[size_++] = value;
+            }
+        }
 
-    /// Format specifier for the parameter name string, to be replaced by an index value.  The parameter name string must contain
-    /// one format specifier for each index value specified.
-    const std::string IndexFormatSpecifier = "%i";
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        const size_t *begin() const { return values_; }
+        const size_t *end() const { return values_ + size_; }
+
+       private:
+        size_t values_[kMaxIndexCount];
+        size_t size_;
+    };
 
    public:
     /**
@@ -60,37 +83,11 @@ class ParameterName {
      */
     ParameterName(const char *source) : source_(source) { assert(IsValid()); }
 
-    /**
-    * Construct a ParameterName object from a std::string object, without formatting.
-    *
-    * @param source Paramater name string without format specifiers.
-    *
-    * @pre The source string must not contain the %i format specifier.
-    */
-    ParameterName(const std::string &source) : source_(source) { assert(IsValid()); }
-
-    /**
-    * Construct a ParameterName object from a std::string object, without formatting.
-    *
-    * @param source Paramater name string without format specifiers.
-    *
-    * @pre The source string must not contain the %i format specifier.
-    */
-    ParameterName(const std::string &&source) : source_(std::move(source)) { assert(IsValid()); }
-
-    /**
-    * Construct a ParameterName object from a std::string object, with formatting.
-    *
-    * @param source Paramater name string with format specifiers.
-    * @param args Array index values to be used for formatting.
-    *
-    * @pre The number of %i format specifiers contained by the source string must match the number of elements contained
-    *      by the index vector.
-    */
-    ParameterName(const std::string &source, const IndexVector &args) : source_(source), args_(args) { assert(IsValid()); }
+    /// The source string is referenced rather than copied, so a std::string (often a temporary) can't be used.
+    ParameterName(const std::string &source) = delete;
 
     /**
-    * Construct a ParameterName object from a std::string object, with formatting.
+    * Construct a ParameterName object from a string literal, with formatting.
     *
     * @param source Paramater name string with format specifiers.
     * @param args Array index values to be used for formatting.
@@ -98,50 +95,53 @@ class ParameterName {
     * @pre The number of %i format specifiers contained by the source string must match the number of elements contained
     *      by the index vector.
     */
-    ParameterName(const std::string &&source, const IndexVector &&args) : source_(std::move(source)), args_(std::move(args)) {
-        assert(IsValid());
-    }
+    ParameterName(const char *source, const IndexVector &args) : source_(source), args_(args) { assert(IsValid()); }
 
     /// Retrive the formatted name string.
-    std::string get_name() const { return (args_.empty()) ? source_ : Format(); }
+    std::string get_name() const { return (args_.empty()) ? std::string(source_) : Format(); }
 
    private:
+    /// Format specifier for the parameter name string, to be replaced by an index value.  The parameter name string must contain
+    /// one format specifier for each index value specified.
+    static const char *IndexFormatSpecifier() { return "%i"; }
+
     /// Replace the %i format specifiers in the source string with the values from the index vector.
     std::string Format() const {
-        std::string::size_type current = 0;
-        std::string::size_type last = 0;
+        const size_t specifier_length = strlen(IndexFormatSpecifier());
+        const char *last = source_;
         std::stringstream format;
 
         for (size_t index : args_) {
-            current = source_.find(IndexFormatSpecifier, last);
-            if (current == std::string::npos) {
+            const char *current = strstr(last, IndexFormatSpecifier());
+            if (current == nullptr) {
                 break;
             }
-            format << source_.substr(last, (current - last)) << index;
-            last = current + IndexFormatSpecifier.length();
+            format.write(last, current - last);
+            format << index;
+            last = current + specifier_length;
         }
 
-        format << source_.substr(last, std::string::npos);
+        format << last;
 
         return format.str();
     }
 
     /// Check that the number of %i format specifiers in the source string matches the number of elements in the index vector.
-    bool IsValid() {
+    bool IsValid() const {
         // Count the number of occurances of the format specifier
         uint32_t count = 0;
-        std::string::size_type pos = source_.find(IndexFormatSpecifier);
+        const char *pos = strstr(source_, IndexFormatSpecifier());
 
-        while (pos != std::string::npos) {
+        while (pos != nullptr) {
             ++count;
-            pos = source_.find(IndexFormatSpecifier, pos + 1);
+            pos = strstr(pos + 1, IndexFormatSpecifier());
         }
 
         return (count == args_.size());
     }
 
    private:
-    std::string source_;  ///< Format string.
+    const char *source_;  ///< Format string.
     IndexVector args_;    ///< Array index values for formatting.
 };
 
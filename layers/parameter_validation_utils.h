@@ -74,6 +74,16 @@ const char LayerName[] = "ParameterValidation";
 // String returned by string_VkStructureType for an unrecognized type.
 const std::string UnsupportedStructureTypeString = "Unhandled VkStructureType";
 
+// Longest pNext chain validate_struct_pnext will walk
+const size_t kMaxPNextChainLength = 32;
+
+// Index returned by GetStructureTypeIndex for a VkStructureType that is not defined by the header.
+const uint32_t UnknownStructureTypeIndex = UINT32_MAX;
+
+// Map a VkStructureType to a dense index, used to key the per-struct pNext allowlist bitmasks.  Generated in
+// parameter_validation.h from the VkStructureType values in vk.xml.
+static inline uint32_t GetStructureTypeIndex(VkStructureType sType);
+
 // String returned by string_VkResult for an unrecognized type.
 const std::string UnsupportedResultString = "Unhandled VkResult";
 
@@ -462,17 +472,19 @@ static bool validate_string_array(debug_report_data *report_data, const char *ap
  * @param parameter_name Name of parameter being validated.
  * @param allowed_struct_names Names of allowed structs.
  * @param next Pointer to validate.
- * @param allowed_type_count Total number of allowed structure types.
- * @param allowed_types Array of strcuture types allowed for pNext.
+ * @param allowed_type_mask Bitmask of structure types allowed for pNext, indexed by GetStructureTypeIndex, or NULL if no
+ *        structure types are allowed.
  * @param header_version Version of header defining the pNext validation rules.
  * @return Boolean value indicating that the call should be skipped.
  */
 static bool validate_struct_pnext(debug_report_data *report_data, const char *api_name, const ParameterName &parameter_name,
-                                  const char *allowed_struct_names, const void *next, size_t allowed_type_count,
-                                  const VkStructureType *allowed_types, uint32_t header_version) {
+                                  const char *allowed_struct_names, const void *next, const uint64_t *allowed_type_mask,
+                                  uint32_t header_version) {
     bool skip_call = false;
-    std::unordered_set<const void *> cycle_check;
-    std::unordered_set<VkStructureType, std::hash<int>> unique_stype_check;
+    // Valid chains are short, so the cycle and duplicate checks scan small stack arrays rather than allocating hash sets
+    const void *visited[kMaxPNextChainLength];
+    VkStructureType visited_stypes[kMaxPNextChainLength];
+    size_t visited_count = 0;
 
     const char disclaimer[] =
         "This warning is based on the Valid Usage documentation for version %d of the Vulkan header.  It "
@@ -480,46 +492,34 @@ static bool validate_struct_pnext(debug_report_data *report_data, const char *ap
         "to a later version of the Vulkan header, in which case your use of %s is perfectly valid but "
         "is not guaranteed to work correctly with validation enabled";
 
-    // TODO: The valid pNext structure types are not recursive. Each structure has its own list of valid sTypes for pNext.
-    // Codegen a map of vectors containing the allowable pNext types for each struct and use that here -- also simplifies parms.
     if (next != NULL) {
-        if (allowed_type_count == 0) {
+        if (allowed_type_mask == NULL) {
             std::string message = "%s: value of %s must be NULL.  ";
             message += disclaimer;
             skip_call |= log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
                                  INVALID_STRUCT_PNEXT, LayerName, message.c_str(), api_name, parameter_name.get_name().c_str(),
                                  header_version, parameter_name.get_name().c_str());
         } else {
-            const VkStructureType *start = allowed_types;
-            const VkStructureType *end = allowed_types + allowed_type_count;
             const GenericHeader *current = reinterpret_cast<const GenericHeader *>(next);
 
-            cycle_check.insert(next);
-
+            visited[visited_count++] = next;
 
             while (current != NULL) {
-                if (cycle_check.find(current->pNext) != cycle_check.end()) {
-                    std::string message = "%s: %s chain contains a cycle -- pNext pointer " PRIx64 " is repeated.";
+                const VkStructureType *stypes_begin = visited_stypes;
+                const VkStructureType *stypes_end = stypes_begin + (visited_count - 1);
+                if (std::find(stypes_begin, stypes_end, current->sType) != stypes_end) {
                     skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                         __LINE__, INVALID_STRUCT_PNEXT, LayerName, message.c_str(), api_name,
-                                         parameter_name.get_name().c_str(), reinterpret_cast<uint64_t>(next));
-                    break;
-                } else {
-                    cycle_check.insert(current->pNext);
+                                         __LINE__, INVALID_STRUCT_PNEXT, LayerName,
+                                         "%s: %s chain contains duplicate structure types: %s appears multiple times.", api_name,
+                                         parameter_name.get_name().c_str(), string_VkStructureType(current->sType));
                 }
+                visited_stypes[visited_count - 1] = current->sType;
 
-                std::string type_name = string_VkStructureType(current->sType);
-                if (unique_stype_check.find(current->sType) != unique_stype_check.end()) {
-                    std::string message = "%s: %s chain contains duplicate structure types: %s appears multiple times.";
-                    skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                         __LINE__, INVALID_STRUCT_PNEXT, LayerName, message.c_str(), api_name,
-                                         parameter_name.get_name().c_str(), type_name.c_str());
-                } else {
-                    unique_stype_check.insert(current->sType);
-                }
-
-                if (std::find(start, end, current->sType) == end) {
-                    if (type_name == UnsupportedStructureTypeString) {
+                const uint32_t type_index = GetStructureTypeIndex(current->sType);
+                if (type_index == UnknownStructureTypeIndex ||
+                    !(allowed_type_mask[type_index / 64] & (1ull << (type_index % 64)))) {
+                    const char *type_name = string_VkStructureType(current->sType);
+                    if (UnsupportedStructureTypeString == type_name) {
                         std::string message =
                             "%s: %s chain includes a structure with unexpected VkStructureType (%d); Allowed "
                             "structures are [%s].  ";
@@ -534,9 +534,29 @@ static bool validate_struct_pnext(debug_report_data *report_data, const char *ap
                         message += disclaimer;
                         skip_call |= log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT,
                                              0, __LINE__, INVALID_STRUCT_PNEXT, LayerName, message.c_str(), api_name,
-                                             parameter_name.get_name().c_str(), type_name.c_str(), allowed_struct_names,
-                                             header_version, parameter_name.get_name().c_str());
+                                             parameter_name.get_name().c_str(), type_name, allowed_struct_names, header_version,
+                                             parameter_name.get_name().c_str());
+                    }
+                }
+
+                if (current->pNext != NULL) {
+                    if (std::find(visited, visited + visited_count, current->pNext) != visited + visited_count) {
+                        skip_call |= log_msg(
+                            report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
+                            INVALID_STRUCT_PNEXT, LayerName,
+                            "%s: %s chain contains a cycle -- pNext pointer 0x%" PRIx64 " is repeated.", api_name,
+                            parameter_name.get_name().c_str(), reinterpret_cast<uint64_t>(current->pNext));
+                        break;
+                    } else if (visited_count == kMaxPNextChainLength) {
+                        skip_call |= log_msg(
+                            report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
+                            INVALID_STRUCT_PNEXT, LayerName,
+                            "%s: %s chain has more than %d structures; only the first %d were validated.", api_name,
+                            parameter_name.get_name().c_str(), static_cast<int>(kMaxPNextChainLength),
+                            static_cast<int>(kMaxPNextChainLength));
+                        break;
                     }
+                    visited[visited_count++] = current->pNext;
                 }
                 current = reinterpret_cast<const GenericHeader *>(current->pNext);
             }
@@ -33,6 +33,7 @@
 #include "vk_dispatch_table_helper.h"
 #include "vk_enum_string_helper.h"
 #include "vk_layer_data.h"
+#include "vk_layer_command_table.h"
 #include "vk_layer_utils.h"
 
 #include "thread_check.h"
@@ -202,9 +203,9 @@ static const VkLayerProperties layerProps = {
 };
 
 static inline PFN_vkVoidFunction layer_intercept_proc(const char *name) {
-    for (unsigned int i = 0; i < sizeof(procmap) / sizeof(procmap[0]); i++) {
-        if (!strcmp(name, procmap[i].name)) return procmap[i].pFunc;
-    }
+    static const auto intercepts = MakeCommandTable(procmap);
+    auto entry = intercepts.find(LookupVulkanCommand(name));
+    if (entry) return entry->pFunc;
     return NULL;
 }
 
@@ -373,8 +374,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(VkDevice device, const VkC
     // Record mapping from command buffer to command pool
     if (VK_SUCCESS == result) {
         for (uint32_t index = 0; index < pAllocateInfo->commandBufferCount; index++) {
-            std::lock_guard<std::mutex> lock(command_pool_lock);
-            command_pool_map[pCommandBuffers[index]] = pAllocateInfo->commandPool;
+            setCommandPool(pCommandBuffers[index], pAllocateInfo->commandPool);
         }
     }
 
@@ -421,8 +421,7 @@ VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandPool com
         // These updates need to be done before calling down to the driver.
         for (uint32_t index = 0; index < commandBufferCount; index++) {
             finishWriteObject(my_data, pCommandBuffers[index], lockCommandPool);
-            std::lock_guard<std::mutex> lock(command_pool_lock);
-            command_pool_map.erase(pCommandBuffers[index]);
+            eraseCommandPool(pCommandBuffers[index]);
         }
     }
 
@@ -68,84 +68,53 @@ inline bool startMultiThread() {
 inline void finishMultiThread() { vulkan_in_use = false; }
 }  // namespace threading
 
+// Tracking data is split across stripes, each with its own lock, so that threads using different objects rarely contend.
+static const uint32_t kCounterStripeBits = 5;
+static const uint32_t kCounterStripeCount = 1u << kCounterStripeBits;
+
+// Spread handles (pointers or 64-bit values, both with clustered low bits) across the stripes
+static inline uint32_t counterStripeIndex(uint64_t handle) {
+    return static_cast<uint32_t>((handle * 0x9E3779B97F4A7C15ULL) >> (64 - kCounterStripeBits));
+}
+
 template <typename T>
 class counter {
    public:
     const char *typeName;
     VkDebugReportObjectTypeEXT objectType;
-    std::unordered_map<T, object_use_data> uses;
-    std::mutex counter_lock;
-    std::condition_variable counter_condition;
+
     void startWrite(debug_report_data *report_data, T object) {
         if (object == VK_NULL_HANDLE) {
             return;
         }
         bool skipCall = false;
         loader_platform_thread_id tid = loader_platform_get_thread_id();
-        std::unique_lock<std::mutex> lock(counter_lock);
-        if (uses.find(object) == uses.end()) {
+        stripe &s = getStripe(object);
+        std::unique_lock<std::mutex> lock(s.lock);
+        tracked_use *use_data = s.find(object);
+        if (!use_data) {
             // There is no current use of the object.  Record writer thread.
-            struct object_use_data *use_data = &uses[object];
-            use_data->reader_count = 0;
-            use_data->writer_count = 1;
-            use_data->thread = tid;
-        } else {
-            struct object_use_data *use_data = &uses[object];
-            if (use_data->reader_count == 0) {
-                // There are no readers.  Two writers just collided.
-                if (use_data->thread != tid) {
-                    skipCall |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object), 0,
-                                        THREADING_CHECKER_MULTIPLE_THREADS, "THREADING",
-                                        "THREADING ERROR : object of type %s is simultaneously used in thread %ld and thread %ld",
-                                        typeName, use_data->thread, tid);
-                    if (skipCall) {
-                        // Wait for thread-safe access to object instead of skipping call.
-                        while (uses.find(object) != uses.end()) {
-                            counter_condition.wait(lock);
-                        }
-                        // There is now no current use of the object.  Record writer thread.
-                        struct object_use_data *new_use_data = &uses[object];
-                        new_use_data->thread = tid;
-                        new_use_data->reader_count = 0;
-                        new_use_data->writer_count = 1;
-                    } else {
-                        // Continue with an unsafe use of the object.
-                        use_data->thread = tid;
-                        use_data->writer_count += 1;
-                    }
-                } else {
-                    // This is either safe multiple use in one call, or recursive use.
-                    // There is no way to make recursion safe.  Just forge ahead.
-                    use_data->writer_count += 1;
-                }
+            s.insert(object, tid, 0, 1);
+        } else if (use_data->thread != tid) {
+            // This writer collided with readers or another writer in a different thread.
+            skipCall |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object), 0,
+                                THREADING_CHECKER_MULTIPLE_THREADS, "THREADING",
+                                "THREADING ERROR : object of type %s is simultaneously used in thread %ld and thread %ld",
+                                typeName, use_data->thread, tid);
+            if (skipCall) {
+                // Wait for thread-safe access to object instead of skipping call.
+                s.waitUntilUnused(lock, object);
+                // There is now no current use of the object.  Record writer thread.
+                s.insert(object, tid, 0, 1);
             } else {
-                // There are readers.  This writer collided with them.
-                if (use_data->thread != tid) {
-                    skipCall |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object), 0,
-                                        THREADING_CHECKER_MULTIPLE_THREADS, "THREADING",
-                                        "THREADING ERROR : object of type %s is simultaneously used in thread %ld and thread %ld",
-                                        typeName, use_data->thread, tid);
-                    if (skipCall) {
-                        // Wait for thread-safe access to object instead of skipping call.
-                        while (uses.find(object) != uses.end()) {
-                            counter_condition.wait(lock);
-                        }
-                        // There is now no current use of the object.  Record writer thread.
-                        struct object_use_data *new_use_data = &uses[object];
-                        new_use_data->thread = tid;
-                        new_use_data->reader_count = 0;
-                        new_use_data->writer_count = 1;
-                    } else {
-                        // Continue with an unsafe use of the object.
-                        use_data->thread = tid;
-                        use_data->writer_count += 1;
-                    }
-                } else {
-                    // This is either safe multiple use in one call, or recursive use.
-                    // There is no way to make recursion safe.  Just forge ahead.
-                    use_data->writer_count += 1;
-                }
+                // Continue with an unsafe use of the object.
+                use_data->thread = tid;
+                use_data->writer_count += 1;
             }
+        } else {
+            // This is either safe multiple use in one call, or recursive use.
+            // There is no way to make recursion safe.  Just forge ahead.
+            use_data->writer_count += 1;
         }
     }
 
@@ -154,14 +123,12 @@ class counter {
             return;
         }
         // Object is no longer in use
-        std::unique_lock<std::mutex> lock(counter_lock);
-        uses[object].writer_count -= 1;
-        if ((uses[object].reader_count == 0) && (uses[object].writer_count == 0)) {
-            uses.erase(object);
-        }
-        // Notify any waiting threads that this object may be safe to use
-        lock.unlock();
-        counter_condition.notify_all();
+        stripe &s = getStripe(object);
+        std::unique_lock<std::mutex> lock(s.lock);
+        tracked_use *use_data = s.find(object);
+        if (!use_data) return;
+        use_data->writer_count -= 1;
+        s.releaseIfUnused(lock, use_data);
     }
 
     void startRead(debug_report_data *report_data, T object) {
@@ -170,54 +137,101 @@ class counter {
         }
         bool skipCall = false;
         loader_platform_thread_id tid = loader_platform_get_thread_id();
-        std::unique_lock<std::mutex> lock(counter_lock);
-        if (uses.find(object) == uses.end()) {
+        stripe &s = getStripe(object);
+        std::unique_lock<std::mutex> lock(s.lock);
+        tracked_use *use_data = s.find(object);
+        if (!use_data) {
             // There is no current use of the object.  Record reader count
-            struct object_use_data *use_data = &uses[object];
-            use_data->reader_count = 1;
-            use_data->writer_count = 0;
-            use_data->thread = tid;
-        } else if (uses[object].writer_count > 0 && uses[object].thread != tid) {
+            s.insert(object, tid, 1, 0);
+        } else if (use_data->writer_count > 0 && use_data->thread != tid) {
             // There is a writer of the object.
             skipCall |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object), 0,
                                 THREADING_CHECKER_MULTIPLE_THREADS, "THREADING",
                                 "THREADING ERROR : object of type %s is simultaneously used in thread %ld and thread %ld", typeName,
-                                uses[object].thread, tid);
+                                use_data->thread, tid);
             if (skipCall) {
                 // Wait for thread-safe access to object instead of skipping call.
-                while (uses.find(object) != uses.end()) {
-                    counter_condition.wait(lock);
-                }
+                s.waitUntilUnused(lock, object);
                 // There is no current use of the object.  Record reader count
-                struct object_use_data *use_data = &uses[object];
-                use_data->reader_count = 1;
-                use_data->writer_count = 0;
-                use_data->thread = tid;
+                s.insert(object, tid, 1, 0);
             } else {
-                uses[object].reader_count += 1;
+                use_data->reader_count += 1;
             }
         } else {
             // There are other readers of the object.  Increase reader count
-            uses[object].reader_count += 1;
+            use_data->reader_count += 1;
         }
     }
     void finishRead(T object) {
         if (object == VK_NULL_HANDLE) {
             return;
         }
-        std::unique_lock<std::mutex> lock(counter_lock);
-        uses[object].reader_count -= 1;
-        if ((uses[object].reader_count == 0) && (uses[object].writer_count == 0)) {
-            uses.erase(object);
-        }
-        // Notify any waiting threads that this object may be safe to use
-        lock.unlock();
-        counter_condition.notify_all();
+        stripe &s = getStripe(object);
+        std::unique_lock<std::mutex> lock(s.lock);
+        tracked_use *use_data = s.find(object);
+        if (!use_data) return;
+        use_data->reader_count -= 1;
+        s.releaseIfUnused(lock, use_data);
     }
     counter(const char *name = "", VkDebugReportObjectTypeEXT type = VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT) {
         typeName = name;
         objectType = type;
     }
+
+   private:
+    // An in-use object and its use counts
+    struct tracked_use : object_use_data {
+        T object;
+    };
+
+    // Objects of one stripe that are currently in use. Only objects inside a Vulkan call are tracked, so the list is short
+    // and a linear scan over a vector (which keeps its capacity) beats hashing and allocating map nodes on every call.
+    struct stripe {
+        std::mutex lock;
+        std::vector<tracked_use> uses;
+        // Threads blocked in waitUntilUnused(); finishing a use only signals the condition when this is non-zero.
+        uint32_t waiters = 0;
+        std::condition_variable condition;
+
+        tracked_use *find(T object) {
+            for (auto &use : uses) {
+                if (use.object == object) return &use;
+            }
+            return nullptr;
+        }
+
+        void insert(T object, loader_platform_thread_id tid, int reader_count, int writer_count) {
+            tracked_use use;
+            use.thread = tid;
+            use.reader_count = reader_count;
+            use.writer_count = writer_count;
+            use.object = object;
+            uses.push_back(use);
+        }
+
+        void releaseIfUnused(std::unique_lock<std::mutex> &lock, tracked_use *use) {
+            if (use->reader_count != 0 || use->writer_count != 0) return;
+            *use = uses.back();
+            uses.pop_back();
+            if (waiters) {
+                // Notify any waiting threads that this object may be safe to use
+                lock.unlock();
+                condition.notify_all();
+            }
+        }
+
+        void waitUntilUnused(std::unique_lock<std::mutex> &lock, T object) {
+            ++waiters;
+            while (find(object)) {
+                condition.wait(lock);
+            }
+            --waiters;
+        }
+    };
+
+    stripe &getStripe(T object) { return stripes[counterStripeIndex((uint64_t)(object))]; }
+
+    stripe stripes[kCounterStripeCount];
 };
 
 struct layer_data {
@@ -361,40 +375,57 @@ WRAPPER(uint64_t)
 #endif  // DISTINCT_NONDISPATCHABLE_HANDLES
 
 static std::unordered_map<void *, layer_data *> layer_data_map;
-static std::mutex command_pool_lock;
-static std::unordered_map<VkCommandBuffer, VkCommandPool> command_pool_map;
+
+// Mapping from command buffer to the pool it was allocated from, striped like counter<T> since every command buffer use
+// looks up its pool.
+struct command_pool_stripe {
+    std::mutex lock;
+    std::unordered_map<VkCommandBuffer, VkCommandPool> pools;
+};
+static command_pool_stripe command_pool_map[kCounterStripeCount];
+
+static command_pool_stripe &getCommandPoolStripe(VkCommandBuffer object) {
+    return command_pool_map[counterStripeIndex((uint64_t)(object))];
+}
+
+static void setCommandPool(VkCommandBuffer object, VkCommandPool pool) {
+    command_pool_stripe &s = getCommandPoolStripe(object);
+    std::lock_guard<std::mutex> lock(s.lock);
+    s.pools[object] = pool;
+}
+
+static void eraseCommandPool(VkCommandBuffer object) {
+    command_pool_stripe &s = getCommandPoolStripe(object);
+    std::lock_guard<std::mutex> lock(s.lock);
+    s.pools.erase(object);
+}
+
+static VkCommandPool getCommandPool(VkCommandBuffer object) {
+    command_pool_stripe &s = getCommandPoolStripe(object);
+    std::lock_guard<std::mutex> lock(s.lock);
+    auto it = s.pools.find(object);
+    return it == s.pools.end() ? VK_NULL_HANDLE : it->second;
+}
 
 // VkCommandBuffer needs check for implicit use of command pool
 static void startWriteObject(struct layer_data *my_data, VkCommandBuffer object, bool lockPool = true) {
     if (lockPool) {
-        std::unique_lock<std::mutex> lock(command_pool_lock);
-        VkCommandPool pool = command_pool_map[object];
-        lock.unlock();
-        startWriteObject(my_data, pool);
+        startWriteObject(my_data, getCommandPool(object));
     }
     my_data->c_VkCommandBuffer.startWrite(my_data->report_data, object);
 }
 static void finishWriteObject(struct layer_data *my_data, VkCommandBuffer object, bool lockPool = true) {
     my_data->c_VkCommandBuffer.finishWrite(object);
     if (lockPool) {
-        std::unique_lock<std::mutex> lock(command_pool_lock);
-        VkCommandPool pool = command_pool_map[object];
-        lock.unlock();
-        finishWriteObject(my_data, pool);
+        finishWriteObject(my_data, getCommandPool(object));
     }
 }
 static void startReadObject(struct layer_data *my_data, VkCommandBuffer object) {
-    std::unique_lock<std::mutex> lock(command_pool_lock);
-    VkCommandPool pool = command_pool_map[object];
-    lock.unlock();
-    startReadObject(my_data, pool);
+    startReadObject(my_data, getCommandPool(object));
     my_data->c_VkCommandBuffer.startRead(my_data->report_data, object);
 }
 static void finishReadObject(struct layer_data *my_data, VkCommandBuffer object) {
     my_data->c_VkCommandBuffer.finishRead(object);
-    std::unique_lock<std::mutex> lock(command_pool_lock);
-    VkCommandPool pool = command_pool_map[object];
-    lock.unlock();
-    finishReadObject(my_data, pool);
+    finishReadObject(my_data, getCommandPool(object));
 }
 #endif  // THREADING_H
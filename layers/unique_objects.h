@@ -25,14 +25,164 @@
 #include "vk_safe_struct.h"
 #include "vk_layer_utils.h"
 #include "device_extensions.h"
-#include "mutex"
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
 
 #pragma once
 
 namespace unique_objects {
 
-// All increments must be guarded by global_lock
-static uint64_t global_unique_id = 1;
+// Maps the unique IDs handed out by this layer to the real handles below it. IDs encode where their handle lives:
+//
+//   bits 0-31   slot index + 1 (so an ID is never VK_NULL_HANDLE)
+//   bits 32-47  generation of the slot, bumped whenever the slot is freed
+//   bits 48-63  serial number of the table, which no other live table has, so an ID passed to the wrong instance or device
+//               isn't found there. A table may reuse the serial of one destroyed earlier.
+//
+// Slots live in fixed-size slabs, found through a two-level directory, that are never moved or freed while the table exists,
+// so Lookup() is a few array indexing steps and needs no lock. The directory covers the whole 32-bit index space, so the table
+// grows until memory runs out. Insert() and Erase() must be serialized by the caller (global_lock).
+class HandleTable {
+   public:
+    HandleTable() : serial_(AcquireSerial()), next_index_(0), free_head_(kNoFreeSlot) {
+        for (auto &directory : directories_) directory.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ~HandleTable() {
+        for (auto &directory : directories_) {
+            std::atomic<Slot *> *slabs = directory.load(std::memory_order_relaxed);
+            if (!slabs) continue;
+            for (uint32_t i = 0; i < kSlabsPerDirectory; ++i) delete[] slabs[i].load(std::memory_order_relaxed);
+            delete[] slabs;
+        }
+        ReleaseSerial(serial_);
+    }
+
+    // Returns a new unique ID for handle, which is never 0. Throws std::bad_alloc if the table can't grow, like any other
+    // allocation failure.
+    uint64_t Insert(uint64_t handle) {
+        uint32_t index;
+        if (free_head_ != kNoFreeSlot) {
+            index = free_head_;
+            free_head_ = GetSlot(index).next_free;
+        } else {
+            // The last index is never used, as index + 1 must fit in an ID's low 32 bits
+            if (next_index_ == kNoFreeSlot) throw std::bad_alloc();
+            index = next_index_++;
+            if ((index & (kSlabSize - 1)) == 0) AddSlab(index);
+        }
+        Slot &slot = GetSlot(index);
+        slot.handle.store(handle, std::memory_order_relaxed);
+        return MakeId(index, slot.generation.load(std::memory_order_relaxed));
+    }
+
+    // Returns the handle for id, or 0 if id isn't a live ID from this table
+    uint64_t Lookup(uint64_t id) const {
+        Slot *slot = FindSlot(id);
+        return slot ? slot->handle.load(std::memory_order_relaxed) : 0;
+    }
+
+    bool Contains(uint64_t id) const { return FindSlot(id) != nullptr; }
+
+    // Frees id's slot and returns the handle it mapped to, or 0 if id isn't a live ID from this table
+    uint64_t Erase(uint64_t id) {
+        Slot *slot = FindSlot(id);
+        if (!slot) return 0;
+        uint64_t handle = slot->handle.load(std::memory_order_relaxed);
+        slot->handle.store(0, std::memory_order_relaxed);
+        slot->generation.store((slot->generation.load(std::memory_order_relaxed) + 1) & kGenerationMask, std::memory_order_relaxed);
+        slot->next_free = free_head_;
+        free_head_ = static_cast<uint32_t>(id & 0xFFFFFFFF) - 1;
+        return handle;
+    }
+
+   private:
+    static const uint32_t kSlabBits = 12;
+    static const uint32_t kSlabSize = 1u << kSlabBits;
+    static const uint32_t kSlabsPerDirectoryBits = 10;
+    static const uint32_t kSlabsPerDirectory = 1u << kSlabsPerDirectoryBits;
+    static const uint32_t kDirectoryShift = kSlabBits + kSlabsPerDirectoryBits;
+    static const uint32_t kDirectoryCount = 1u << (32 - kDirectoryShift);
+    static const uint32_t kGenerationMask = 0xFFFF;
+    static const uint32_t kNoFreeSlot = 0xFFFFFFFF;
+    static const uint32_t kSerialCount = 0x10000;
+
+    struct Slot {
+        std::atomic<uint64_t> handle;
+        std::atomic<uint32_t> generation;
+        uint32_t next_free;  // Only valid while the slot is on the free list
+    };
+
+    uint64_t MakeId(uint32_t index, uint32_t generation) const {
+        return (static_cast<uint64_t>(serial_) << 48) | (static_cast<uint64_t>(generation) << 32) | (index + 1);
+    }
+
+    // Allocate the slab starting at index, and the directory holding it if this is its first slab
+    void AddSlab(uint32_t index) {
+        std::atomic<std::atomic<Slot *> *> &directory_entry = directories_[index >> kDirectoryShift];
+        std::atomic<Slot *> *slabs = directory_entry.load(std::memory_order_relaxed);
+        if (!slabs) {
+            slabs = new std::atomic<Slot *>[kSlabsPerDirectory]();
+            directory_entry.store(slabs, std::memory_order_release);
+        }
+        slabs[(index >> kSlabBits) & (kSlabsPerDirectory - 1)].store(new Slot[kSlabSize](), std::memory_order_release);
+    }
+
+    Slot &GetSlot(uint32_t index) {
+        std::atomic<Slot *> *slabs = directories_[index >> kDirectoryShift].load(std::memory_order_relaxed);
+        return slabs[(index >> kSlabBits) & (kSlabsPerDirectory - 1)].load(std::memory_order_relaxed)[index & (kSlabSize - 1)];
+    }
+
+    Slot *FindSlot(uint64_t id) const {
+        uint32_t low = static_cast<uint32_t>(id & 0xFFFFFFFF);
+        if ((id >> 48) != serial_ || low == 0) return nullptr;
+        uint32_t index = low - 1;
+        std::atomic<Slot *> *slabs = directories_[index >> kDirectoryShift].load(std::memory_order_acquire);
+        if (!slabs) return nullptr;
+        Slot *slab = slabs[(index >> kSlabBits) & (kSlabsPerDirectory - 1)].load(std::memory_order_acquire);
+        if (!slab) return nullptr;
+        Slot *slot = &slab[index & (kSlabSize - 1)];
+        if (slot->generation.load(std::memory_order_relaxed) != ((id >> 32) & kGenerationMask)) return nullptr;
+        return slot;
+    }
+
+    // Serial 0 is never used, so that pointers (dispatchable handles) passed to Lookup() are never mistaken for IDs. Once the
+    // counter wraps, serials still held by live tables are skipped; only with every serial in use is one shared.
+    static uint16_t AcquireSerial() {
+        std::lock_guard<std::mutex> lock(SerialLock());
+        std::vector<bool> &in_use = SerialsInUse();
+        static uint16_t next_serial = 1;
+        uint16_t serial = next_serial;
+        for (uint32_t tries = 0; tries < kSerialCount && (serial == 0 || in_use[serial]); ++tries) serial++;
+        if (serial == 0) serial = 1;
+        in_use[serial] = true;
+        next_serial = serial + 1;
+        return serial;
+    }
+
+    static void ReleaseSerial(uint16_t serial) {
+        std::lock_guard<std::mutex> lock(SerialLock());
+        SerialsInUse()[serial] = false;
+    }
+
+    static std::mutex &SerialLock() {
+        static std::mutex lock;
+        return lock;
+    }
+
+    static std::vector<bool> &SerialsInUse() {
+        static std::vector<bool> in_use(kSerialCount);
+        return in_use;
+    }
+
+    const uint16_t serial_;
+    std::atomic<std::atomic<Slot *> *> directories_[kDirectoryCount];
+    // Writer-side allocation state, guarded by global_lock
+    uint32_t next_index_;  // Lowest index never handed out
+    uint32_t free_head_;
+};
 
 struct TEMPLATE_STATE {
     VkDescriptorUpdateTemplateKHR desc_update_template;
@@ -55,7 +205,7 @@ struct instance_layer_data {
     VkDebugReportCallbackCreateInfoEXT *tmp_dbg_create_infos;
     VkDebugReportCallbackEXT *tmp_callbacks;
 
-    std::unordered_map<uint64_t, uint64_t> unique_id_mapping;  // Map uniqueID to actual object handle
+    HandleTable unique_id_mapping;  // Map uniqueID to actual object handle
 
     InstanceExtensions extensions = {};
 };
@@ -69,7 +219,7 @@ struct layer_data {
     std::unordered_map<uint64_t, std::unique_ptr<TEMPLATE_STATE>> desc_template_map;
 
     bool wsi_enabled;
-    std::unordered_map<uint64_t, uint64_t> unique_id_mapping;  // Map uniqueID to actual object handle
+    HandleTable unique_id_mapping;  // Map uniqueID to actual object handle
     VkPhysicalDevice gpu;
 
     layer_data() : wsi_enabled(false), gpu(VK_NULL_HANDLE){};
@@ -78,7 +228,7 @@ struct layer_data {
 static std::unordered_map<void *, instance_layer_data *> instance_layer_data_map;
 static std::unordered_map<void *, layer_data *> layer_data_map;
 
-static std::mutex global_lock;  // Protect map accesses and unique_id increments
+static std::mutex global_lock;  // Serializes handle wrapping/unwrapping bookkeeping other than HandleTable::Lookup()
 
 struct GenericHeader {
     VkStructureType sType;
@@ -104,20 +254,17 @@ bool ContainsExtStruct(const T *target, VkStructureType ext_type) {
 
 
 /* Unwrap a handle. */
-// must hold lock!
+// Lock-free; the handle must not be destroyed concurrently, which the application has to guarantee anyway.
 template<typename HandleType, typename MapType>
 HandleType Unwrap(MapType *layer_data, HandleType wrappedHandle) {
-    // TODO: don't use operator[] here.
-    return (HandleType)layer_data->unique_id_mapping[reinterpret_cast<uint64_t const &>(wrappedHandle)];
+    return (HandleType)layer_data->unique_id_mapping.Lookup(reinterpret_cast<uint64_t const &>(wrappedHandle));
 }
 
 /* Wrap a newly created handle with a new unique ID, and return the new ID. */
 // must hold lock!
 template<typename HandleType, typename MapType>
 HandleType WrapNew(MapType *layer_data, HandleType newlyCreatedHandle) {
-    auto unique_id = global_unique_id++;
-    layer_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t const &>(newlyCreatedHandle);
-    return (HandleType)unique_id;
+    return (HandleType)layer_data->unique_id_mapping.Insert(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
 }
 
 }  // namespace unique_objects
@@ -0,0 +1,59 @@
+/* Copyright (c) 2015-2017 The Khronos Group Inc.
+ * Copyright (c) 2015-2017 Valve Corporation
+ * Copyright (c) 2015-2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LAYER_COMMAND_TABLE_H
+#define LAYER_COMMAND_TABLE_H
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "vk_command_name_hash.h"
+
+// Index over a static intercept table of { const char *name; ... } entries, keyed by VulkanCommand.
+// GetProcAddr implementations hash the requested name once with LookupVulkanCommand() and then
+// resolve it against each of their tables in constant time instead of walking them with strcmp.
+template <typename ENTRY_T, size_t N>
+class CommandTable {
+   public:
+    explicit CommandTable(const ENTRY_T (&entries)[N]) : entries_(entries) {
+        static_assert(N < kNoEntry, "intercept table too large for CommandTable");
+        for (uint32_t i = 0; i < kVulkanCommandCount; ++i) positions_[i] = kNoEntry;
+        // Walk backwards so that the first entry for a name wins, matching a linear scan
+        for (size_t i = N; i-- > 0;) {
+            const VulkanCommand command = LookupVulkanCommand(entries[i].name);
+            assert(command != kVulkanCommandUnknown);
+            if (command != kVulkanCommandUnknown) positions_[command] = static_cast<uint16_t>(i);
+        }
+    }
+
+    const ENTRY_T *find(VulkanCommand command) const {
+        if (command >= kVulkanCommandCount || positions_[command] == kNoEntry) return nullptr;
+        return &entries_[positions_[command]];
+    }
+
+   private:
+    static const uint16_t kNoEntry = 0xFFFF;
+    const ENTRY_T *entries_;
+    uint16_t positions_[kVulkanCommandCount];
+};
+
+template <typename ENTRY_T, size_t N>
+CommandTable<ENTRY_T, N> MakeCommandTable(const ENTRY_T (&entries)[N]) {
+    return CommandTable<ENTRY_T, N>(entries);
+}
+
+#endif  // LAYER_COMMAND_TABLE_H
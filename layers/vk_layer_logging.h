@@ -32,6 +32,7 @@
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -50,6 +51,40 @@ static inline bool debug_report_log_msg(const debug_report_data *debug_data, VkF
                                         VkDebugReportObjectTypeEXT objectType, uint64_t srcObject, size_t location, int32_t msgCode,
                                         const char *pLayerPrefix, const char *pMsg);
 
+// Asynchronous log file sink selected by <LayerIdentifier>.log_async (see vk_layer_utils.cpp). The sink is owned by the
+// callback node's pUserData and is flushed and released when the node is removed.
+VK_LAYER_EXPORT VKAPI_ATTR VkBool32 VKAPI_CALL async_log_callback(VkFlags msgFlags, VkDebugReportObjectTypeEXT objType,
+                                                                  uint64_t srcObject, size_t location, int32_t msgCode,
+                                                                  const char *pLayerPrefix, const char *pMsg, void *pUserData);
+VK_LAYER_EXPORT void async_log_release(void *pUserData);
+
+// A message held back by log_msg rather than passed to the callbacks when it was logged
+struct debug_report_deferred_message {
+    const debug_report_data *debug_data;
+    VkFlags msgFlags;
+    VkDebugReportObjectTypeEXT objectType;
+    uint64_t srcObject;
+    size_t location;
+    int32_t msgCode;
+    std::string layer_prefix;
+    std::string message;
+};
+typedef std::vector<debug_report_deferred_message> debug_report_deferred_messages;
+
+// While a thread has a deferred message list set, log_msg on that thread appends to it and returns false instead of calling
+// the callbacks, so that work spread over helper threads can have its messages delivered later from the calling thread, in
+// the order the application would see them if the work had been done serially. Pass null to deliver messages again.
+VK_LAYER_EXPORT void debug_report_set_thread_deferral(debug_report_deferred_messages *messages);
+VK_LAYER_EXPORT debug_report_deferred_messages *debug_report_get_thread_deferral();
+
+// Free a debug message callback node, releasing any sink it owns
+static inline void FreeDebugMessageCallbackNode(VkLayerDbgFunctionNode *node) {
+    if (node->pfnMsgCallback == async_log_callback) {
+        async_log_release(node->pUserData);
+    }
+    free(node);
+}
+
 // Add a debug message callback node structure to the specified callback linked list
 static inline void AddDebugMessageCallback(debug_report_data *debug_data, VkLayerDbgFunctionNode **list_head,
                                            VkLayerDbgFunctionNode *new_node) {
@@ -82,7 +117,7 @@ static inline void RemoveDebugMessageCallback(debug_report_data *debug_data, VkL
         prev_callback = cur_callback;
         cur_callback = cur_callback->pNext;
         if (matched) {
-            free(prev_callback);
+            FreeDebugMessageCallbackNode(prev_callback);
         }
     }
     debug_data->active_flags = local_flags;
@@ -98,7 +133,7 @@ static inline void RemoveAllMessageCallbacks(debug_report_data *debug_data, VkLa
         debug_report_log_msg(debug_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEBUG_REPORT_EXT,
                              (uint64_t)current_callback->msgCallback, 0, VK_DEBUG_REPORT_ERROR_CALLBACK_REF_EXT, "DebugReport",
                              "Debug Report callbacks not removed before DestroyInstance");
-        free(current_callback);
+        FreeDebugMessageCallbackNode(current_callback);
         current_callback = prev_callback;
     }
     *list_head = NULL;
@@ -337,17 +372,45 @@ static inline bool log_msg(const debug_report_data *debug_data, VkFlags msgFlags
         return false;
     }
 
+    // Most messages fit in a stack buffer; only fall back to a heap allocation for long ones
+    char local_str[1024];
+    char *str = local_str;
     va_list argptr;
     va_start(argptr, format);
-    char *str;
-    if (-1 == vasprintf(&str, format, argptr)) {
-        // On failure, glibc vasprintf leaves str undefined
-        str = nullptr;
+    va_list argcopy;
+    va_copy(argcopy, argptr);
+    int length = vsnprintf(local_str, sizeof(local_str), format, argcopy);
+    va_end(argcopy);
+    if (length < 0 || length >= (int)sizeof(local_str)) {
+        if (-1 == vasprintf(&str, format, argptr)) {
+            // On failure, glibc vasprintf leaves str undefined
+            str = nullptr;
+        }
     }
     va_end(argptr);
-    bool result = debug_report_log_msg(debug_data, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix,
-                                       str ? str : "Allocation failure");
-    free(str);
+    bool result = false;
+    debug_report_deferred_messages *deferred = debug_report_get_thread_deferral();
+    if (deferred) {
+        deferred->push_back({debug_data, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix,
+                             str ? str : "Allocation failure"});
+    } else {
+        result = debug_report_log_msg(debug_data, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix,
+                                      str ? str : "Allocation failure");
+    }
+    if (str != local_str) {
+        free(str);
+    }
+    return result;
+}
+
+// Pass messages deferred by log_msg to the callbacks in the order they were logged. Returns true if any callback asked for the
+// call to be skipped, as log_msg would have.
+static inline bool debug_report_deliver_deferred(const debug_report_deferred_messages &messages) {
+    bool result = false;
+    for (const auto &message : messages) {
+        result |= debug_report_log_msg(message.debug_data, message.msgFlags, message.objectType, message.srcObject,
+                                       message.location, message.msgCode, message.layer_prefix.c_str(), message.message.c_str());
+    }
     return result;
 }
 
@@ -0,0 +1,130 @@
+/* Copyright (c) 2015-2017 The Khronos Group Inc.
+ * Copyright (c) 2015-2017 Valve Corporation
+ * Copyright (c) 2015-2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LAYER_NODE_POOL_H
+#define LAYER_NODE_POOL_H
+
+#include <stddef.h>
+#include <new>
+#include <vector>
+
+// Recycling arena for the small blocks that node-based containers (std::unordered_map, std::unordered_set, ...) allocate
+// per element. A freed block goes onto the free list for its size class rather than back to the heap, so a container that
+// is cleared and refilled to a similar size doesn't touch the heap after its first fill. Blocks are carved out of chunks
+// that are only released with the pool; requests larger than kMaxBlockSize, such as bucket arrays, go straight to the heap.
+// Not thread safe, and the pool must outlive every container allocating from it.
+class NodePool {
+   public:
+    NodePool() : chunk_next_(nullptr), chunk_end_(nullptr), next_chunk_size_(kMinChunkSize) {
+        for (auto &free_list : free_lists_) free_list = nullptr;
+    }
+    ~NodePool() {
+        for (auto chunk : chunks_) ::operator delete(chunk);
+    }
+
+    void *Allocate(size_t bytes) {
+        if (bytes > kMaxBlockSize) return ::operator new(bytes);
+        const size_t size_class = SizeClass(bytes);
+        FreeBlock *block = free_lists_[size_class];
+        if (block) {
+            free_lists_[size_class] = block->next;
+            return block;
+        }
+        const size_t block_size = (size_class + 1) * kGranularity;
+        if (static_cast<size_t>(chunk_end_ - chunk_next_) < block_size) NewChunk();
+        void *result = chunk_next_;
+        chunk_next_ += block_size;
+        return result;
+    }
+
+    void Deallocate(void *p, size_t bytes) {
+        if (bytes > kMaxBlockSize) {
+            ::operator delete(p);
+            return;
+        }
+        const size_t size_class = SizeClass(bytes);
+        FreeBlock *block = static_cast<FreeBlock *>(p);
+        block->next = free_lists_[size_class];
+        free_lists_[size_class] = block;
+    }
+
+   private:
+    NodePool(const NodePool &) = delete;
+    NodePool &operator=(const NodePool &) = delete;
+
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+    static const size_t kGranularity = 16;  // Block sizes are multiples of this, which keeps every block 16-byte aligned
+    static const size_t kMaxBlockSize = 256;
+    static const size_t kMinChunkSize = 1024;
+    static const size_t kMaxChunkSize = 16384;
+
+    static size_t SizeClass(size_t bytes) { return bytes ? (bytes - 1) / kGranularity : 0; }
+
+    // Start small so that pools of rarely-used containers stay cheap, then double up to kMaxChunkSize. Whatever is left of
+    // the previous chunk is smaller than one block and is simply abandoned.
+    void NewChunk() {
+        chunk_next_ = static_cast<char *>(::operator new(next_chunk_size_));
+        chunk_end_ = chunk_next_ + next_chunk_size_;
+        chunks_.push_back(chunk_next_);
+        if (next_chunk_size_ < kMaxChunkSize) next_chunk_size_ *= 2;
+    }
+
+    FreeBlock *free_lists_[kMaxBlockSize / kGranularity];
+    std::vector<char *> chunks_;
+    char *chunk_next_;
+    char *chunk_end_;
+    size_t next_chunk_size_;
+};
+
+// Standard allocator handing out memory from a NodePool. Containers sharing a pool compare equal, so they may be swapped
+// and move-assigned between each other without copying.
+template <typename T>
+class NodePoolAllocator {
+   public:
+    typedef T value_type;
+    template <typename U>
+    struct rebind {
+        typedef NodePoolAllocator<U> other;
+    };
+
+    explicit NodePoolAllocator(NodePool *pool) : pool_(pool) {}
+    template <typename U>
+    NodePoolAllocator(const NodePoolAllocator<U> &other) : pool_(other.pool()) {}
+
+    T *allocate(size_t n) { return static_cast<T *>(pool_->Allocate(n * sizeof(T))); }
+    void deallocate(T *p, size_t n) { pool_->Deallocate(p, n * sizeof(T)); }
+
+    NodePool *pool() const { return pool_; }
+
+   private:
+    NodePool *pool_;
+};
+
+template <typename T, typename U>
+bool operator==(const NodePoolAllocator<T> &a, const NodePoolAllocator<U> &b) {
+    return a.pool() == b.pool();
+}
+
+template <typename T, typename U>
+bool operator!=(const NodePoolAllocator<T> &a, const NodePoolAllocator<U> &b) {
+    return a.pool() != b.pool();
+}
+
+#endif  // LAYER_NODE_POOL_H
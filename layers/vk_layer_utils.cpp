@@ -19,10 +19,15 @@
  *
  */
 
+#include <stdlib.h>
 #include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
-#include <map>
 #include "vulkan/vulkan.h"
 #include "vk_layer_config.h"
 #include "vk_layer_utils.h"
@@ -80,6 +85,210 @@ VK_LAYER_EXPORT bool white_list(const char *item, const char *list) {
     return (white_list.find(candidate) != std::string::npos);
 }
 
+// Log file sink used when <LayerIdentifier>.log_async is set. log_callback does an fprintf and fflush for every message,
+// which serializes every validating thread on the stdio lock and the file system. Here each message is formatted on the
+// calling thread into a stack buffer and appended to a pending batch under a short lock; a background thread swaps the
+// batch out and writes it with a single fwrite. Identical (msgCode, object) pairs can be rate-limited, and the suppressed
+// counts are reported when the sink is flushed at callback/instance destruction. The rate limiter tracks a fixed number of
+// pairs in a table allocated up front; once it is full, messages for pairs it hasn't seen are passed through unlimited.
+class AsyncLogWriter {
+   public:
+    AsyncLogWriter(FILE *output, uint32_t duplicate_limit);
+    ~AsyncLogWriter();
+
+    void Write(VkFlags msgFlags, VkDebugReportObjectTypeEXT objType, uint64_t srcObject, size_t location, int32_t msgCode,
+               const char *pLayerPrefix, const char *pMsg);
+    // Best-effort flush of whatever is pending, for use from the exit handler
+    void EmergencyFlush();
+
+   private:
+    // Wake the writer early once this much output is pending
+    static const size_t kWakeThreshold = 64 * 1024;
+    // Messages arriving while this much output is pending are dropped and counted
+    static const size_t kMaxPending = 16 * 1024 * 1024;
+    static const int kFlushIntervalMs = 50;
+    // Size of the rate limiter's table, a power of two. At most three quarters of it is used so probes stay short.
+    static const uint32_t kMessageCountCapacity = 4096;
+
+    struct MessageCount {
+        uint64_t object;
+        int32_t code;
+        uint32_t count;  // 0 for an unused slot
+    };
+
+    void Run();
+    void WriteSuppressedSummary();
+    // Returns the count slot for a (msgCode, object) pair, or nullptr if the table is full and the pair isn't in it
+    MessageCount *FindMessageCount(int32_t code, uint64_t object);
+
+    FILE *output_;
+    uint32_t duplicate_limit_;
+    std::mutex lock_;
+    std::condition_variable wake_;
+    std::string pending_;
+    std::string writing_;
+    std::vector<MessageCount> message_counts_;
+    uint32_t message_count_used_ = 0;
+    uint64_t dropped_ = 0;
+    bool stop_ = false;
+    std::thread thread_;
+};
+
+const size_t AsyncLogWriter::kWakeThreshold;
+const size_t AsyncLogWriter::kMaxPending;
+const int AsyncLogWriter::kFlushIntervalMs;
+const uint32_t AsyncLogWriter::kMessageCountCapacity;
+
+// Live sinks, so that pending output can be flushed if the process exits without destroying its instance. Output pending
+// when the process aborts is lost; a signal handler can't safely take the lock or call into stdio to write it.
+static std::mutex async_log_writers_lock;
+static std::vector<AsyncLogWriter *> async_log_writers;
+static std::once_flag async_log_handlers_installed;
+
+static void FlushAsyncLogWriters() {
+    std::lock_guard<std::mutex> guard(async_log_writers_lock);
+    for (auto writer : async_log_writers) writer->EmergencyFlush();
+}
+
+static void InstallAsyncLogHandlers() { atexit(FlushAsyncLogWriters); }
+
+AsyncLogWriter::AsyncLogWriter(FILE *output, uint32_t duplicate_limit) : output_(output), duplicate_limit_(duplicate_limit) {
+    if (duplicate_limit_) message_counts_.resize(kMessageCountCapacity);
+    std::call_once(async_log_handlers_installed, InstallAsyncLogHandlers);
+    {
+        std::lock_guard<std::mutex> guard(async_log_writers_lock);
+        async_log_writers.push_back(this);
+    }
+    thread_ = std::thread(&AsyncLogWriter::Run, this);
+}
+
+AsyncLogWriter::~AsyncLogWriter() {
+    {
+        std::lock_guard<std::mutex> guard(async_log_writers_lock);
+        async_log_writers.erase(std::find(async_log_writers.begin(), async_log_writers.end(), this));
+    }
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        stop_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+    // The writer has drained everything queued before stop_ was set
+    WriteSuppressedSummary();
+    fflush(output_);
+}
+
+void AsyncLogWriter::Write(VkFlags msgFlags, VkDebugReportObjectTypeEXT objType, uint64_t srcObject, size_t location,
+                           int32_t msgCode, const char *pLayerPrefix, const char *pMsg) {
+    char msg_flags[30];
+    char header[256];
+    print_msg_flags(msgFlags, msg_flags);
+    int header_length = snprintf(header, sizeof(header), "%s(%s): object: 0x%" PRIx64 " type: %d location: %lu msgCode: %d: ",
+                                 pLayerPrefix, msg_flags, srcObject, objType, (unsigned long)location, msgCode);
+    if (header_length < 0) return;
+    if (header_length >= (int)sizeof(header)) header_length = sizeof(header) - 1;
+    size_t msg_length = strlen(pMsg);
+
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (duplicate_limit_) {
+            MessageCount *entry = FindMessageCount(msgCode, srcObject);
+            if (entry && ++entry->count > duplicate_limit_) return;
+        }
+        if (pending_.size() >= kMaxPending) {
+            dropped_++;
+            return;
+        }
+        pending_.append(header, header_length);
+        pending_.append(pMsg, msg_length);
+        pending_.push_back('\n');
+        wake = pending_.size() >= kWakeThreshold;
+    }
+    if (wake) wake_.notify_one();
+}
+
+void AsyncLogWriter::Run() {
+    std::unique_lock<std::mutex> guard(lock_);
+    for (;;) {
+        wake_.wait_for(guard, std::chrono::milliseconds(kFlushIntervalMs),
+                       [this] { return stop_ || pending_.size() >= kWakeThreshold; });
+        if (dropped_) {
+            char note[128];
+            snprintf(note, sizeof(note), "AsyncLog: %" PRIu64 " messages dropped, log output could not keep up\n", dropped_);
+            pending_.append(note);
+            dropped_ = 0;
+        }
+        if (!pending_.empty()) {
+            // Swap rather than copy so both buffers keep their capacity across batches
+            writing_.swap(pending_);
+            guard.unlock();
+            fwrite(writing_.data(), 1, writing_.size(), output_);
+            fflush(output_);
+            writing_.clear();
+            guard.lock();
+        } else if (stop_) {
+            break;
+        }
+    }
+}
+
+AsyncLogWriter::MessageCount *AsyncLogWriter::FindMessageCount(int32_t code, uint64_t object) {
+    const uint32_t mask = kMessageCountCapacity - 1;
+    uint64_t hash = (object ^ (uint64_t)(uint32_t)code) * 0x9E3779B97F4A7C15ULL;
+    for (uint32_t i = (uint32_t)(hash >> 32) & mask;; i = (i + 1) & mask) {
+        MessageCount &entry = message_counts_[i];
+        if (entry.count == 0) {
+            if (message_count_used_ >= kMessageCountCapacity / 4 * 3) return nullptr;
+            message_count_used_++;
+            entry.object = object;
+            entry.code = code;
+            return &entry;
+        }
+        if (entry.code == code && entry.object == object) return &entry;
+    }
+}
+
+void AsyncLogWriter::WriteSuppressedSummary() {
+    for (auto &entry : message_counts_) {
+        if (entry.count > duplicate_limit_) {
+            fprintf(output_, "AsyncLog: %u further messages with msgCode %d for object 0x%" PRIx64 " were suppressed\n",
+                    entry.count - duplicate_limit_, entry.code, entry.object);
+        }
+        entry.count = 0;
+    }
+    message_count_used_ = 0;
+}
+
+void AsyncLogWriter::EmergencyFlush() {
+    // The writer thread may be mid-batch or the owning thread may hold the lock; in either case skip rather than block
+    if (!lock_.try_lock()) {
+        fflush(output_);
+        return;
+    }
+    fwrite(pending_.data(), 1, pending_.size(), output_);
+    pending_.clear();
+    fflush(output_);
+    lock_.unlock();
+}
+
+VK_LAYER_EXPORT VKAPI_ATTR VkBool32 VKAPI_CALL async_log_callback(VkFlags msgFlags, VkDebugReportObjectTypeEXT objType,
+                                                                  uint64_t srcObject, size_t location, int32_t msgCode,
+                                                                  const char *pLayerPrefix, const char *pMsg, void *pUserData) {
+    static_cast<AsyncLogWriter *>(pUserData)->Write(msgFlags, objType, srcObject, location, msgCode, pLayerPrefix, pMsg);
+    return false;
+}
+
+VK_LAYER_EXPORT void async_log_release(void *pUserData) { delete static_cast<AsyncLogWriter *>(pUserData); }
+
+static THREAD_LOCAL_DECL debug_report_deferred_messages *thread_deferred_messages = nullptr;
+
+VK_LAYER_EXPORT void debug_report_set_thread_deferral(debug_report_deferred_messages *messages) {
+    thread_deferred_messages = messages;
+}
+
+VK_LAYER_EXPORT debug_report_deferred_messages *debug_report_get_thread_deferral() { return thread_deferred_messages; }
+
 // Debug callbacks get created in three ways:
 //   o  Application-defined debug callbacks
 //   o  Through settings in a vk_layer_settings.txt file
@@ -98,9 +307,13 @@ VK_LAYER_EXPORT void layer_debug_actions(debug_report_data *report_data, std::ve
     std::string report_flags_key = layer_identifier;
     std::string debug_action_key = layer_identifier;
     std::string log_filename_key = layer_identifier;
+    std::string log_async_key = layer_identifier;
+    std::string log_duplicate_limit_key = layer_identifier;
     report_flags_key.append(".report_flags");
     debug_action_key.append(".debug_action");
     log_filename_key.append(".log_filename");
+    log_async_key.append(".log_async");
+    log_duplicate_limit_key.append(".log_duplicate_limit");
 
     // Initialize layer options
     VkDebugReportFlagsEXT report_flags = GetLayerOptionFlags(report_flags_key, report_flags_option_definitions, 0);
@@ -115,8 +328,16 @@ VK_LAYER_EXPORT void layer_debug_actions(debug_report_data *report_data, std::ve
         memset(&dbgCreateInfo, 0, sizeof(dbgCreateInfo));
         dbgCreateInfo.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CREATE_INFO_EXT;
         dbgCreateInfo.flags = report_flags;
-        dbgCreateInfo.pfnCallback = log_callback;
-        dbgCreateInfo.pUserData = (void *)log_output;
+        const char *log_async = getLayerOption(log_async_key.c_str());
+        if (log_async && !strcmp(log_async, "true")) {
+            const char *duplicate_limit = getLayerOption(log_duplicate_limit_key.c_str());
+            uint32_t limit = (duplicate_limit && *duplicate_limit) ? (uint32_t)strtoul(duplicate_limit, NULL, 10) : 0;
+            dbgCreateInfo.pfnCallback = async_log_callback;
+            dbgCreateInfo.pUserData = new AsyncLogWriter(log_output, limit);
+        } else {
+            dbgCreateInfo.pfnCallback = log_callback;
+            dbgCreateInfo.pUserData = (void *)log_output;
+        }
         layer_create_msg_callback(report_data, default_layer_callback, &dbgCreateInfo, pAllocator, &callback);
         logging_callback.push_back(callback);
     }
@@ -31,8 +31,10 @@
 #include <stdbool.h>
 #include <string.h>
 #include <stddef.h>
+#include <time.h>
 
 #include <sys/types.h>
+#include <sys/stat.h>
 #if defined(_WIN32)
 #include "dirent_on_windows.h"
 #else  // _WIN32
@@ -44,7 +46,7 @@
 #include "debug_report.h"
 #include "wsi.h"
 #include "vulkan/vk_icd.h"
-#include "cJSON.h"
+#include "manifest_json.h"
 #include "murmurhash.h"
 
 // This is a CMake generated file with #defines for any functions/includes
@@ -85,6 +87,10 @@ uint32_t g_loader_log_msgs = 0;
 // additionally CreateDevice and DestroyDevice needs to be locked
 loader_platform_thread_mutex loader_lock;
 loader_platform_thread_mutex loader_json_lock;
+// protects loader_scan_cache
+static loader_platform_thread_mutex loader_scan_cache_lock;
+// Guards loader.instance_index and loader.device_index.  Nothing else is locked while it's held.
+static loader_platform_thread_mutex loader_dispatch_index_lock;
 
 LOADER_PLATFORM_THREAD_ONCE_DECLARATION(once_init);
 
@@ -656,11 +662,15 @@ void loader_delete_layer_properties(const struct loader_instance *inst, struct l
         }
         loader_destroy_generic_list(inst, (struct loader_generic_list *)&layer_list->list[i].instance_extension_list);
         dev_ext_list = &layer_list->list[i].device_extension_list;
-        if (dev_ext_list->capacity > 0 && NULL != dev_ext_list->list && dev_ext_list->list->entrypoint_count > 0) {
-            for (j = 0; j < dev_ext_list->list->entrypoint_count; j++) {
-                loader_instance_heap_free(inst, dev_ext_list->list->entrypoints[j]);
+        if (dev_ext_list->capacity > 0 && NULL != dev_ext_list->list) {
+            for (uint32_t k = 0; k < dev_ext_list->count; k++) {
+                struct loader_dev_ext_props *dev_ext = &dev_ext_list->list[k];
+                if (NULL == dev_ext->entrypoints) continue;
+                for (j = 0; j < dev_ext->entrypoint_count; j++) {
+                    loader_instance_heap_free(inst, dev_ext->entrypoints[j]);
+                }
+                loader_instance_heap_free(inst, dev_ext->entrypoints);
             }
-            loader_instance_heap_free(inst, dev_ext_list->list->entrypoints);
         }
         loader_destroy_generic_list(inst, (struct loader_generic_list *)dev_ext_list);
     }
@@ -1283,8 +1293,140 @@ out:
     return res;
 }
 
+// Keys are pointers to heap-allocated dispatch tables, so their low bits carry little information;
+// a Fibonacci multiply spreads the rest over the bucket range.
+static inline uint32_t loader_dispatch_index_hash(const void *key) {
+    return (uint32_t)(((uint64_t)(uintptr_t)key * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+// Only call with loader_dispatch_index_lock held
+static struct loader_dispatch_index_entry *loader_dispatch_index_find(const struct loader_dispatch_index *index, const void *key) {
+    if (NULL == index->entries || NULL == key) {
+        return NULL;
+    }
+    // The table is never more than half full, so the probe always reaches an empty bucket
+    const uint32_t mask = index->capacity - 1;
+    for (uint32_t i = loader_dispatch_index_hash(key) & mask;; i = (i + 1) & mask) {
+        struct loader_dispatch_index_entry *entry = &index->entries[i];
+        if (entry->key == key) {
+            return entry;
+        }
+        if (NULL == entry->key) {
+            return NULL;
+        }
+    }
+}
+
+// Copy out the entry for key, if there is one
+static bool loader_dispatch_index_lookup(const struct loader_dispatch_index *index, const void *key,
+                                         struct loader_dispatch_index_entry *found) {
+    loader_platform_thread_lock_mutex(&loader_dispatch_index_lock);
+    const struct loader_dispatch_index_entry *entry = loader_dispatch_index_find(index, key);
+    if (NULL != entry) {
+        *found = *entry;
+    }
+    loader_platform_thread_unlock_mutex(&loader_dispatch_index_lock);
+    return NULL != entry;
+}
+
+// Stores entry in its probe sequence, returning false if it replaced an entry with the same key
+static bool loader_dispatch_index_place(struct loader_dispatch_index_entry *entries, uint32_t capacity,
+                                        const struct loader_dispatch_index_entry *entry) {
+    const uint32_t mask = capacity - 1;
+    uint32_t i = loader_dispatch_index_hash(entry->key) & mask;
+    while (NULL != entries[i].key && entries[i].key != entry->key) {
+        i = (i + 1) & mask;
+    }
+    bool added = NULL == entries[i].key;
+    entries[i] = *entry;
+    return added;
+}
+
+// Adding is best effort: if memory runs out the object simply isn't indexed, and lookups fall
+// back to walking the loader's lists for it.
+static void loader_dispatch_index_add(struct loader_dispatch_index *index, const void *key, void *object,
+                                      struct loader_icd_term *icd_term, uint32_t icd_index) {
+    struct loader_dispatch_index_entry entry = {key, object, icd_term, icd_index};
+
+    loader_platform_thread_lock_mutex(&loader_dispatch_index_lock);
+    if (NULL == index->entries || 2 * (index->count + 1) > index->capacity) {
+        uint32_t capacity = index->entries ? 2 * index->capacity : 16;
+        struct loader_dispatch_index_entry *grown = loader_instance_heap_alloc(
+            NULL, capacity * sizeof(struct loader_dispatch_index_entry), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == grown) {
+            goto out;
+        }
+        memset(grown, 0, capacity * sizeof(struct loader_dispatch_index_entry));
+        for (uint32_t i = 0; NULL != index->entries && i < index->capacity; i++) {
+            if (NULL != index->entries[i].key) {
+                loader_dispatch_index_place(grown, capacity, &index->entries[i]);
+            }
+        }
+        loader_instance_heap_free(NULL, index->entries);
+        index->entries = grown;
+        index->capacity = capacity;
+    }
+
+    if (loader_dispatch_index_place(index->entries, index->capacity, &entry)) {
+        index->count++;
+    }
+
+out:
+    loader_platform_thread_unlock_mutex(&loader_dispatch_index_lock);
+}
+
+static void loader_dispatch_index_remove(struct loader_dispatch_index *index, const void *key) {
+    loader_platform_thread_lock_mutex(&loader_dispatch_index_lock);
+    struct loader_dispatch_index_entry *found = loader_dispatch_index_find(index, key);
+    if (NULL == found) {
+        goto out;
+    }
+
+    // Close the gap by pulling later entries of the probe run back into it, so that lookups
+    // never stop early at the removed bucket.
+    const uint32_t mask = index->capacity - 1;
+    uint32_t hole = (uint32_t)(found - index->entries);
+    for (uint32_t i = (hole + 1) & mask; NULL != index->entries[i].key; i = (i + 1) & mask) {
+        uint32_t home = loader_dispatch_index_hash(index->entries[i].key) & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            index->entries[hole] = index->entries[i];
+            hole = i;
+        }
+    }
+    memset(&index->entries[hole], 0, sizeof(struct loader_dispatch_index_entry));
+
+    if (0 == --index->count) {
+        loader_instance_heap_free(NULL, index->entries);
+        index->entries = NULL;
+        index->capacity = 0;
+    }
+
+out:
+    loader_platform_thread_unlock_mutex(&loader_dispatch_index_lock);
+}
+
+void loader_add_instance_to_index(struct loader_instance *inst) {
+    loader_dispatch_index_add(&loader.instance_index, inst->disp, inst, NULL, 0);
+}
+
+void loader_remove_instance_from_index(const struct loader_instance *inst) {
+    loader_dispatch_index_remove(&loader.instance_index, inst->disp);
+}
+
 struct loader_icd_term *loader_get_icd_and_device(const VkDevice device, struct loader_device **found_dev, uint32_t *icd_index) {
     *found_dev = NULL;
+
+    struct loader_dispatch_index_entry entry;
+    if (loader_dispatch_index_lookup(&loader.device_index, loader_get_dispatch(device), &entry)) {
+        *found_dev = (struct loader_device *)entry.object;
+        if (NULL != icd_index) {
+            *icd_index = entry.icd_index;
+        }
+        return entry.icd_term;
+    }
+
+    // Not indexed, either because a layer handed out a device with a dispatch pointer of its
+    // own or because indexing ran out of memory
     for (struct loader_instance *inst = loader.instances; inst; inst = inst->next) {
         uint32_t index = 0;
         for (struct loader_icd_term *icd_term = inst->icd_terms; icd_term; icd_term = icd_term->next) {
@@ -1306,6 +1448,7 @@ struct loader_icd_term *loader_get_icd_and_device(const VkDevice device, struct
 
 void loader_destroy_logical_device(const struct loader_instance *inst, struct loader_device *dev,
                                    const VkAllocationCallbacks *pAllocator) {
+    loader_dispatch_index_remove(&loader.device_index, &dev->loader_dispatch);
     if (pAllocator) {
         dev->alloc_callbacks = *pAllocator;
     }
@@ -1349,6 +1492,13 @@ struct loader_device *loader_create_logical_device(const struct loader_instance
 void loader_add_logical_device(const struct loader_instance *inst, struct loader_icd_term *icd_term, struct loader_device *dev) {
     dev->next = icd_term->logical_device_list;
     icd_term->logical_device_list = dev;
+
+    // The ICD's device gets &dev->loader_dispatch as its dispatch pointer, and layers keep it
+    uint32_t icd_index = 0;
+    for (struct loader_icd_term *term = icd_term->this_instance->icd_terms; term && term != icd_term; term = term->next) {
+        icd_index++;
+    }
+    loader_dispatch_index_add(&loader.device_index, &dev->loader_dispatch, dev, icd_term, icd_index);
 }
 
 void loader_remove_logical_device(const struct loader_instance *inst, struct loader_icd_term *icd_term,
@@ -1664,15 +1814,12 @@ void loader_initialize(void) {
     // initialize mutexs
     loader_platform_thread_create_mutex(&loader_lock);
     loader_platform_thread_create_mutex(&loader_json_lock);
+    loader_platform_thread_create_mutex(&loader_scan_cache_lock);
+    loader_platform_thread_create_mutex(&loader_dispatch_index_lock);
 
     // initialize logging
     loader_debug_init();
 
-    // initial cJSON to use alloc callbacks
-    cJSON_Hooks alloc_fns = {
-        .malloc_fn = loader_instance_tls_heap_alloc, .free_fn = loader_instance_tls_heap_free,
-    };
-    cJSON_InitHooks(&alloc_fns);
 }
 
 struct loader_manifest_files {
@@ -1740,126 +1887,92 @@ static void loader_get_fullpath(const char *file, const char *dirs, size_t out_s
     (void)snprintf(out_fullpath, out_size, "%s", file);
 }
 
-// Read a JSON file into a buffer.
-//
-// @return -  A pointer to a cJSON object representing the JSON parse tree.
-//            This returned buffer should be freed by caller.
-static VkResult loader_get_json(const struct loader_instance *inst, const char *filename, cJSON **json) {
-    FILE *file = NULL;
-    char *json_buf;
-    size_t len;
-    VkResult res = VK_SUCCESS;
-
-    if (NULL == json) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_get_json: Received invalid JSON file");
-        res = VK_ERROR_INITIALIZATION_FAILED;
-        goto out;
-    }
-
-    *json = NULL;
-
-    file = fopen(filename, "rb");
-    if (!file) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_get_json: Failed to open JSON file %s", filename);
-        res = VK_ERROR_INITIALIZATION_FAILED;
-        goto out;
-    }
-    fseek(file, 0, SEEK_END);
-    len = ftell(file);
-    fseek(file, 0, SEEK_SET);
-    json_buf = (char *)loader_stack_alloc(len + 1);
-    if (json_buf == NULL) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                   "loader_get_json: Failed to allocate space for "
-                   "JSON file %s buffer of length %d",
-                   filename, len);
-        res = VK_ERROR_OUT_OF_HOST_MEMORY;
-        goto out;
-    }
-    if (fread(json_buf, sizeof(char), len, file) != len) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_get_json: Failed to read JSON file %s.", filename);
-        res = VK_ERROR_INITIALIZATION_FAILED;
-        goto out;
-    }
-    json_buf[len] = '\0';
-
-    // Parse text from file
-    *json = cJSON_Parse(json_buf);
-    if (*json == NULL) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                   "loader_get_json: Failed to parse JSON file %s, "
-                   "this is usually because something ran out of "
-                   "memory.",
-                   filename);
-        res = VK_ERROR_OUT_OF_HOST_MEMORY;
-        goto out;
-    }
-
-out:
-    if (NULL != file) {
-        fclose(file);
-    }
-
-    return res;
-}
-
 // Do a deep copy of the loader_layer_properties structure.
+// Deep copy a layer property.  On failure dst owns only what was successfully copied, so it is always safe to release it
+// with loader_delete_layer_properties.
 VkResult loader_copy_layer_properties(const struct loader_instance *inst, struct loader_layer_properties *dst,
                                       struct loader_layer_properties *src) {
-    uint32_t cnt, i;
+    uint32_t cnt, i, j;
     memcpy(dst, src, sizeof(*src));
-    dst->instance_extension_list.list = loader_instance_heap_alloc(
-        inst, sizeof(VkExtensionProperties) * src->instance_extension_list.count, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-    if (NULL == dst->instance_extension_list.list) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                   "loader_copy_layer_properties: Failed to allocate space "
-                   "for instance extension list of size %d.",
-                   src->instance_extension_list.count);
-        return VK_ERROR_OUT_OF_HOST_MEMORY;
-    }
-    dst->instance_extension_list.capacity = sizeof(VkExtensionProperties) * src->instance_extension_list.count;
-    memcpy(dst->instance_extension_list.list, src->instance_extension_list.list, dst->instance_extension_list.capacity);
-    dst->device_extension_list.list = loader_instance_heap_alloc(
-        inst, sizeof(struct loader_dev_ext_props) * src->device_extension_list.count, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-    if (NULL == dst->device_extension_list.list) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                   "loader_copy_layer_properties: Failed to allocate space "
-                   "for device extension list of size %d.",
-                   src->device_extension_list.count);
-        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    memset(&dst->instance_extension_list, 0, sizeof(dst->instance_extension_list));
+    memset(&dst->device_extension_list, 0, sizeof(dst->device_extension_list));
+    dst->component_layer_names = NULL;
+
+    if (src->instance_extension_list.count > 0) {
+        dst->instance_extension_list.list = loader_instance_heap_alloc(
+            inst, sizeof(VkExtensionProperties) * src->instance_extension_list.count, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == dst->instance_extension_list.list) {
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                       "loader_copy_layer_properties: Failed to allocate space "
+                       "for instance extension list of size %d.",
+                       src->instance_extension_list.count);
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        dst->instance_extension_list.capacity = sizeof(VkExtensionProperties) * src->instance_extension_list.count;
+        dst->instance_extension_list.count = src->instance_extension_list.count;
+        memcpy(dst->instance_extension_list.list, src->instance_extension_list.list, dst->instance_extension_list.capacity);
     }
-    memset(dst->device_extension_list.list, 0, sizeof(struct loader_dev_ext_props) * src->device_extension_list.count);
 
-    dst->device_extension_list.capacity = sizeof(struct loader_dev_ext_props) * src->device_extension_list.count;
-    memcpy(dst->device_extension_list.list, src->device_extension_list.list, dst->device_extension_list.capacity);
-    if (src->device_extension_list.count > 0 && src->device_extension_list.list->entrypoint_count > 0) {
-        cnt = src->device_extension_list.list->entrypoint_count;
-        dst->device_extension_list.list->entrypoints =
-            loader_instance_heap_alloc(inst, sizeof(char *) * cnt, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (NULL == dst->device_extension_list.list->entrypoints) {
+    if (src->device_extension_list.count > 0) {
+        dst->device_extension_list.list = loader_instance_heap_alloc(
+            inst, sizeof(struct loader_dev_ext_props) * src->device_extension_list.count, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == dst->device_extension_list.list) {
             loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
                        "loader_copy_layer_properties: Failed to allocate space "
-                       "for device extension entrypoint list of size %d.",
-                       cnt);
+                       "for device extension list of size %d.",
+                       src->device_extension_list.count);
             return VK_ERROR_OUT_OF_HOST_MEMORY;
         }
-        memset(dst->device_extension_list.list->entrypoints, 0, sizeof(char *) * cnt);
-
-        for (i = 0; i < cnt; i++) {
-            dst->device_extension_list.list->entrypoints[i] = loader_instance_heap_alloc(
-                inst, strlen(src->device_extension_list.list->entrypoints[i]) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-            if (NULL == dst->device_extension_list.list->entrypoints[i]) {
+        dst->device_extension_list.capacity = sizeof(struct loader_dev_ext_props) * src->device_extension_list.count;
+        dst->device_extension_list.count = src->device_extension_list.count;
+        for (j = 0; j < src->device_extension_list.count; j++) {
+            struct loader_dev_ext_props *src_ext = &src->device_extension_list.list[j];
+            struct loader_dev_ext_props *dst_ext = &dst->device_extension_list.list[j];
+            dst_ext->props = src_ext->props;
+            dst_ext->entrypoint_count = 0;
+            dst_ext->entrypoints = NULL;
+            cnt = src_ext->entrypoint_count;
+            if (cnt == 0) continue;
+
+            dst_ext->entrypoints = loader_instance_heap_alloc(inst, sizeof(char *) * cnt, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+            if (NULL == dst_ext->entrypoints) {
                 loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                           "loader_copy_layer_properties: Failed to "
-                           "allocate space for device extension entrypoint "
-                           "%d name of length",
-                           i);
+                           "loader_copy_layer_properties: Failed to allocate space "
+                           "for device extension entrypoint list of size %d.",
+                           cnt);
                 return VK_ERROR_OUT_OF_HOST_MEMORY;
             }
-            strcpy(dst->device_extension_list.list->entrypoints[i], src->device_extension_list.list->entrypoints[i]);
+            for (i = 0; i < cnt; i++) {
+                dst_ext->entrypoints[i] =
+                    loader_instance_heap_alloc(inst, strlen(src_ext->entrypoints[i]) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+                if (NULL == dst_ext->entrypoints[i]) {
+                    loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                               "loader_copy_layer_properties: Failed to "
+                               "allocate space for device extension entrypoint "
+                               "%d name of length",
+                               i);
+                    return VK_ERROR_OUT_OF_HOST_MEMORY;
+                }
+                strcpy(dst_ext->entrypoints[i], src_ext->entrypoints[i]);
+                dst_ext->entrypoint_count++;
+            }
         }
     }
 
+    if (src->num_component_layers > 0 && NULL != src->component_layer_names) {
+        dst->component_layer_names =
+            loader_instance_heap_alloc(inst, sizeof(char[MAX_STRING_SIZE]) * src->num_component_layers,
+                                       VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == dst->component_layer_names) {
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                       "loader_copy_layer_properties: Failed to allocate space "
+                       "for %d component layer names.",
+                       src->num_component_layers);
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        memcpy(dst->component_layer_names, src->component_layer_names, sizeof(char[MAX_STRING_SIZE]) * src->num_component_layers);
+    }
+
     return VK_SUCCESS;
 }
 
@@ -2063,17 +2176,27 @@ typedef struct {
     uint16_t patch;
 } layer_json_version;
 
+// Copy a manifest value to a string on the stack, leaving str NULL if there is no room
+#define JSON_STACK_STRING(value, str)                                          \
+    {                                                                          \
+        size_t json_str_size = loader_json_get_string(value, NULL, 0) + 1;     \
+        str = loader_stack_alloc(json_str_size);                               \
+        if (NULL != str) {                                                     \
+            loader_json_get_string(value, str, json_str_size);                 \
+        }                                                                      \
+    }
+
 static VkResult loader_read_json_layer(const struct loader_instance *inst, struct loader_layer_list *layer_instance_list,
-                                       cJSON *layer_node, layer_json_version version, cJSON *item, cJSON *disable_environment,
-                                       bool is_implicit, char *filename) {
-    char *temp;
+                                       const struct loader_json_value *layer_node, layer_json_version version, bool is_implicit,
+                                       char *filename) {
     char *name, *type, *library_path_str, *api_version;
     char *implementation_version, *description;
-    cJSON *ext_item, *library_path, *component_layers;
+    struct loader_json_value item, ext_item, library_path, component_layers, disable_environment;
+    struct loader_json_iterator iter;
     VkExtensionProperties ext_prop;
     VkResult result = VK_ERROR_INITIALIZATION_FAILED;
     struct loader_layer_properties *props = NULL;
-    int i, j;
+    uint32_t i, j;
 
 // The following are required in the "layer" object:
 // (required) "name"
@@ -2085,9 +2208,7 @@ static VkResult loader_read_json_layer(const struct loader_instance *inst, struc
 // (required for implicit layers) “disable_environment”
 #define GET_JSON_OBJECT(node, var)                                         \
     {                                                                      \
-        var = cJSON_GetObjectItem(node, #var);                             \
-        if (var == NULL) {                                                 \
-            layer_node = layer_node->next;                                 \
+        if (!loader_json_get_object_item(node, #var, &var)) {              \
             loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,           \
                        "Didn't find required layer object %s in manifest " \
                        "JSON file, skipping this layer",                   \
@@ -2097,18 +2218,15 @@ static VkResult loader_read_json_layer(const struct loader_instance *inst, struc
     }
 #define GET_JSON_ITEM(node, var)                                               \
     {                                                                          \
-        item = cJSON_GetObjectItem(node, #var);                                \
-        if (item == NULL) {                                                    \
-            layer_node = layer_node->next;                                     \
+        if (!loader_json_get_object_item(node, #var, &item)) {                 \
             loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,               \
                        "Didn't find required layer value %s in manifest JSON " \
                        "file, skipping this layer",                            \
                        #var);                                                  \
             goto out;                                                          \
         }                                                                      \
-        temp = cJSON_Print(item);                                              \
-        if (temp == NULL) {                                                    \
-            layer_node = layer_node->next;                                     \
+        JSON_STACK_STRING(&item, var)                                          \
+        if (var == NULL) {                                                     \
             loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,               \
                        "Problem accessing layer value %s in manifest JSON "    \
                        "file, skipping this layer",                            \
@@ -2116,10 +2234,6 @@ static VkResult loader_read_json_layer(const struct loader_instance *inst, struc
             result = VK_ERROR_OUT_OF_HOST_MEMORY;                              \
             goto out;                                                          \
         }                                                                      \
-        temp[strlen(temp) - 1] = '\0';                                         \
-        var = loader_stack_alloc(strlen(temp) + 1);                            \
-        strcpy(var, &temp[1]);                                                 \
-        cJSON_Free(temp);                                                      \
     }
     GET_JSON_ITEM(layer_node, name)
     GET_JSON_ITEM(layer_node, type)
@@ -2130,7 +2244,6 @@ static VkResult loader_read_json_layer(const struct loader_instance *inst, struc
     // Add list entry
     if (!strcmp(type, "DEVICE")) {
         loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0, "Device layers are deprecated skipping this layer");
-        layer_node = layer_node->next;
         goto out;
     }
 
@@ -2138,7 +2251,6 @@ static VkResult loader_read_json_layer(const struct loader_instance *inst, struc
     // layers that must work with older loaders
     if (!strcmp(type, "INSTANCE") || !strcmp(type, "GLOBAL")) {
         if (layer_instance_list == NULL) {
-            layer_node = layer_node->next;
             goto out;
         }
         props = loader_get_next_layer_property(inst, layer_instance_list);
@@ -2152,15 +2264,14 @@ static VkResult loader_read_json_layer(const struct loader_instance *inst, struc
             props->type_flags |= VK_LAYER_TYPE_FLAG_EXPLICIT_LAYER;
         }
     } else {
-        layer_node = layer_node->next;
         goto out;
     }
 
     // Library path no longer required unless component_layers is also not defined
-    library_path = cJSON_GetObjectItem(layer_node, "library_path");
-    component_layers = cJSON_GetObjectItem(layer_node, "component_layers");
-    if (NULL != library_path) {
-        if (NULL != component_layers) {
+    bool has_library_path = loader_json_get_object_item(layer_node, "library_path", &library_path);
+    bool has_component_layers = loader_json_get_object_item(layer_node, "component_layers", &component_layers);
+    if (has_library_path) {
+        if (has_component_layers) {
             loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                        "Indicating meta-layer-specific component_layers, but also "
                        "defining layer library path.  Both are not compatible, so "
@@ -2170,41 +2281,34 @@ static VkResult loader_read_json_layer(const struct loader_instance *inst, struc
         props->num_component_layers = 0;
         props->component_layer_names = NULL;
 
-        temp = cJSON_Print(library_path);
-        if (NULL == temp) {
-            layer_node = layer_node->next;
+        JSON_STACK_STRING(&library_path, library_path_str)
+        if (NULL == library_path_str) {
             loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                        "Problem accessing layer value library_path in manifest JSON "
                        "file, skipping this layer");
             result = VK_ERROR_OUT_OF_HOST_MEMORY;
             goto out;
         }
-        temp[strlen(temp) - 1] = '\0';
-        library_path_str = loader_stack_alloc(strlen(temp) + 1);
-        strcpy(library_path_str, &temp[1]);
-        cJSON_Free(temp);
 
         char *fullpath = props->lib_name;
         char *rel_base;
-        if (NULL != library_path_str) {
-            if (loader_platform_is_path(library_path_str)) {
-                // A relative or absolute path
-                char *name_copy = loader_stack_alloc(strlen(filename) + 1);
-                strcpy(name_copy, filename);
-                rel_base = loader_platform_dirname(name_copy);
-                loader_expand_path(library_path_str, rel_base, MAX_STRING_SIZE, fullpath);
-            } else {
-                // A filename which is assumed in a system directory
-                loader_get_fullpath(library_path_str, DEFAULT_VK_LAYERS_PATH, MAX_STRING_SIZE, fullpath);
-            }
+        if (loader_platform_is_path(library_path_str)) {
+            // A relative or absolute path
+            char *name_copy = loader_stack_alloc(strlen(filename) + 1);
+            strcpy(name_copy, filename);
+            rel_base = loader_platform_dirname(name_copy);
+            loader_expand_path(library_path_str, rel_base, MAX_STRING_SIZE, fullpath);
+        } else {
+            // A filename which is assumed in a system directory
+            loader_get_fullpath(library_path_str, DEFAULT_VK_LAYERS_PATH, MAX_STRING_SIZE, fullpath);
         }
-    } else if (NULL != component_layers) {
+    } else if (has_component_layers) {
         if (version.major == 1 && (version.minor < 1 || version.patch < 1)) {
             loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                        "Indicating meta-layer-specific component_layers, but using older "
                        "JSON file version.");
         }
-        int count = cJSON_GetArraySize(component_layers);
+        uint32_t count = loader_json_get_array_size(&component_layers);
         props->num_component_layers = count;
 
         // Allocate buffer for layer names
@@ -2216,27 +2320,14 @@ static VkResult loader_read_json_layer(const struct loader_instance *inst, struc
         }
 
         // Copy the component layers into the array
-        for (i = 0; i < count; i++) {
-            cJSON *comp_layer = cJSON_GetArrayItem(component_layers, i);
-            if (NULL != comp_layer) {
-                temp = cJSON_Print(comp_layer);
-                if (NULL == temp) {
-                    result = VK_ERROR_OUT_OF_HOST_MEMORY;
-                    goto out;
-                }
-                temp[strlen(temp) - 1] = '\0';
-                strncpy(props->component_layer_names[i], temp + 1, MAX_STRING_SIZE - 1);
-                props->component_layer_names[i][MAX_STRING_SIZE - 1] = '\0';
-                cJSON_Free(temp);
-            }
+        loader_json_iterate(&component_layers, &iter);
+        for (i = 0; i < count && loader_json_next(&iter, NULL, &item); i++) {
+            loader_json_get_string(&item, props->component_layer_names[i], MAX_STRING_SIZE);
         }
 
         // This is now, officially, a meta-layer
         props->type_flags |= VK_LAYER_TYPE_FLAG_META_LAYER;
         loader_log(inst, VK_DEBUG_REPORT_INFORMATION_BIT_EXT, 0, "Encountered meta-layer %s", name);
-
-        // Make sure we set up other things so we head down the correct branches below
-        library_path_str = NULL;
     } else {
         loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                    "Layer missing both library_path and component_layers fields.  One or the "
@@ -2257,17 +2348,16 @@ static VkResult loader_read_json_layer(const struct loader_instance *inst, struc
     strncpy((char *)props->info.description, description, sizeof(props->info.description));
     props->info.description[sizeof(props->info.description) - 1] = '\0';
     if (is_implicit) {
-        if (!disable_environment || !disable_environment->child) {
+        struct loader_json_value env_name, env_value;
+        if (!loader_json_iterate(&disable_environment, &iter) || !iter.is_object ||
+            !loader_json_next(&iter, &env_name, &env_value)) {
             loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                        "Didn't find required layer child value disable_environment"
                        "in manifest JSON file, skipping this layer");
-            layer_node = layer_node->next;
             goto out;
         }
-        strncpy(props->disable_env_var.name, disable_environment->child->string, sizeof(props->disable_env_var.name));
-        props->disable_env_var.name[sizeof(props->disable_env_var.name) - 1] = '\0';
-        strncpy(props->disable_env_var.value, disable_environment->child->valuestring, sizeof(props->disable_env_var.value));
-        props->disable_env_var.value[sizeof(props->disable_env_var.value) - 1] = '\0';
+        loader_json_get_string(&env_name, props->disable_env_var.name, sizeof(props->disable_env_var.name));
+        loader_json_get_string(&env_value, props->disable_env_var.value, sizeof(props->disable_env_var.value));
     }
 
 // Now get all optional items and objects and put in list:
@@ -2276,26 +2366,21 @@ static VkResult loader_read_json_layer(const struct loader_instance *inst, struc
 // device_extensions
 // enable_environment (implicit layers only)
 #define GET_JSON_OBJECT(node, var) \
-    { var = cJSON_GetObjectItem(node, #var); }
-#define GET_JSON_ITEM(node, var)                            \
-    {                                                       \
-        item = cJSON_GetObjectItem(node, #var);             \
-        if (item != NULL) {                                 \
-            temp = cJSON_Print(item);                       \
-            if (temp != NULL) {                             \
-                temp[strlen(temp) - 1] = '\0';              \
-                var = loader_stack_alloc(strlen(temp) + 1); \
-                strcpy(var, &temp[1]);                      \
-                cJSON_Free(temp);                           \
-            } else {                                        \
-                result = VK_ERROR_OUT_OF_HOST_MEMORY;       \
-                goto out;                                   \
-            }                                               \
-        }                                                   \
-    }
-
-    cJSON *instance_extensions, *device_extensions, *functions, *enable_environment;
-    cJSON *entrypoints = NULL;
+    { has_##var = loader_json_get_object_item(node, #var, &var); }
+#define GET_JSON_ITEM(node, var)                              \
+    {                                                         \
+        var = NULL;                                           \
+        if (loader_json_get_object_item(node, #var, &item)) { \
+            JSON_STACK_STRING(&item, var)                     \
+            if (var == NULL) {                                \
+                result = VK_ERROR_OUT_OF_HOST_MEMORY;         \
+                goto out;                                     \
+            }                                                 \
+        }                                                     \
+    }
+
+    struct loader_json_value instance_extensions, device_extensions, functions, enable_environment, entrypoints;
+    bool has_instance_extensions, has_device_extensions, has_functions, has_enable_environment, has_entrypoints;
     char *vkGetInstanceProcAddr = NULL;
     char *vkGetDeviceProcAddr = NULL;
     char *vkNegotiateLoaderLayerInterfaceVersion = NULL;
@@ -2307,9 +2392,9 @@ static VkResult loader_read_json_layer(const struct loader_instance *inst, struc
     //    vkGetDeviceProcAddr
     //    vkNegotiateLoaderLayerInterfaceVersion (starting with JSON file 1.1.0)
     GET_JSON_OBJECT(layer_node, functions)
-    if (functions != NULL) {
+    if (has_functions) {
         if (version.major > 1 || version.minor >= 1) {
-            GET_JSON_ITEM(functions, vkNegotiateLoaderLayerInterfaceVersion)
+            GET_JSON_ITEM(&functions, vkNegotiateLoaderLayerInterfaceVersion)
             if (vkNegotiateLoaderLayerInterfaceVersion != NULL)
                 strncpy(props->functions.str_negotiate_interface, vkNegotiateLoaderLayerInterfaceVersion,
                         sizeof(props->functions.str_negotiate_interface));
@@ -2317,8 +2402,8 @@ static VkResult loader_read_json_layer(const struct loader_instance *inst, struc
         } else {
             props->functions.str_negotiate_interface[0] = '\0';
         }
-        GET_JSON_ITEM(functions, vkGetInstanceProcAddr)
-        GET_JSON_ITEM(functions, vkGetDeviceProcAddr)
+        GET_JSON_ITEM(&functions, vkGetInstanceProcAddr)
+        GET_JSON_ITEM(&functions, vkGetDeviceProcAddr)
         if (vkGetInstanceProcAddr != NULL) {
             strncpy(props->functions.str_gipa, vkGetInstanceProcAddr, sizeof(props->functions.str_gipa));
             if (version.major > 1 || version.minor >= 1) {
@@ -2353,16 +2438,14 @@ static VkResult loader_read_json_layer(const struct loader_instance *inst, struc
     //     spec_version
     //   }
     GET_JSON_OBJECT(layer_node, instance_extensions)
-    if (instance_extensions != NULL) {
-        int count = cJSON_GetArraySize(instance_extensions);
-        for (i = 0; i < count; i++) {
-            ext_item = cJSON_GetArrayItem(instance_extensions, i);
-            GET_JSON_ITEM(ext_item, name)
+    if (has_instance_extensions && loader_json_iterate(&instance_extensions, &iter)) {
+        while (loader_json_next(&iter, NULL, &ext_item)) {
+            GET_JSON_ITEM(&ext_item, name)
             if (name != NULL) {
                 strncpy(ext_prop.extensionName, name, sizeof(ext_prop.extensionName));
                 ext_prop.extensionName[sizeof(ext_prop.extensionName) - 1] = '\0';
             }
-            GET_JSON_ITEM(ext_item, spec_version)
+            GET_JSON_ITEM(&ext_item, spec_version)
             if (NULL != spec_version) {
                 ext_prop.specVersion = atoi(spec_version);
             } else {
@@ -2382,12 +2465,10 @@ static VkResult loader_read_json_layer(const struct loader_instance *inst, struc
     //     entrypoints
     //   }
     GET_JSON_OBJECT(layer_node, device_extensions)
-    if (device_extensions != NULL) {
-        int count = cJSON_GetArraySize(device_extensions);
-        for (i = 0; i < count; i++) {
-            ext_item = cJSON_GetArrayItem(device_extensions, i);
-            GET_JSON_ITEM(ext_item, name)
-            GET_JSON_ITEM(ext_item, spec_version)
+    if (has_device_extensions && loader_json_iterate(&device_extensions, &iter)) {
+        while (loader_json_next(&iter, NULL, &ext_item)) {
+            GET_JSON_ITEM(&ext_item, name)
+            GET_JSON_ITEM(&ext_item, spec_version)
             if (name != NULL) {
                 strncpy(ext_prop.extensionName, name, sizeof(ext_prop.extensionName));
                 ext_prop.extensionName[sizeof(ext_prop.extensionName) - 1] = '\0';
@@ -2397,30 +2478,23 @@ static VkResult loader_read_json_layer(const struct loader_instance *inst, struc
             } else {
                 ext_prop.specVersion = 0;
             }
-            // entrypoints = cJSON_GetObjectItem(ext_item, "entrypoints");
-            GET_JSON_OBJECT(ext_item, entrypoints)
-            int entry_count;
-            if (entrypoints == NULL) {
+            GET_JSON_OBJECT(&ext_item, entrypoints)
+            uint32_t entry_count = 0;
+            if (has_entrypoints) {
+                entry_count = loader_json_get_array_size(&entrypoints);
+            }
+            if (entry_count == 0) {
                 loader_add_to_dev_ext_list(inst, &props->device_extension_list, &ext_prop, 0, NULL);
                 continue;
             }
-            entry_count = cJSON_GetArraySize(entrypoints);
-            if (entry_count) {
-                entry_array = (char **)loader_stack_alloc(sizeof(char *) * entry_count);
-            }
-            for (j = 0; j < entry_count; j++) {
-                ext_item = cJSON_GetArrayItem(entrypoints, j);
-                if (ext_item != NULL) {
-                    temp = cJSON_Print(ext_item);
-                    if (NULL == temp) {
-                        entry_array[j] = NULL;
-                        result = VK_ERROR_OUT_OF_HOST_MEMORY;
-                        goto out;
-                    }
-                    temp[strlen(temp) - 1] = '\0';
-                    entry_array[j] = loader_stack_alloc(strlen(temp) + 1);
-                    strcpy(entry_array[j], &temp[1]);
-                    cJSON_Free(temp);
+            entry_array = (char **)loader_stack_alloc(sizeof(char *) * entry_count);
+            struct loader_json_iterator entry_iter;
+            loader_json_iterate(&entrypoints, &entry_iter);
+            for (j = 0; j < entry_count && loader_json_next(&entry_iter, NULL, &item); j++) {
+                JSON_STACK_STRING(&item, entry_array[j])
+                if (NULL == entry_array[j]) {
+                    result = VK_ERROR_OUT_OF_HOST_MEMORY;
+                    goto out;
                 }
             }
             loader_add_to_dev_ext_list(inst, &props->device_extension_list, &ext_prop, entry_count, entry_array);
@@ -2430,11 +2504,11 @@ static VkResult loader_read_json_layer(const struct loader_instance *inst, struc
         GET_JSON_OBJECT(layer_node, enable_environment)
 
         // enable_environment is optional
-        if (enable_environment) {
-            strncpy(props->enable_env_var.name, enable_environment->child->string, sizeof(props->enable_env_var.name));
-            props->enable_env_var.name[sizeof(props->enable_env_var.name) - 1] = '\0';
-            strncpy(props->enable_env_var.value, enable_environment->child->valuestring, sizeof(props->enable_env_var.value));
-            props->enable_env_var.value[sizeof(props->enable_env_var.value) - 1] = '\0';
+        struct loader_json_value env_name, env_value;
+        if (has_enable_environment && loader_json_iterate(&enable_environment, &iter) && iter.is_object &&
+            loader_json_next(&iter, &env_name, &env_value)) {
+            loader_json_get_string(&env_name, props->enable_env_var.name, sizeof(props->enable_env_var.name));
+            loader_json_get_string(&env_value, props->enable_env_var.value, sizeof(props->enable_env_var.value));
         }
     }
 
@@ -2473,9 +2547,9 @@ static inline bool layer_json_supports_layers_tag(const layer_json_version *laye
     return false;
 }
 
-// Given a cJSON struct (json) of the top level JSON object from layer manifest
-// file, add entry to the layer_list. Fill out the layer_properties in this list
-// entry from the input cJSON object.
+// Given the top level JSON object (json) from a layer manifest file, add an
+// entry to the layer_list for each layer it describes. Fill out the
+// layer_properties in this list entry from the input JSON object.
 //
 // \returns
 // void
@@ -2483,24 +2557,21 @@ static inline bool layer_json_supports_layers_tag(const layer_json_version *laye
 // If the json input object does not have all the required fields no entry
 // is added to the list.
 static VkResult loader_add_layer_properties(const struct loader_instance *inst, struct loader_layer_list *layer_instance_list,
-                                            cJSON *json, bool is_implicit, char *filename) {
+                                            const struct loader_json_value *json, bool is_implicit, char *filename) {
     // The following Fields in layer manifest file that are required:
     //   - “file_format_version”
     //   - If more than one "layer" object are used, then the "layers" array is
     //     required
     VkResult result = VK_ERROR_INITIALIZATION_FAILED;
-    cJSON *item, *layers_node, *layer_node;
+    struct loader_json_value item, key, layers_node, layer_node;
+    struct loader_json_iterator iter;
     layer_json_version json_version = {0, 0, 0};
+    char file_vers[64];
     char *vers_tok;
-    cJSON *disable_environment = NULL;
-    item = cJSON_GetObjectItem(json, "file_format_version");
-    if (item == NULL) {
-        goto out;
-    }
-    char *file_vers = cJSON_PrintUnformatted(item);
-    if (NULL == file_vers) {
+    if (!loader_json_get_object_item(json, "file_format_version", &item)) {
         goto out;
     }
+    loader_json_get_string(&item, file_vers, sizeof(file_vers));
     loader_log(inst, VK_DEBUG_REPORT_INFORMATION_BIT_EXT, 0, "Found manifest file %s, version %s", filename, file_vers);
     // Get the major/minor/and patch as integers for easier comparison
     vers_tok = strtok(file_vers, ".\"\n\r");
@@ -2522,50 +2593,38 @@ static VkResult loader_add_layer_properties(const struct loader_instance *inst,
                    "manifest file version %d.%d.%d.  May cause errors.",
                    filename, json_version.major, json_version.minor, json_version.patch);
     }
-    cJSON_Free(file_vers);
 
     // If "layers" is present, read in the array of layer objects
-    layers_node = cJSON_GetObjectItem(json, "layers");
-    if (layers_node != NULL) {
-        int numItems = cJSON_GetArraySize(layers_node);
+    if (loader_json_get_object_item(json, "layers", &layers_node)) {
         if (!layer_json_supports_layers_tag(&json_version)) {
             loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                        "loader_add_layer_properties: \'layers\' tag not "
                        "supported until file version 1.0.1, but %s is "
-                       "reporting version %s",
-                       filename, file_vers);
+                       "reporting version %d.%d.%d",
+                       filename, json_version.major, json_version.minor, json_version.patch);
         }
-        for (int curLayer = 0; curLayer < numItems; curLayer++) {
-            layer_node = cJSON_GetArrayItem(layers_node, curLayer);
-            if (layer_node == NULL) {
-                loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
-                           "loader_add_layer_properties: Can not find "
-                           "\'layers\' array element %d object in manifest "
-                           "JSON file %s.  Skipping this file",
-                           curLayer, filename);
-                goto out;
+        if (loader_json_iterate(&layers_node, &iter)) {
+            while (loader_json_next(&iter, NULL, &layer_node)) {
+                result = loader_read_json_layer(inst, layer_instance_list, &layer_node, json_version, is_implicit, filename);
             }
-            result = loader_read_json_layer(inst, layer_instance_list, layer_node, json_version, item, disable_environment,
-                                            is_implicit, filename);
         }
     } else {
-        // Otherwise, try to read in individual layers
-        layer_node = cJSON_GetObjectItem(json, "layer");
-        if (layer_node == NULL) {
+        // Otherwise, try to read in individual layers.  Loop through all
+        // "layer" objects in the file to get a count of them first.
+        uint16_t layer_count = 0;
+        loader_json_iterate(json, &iter);
+        while (loader_json_next(&iter, &key, &layer_node)) {
+            if (loader_json_string_equals(&key, "layer")) {
+                layer_count++;
+            }
+        }
+        if (layer_count == 0) {
             loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                        "loader_add_layer_properties: Can not find \'layer\' "
                        "object in manifest JSON file %s.  Skipping this file.",
                        filename);
             goto out;
         }
-        // Loop through all "layer" objects in the file to get a count of them
-        // first.
-        uint16_t layer_count = 0;
-        cJSON *tempNode = layer_node;
-        do {
-            tempNode = tempNode->next;
-            layer_count++;
-        } while (tempNode != NULL);
 
         // Throw a warning if we encounter multiple "layer" objects in file
         // versions newer than 1.0.0.  Having multiple objects with the same
@@ -2577,11 +2636,12 @@ static VkResult loader_add_layer_properties(const struct loader_instance *inst,
                        "Please use \'layers\' : [] array instead in %s.",
                        filename);
         } else {
-            do {
-                result = loader_read_json_layer(inst, layer_instance_list, layer_node, json_version, item, disable_environment,
-                                                is_implicit, filename);
-                layer_node = layer_node->next;
-            } while (layer_node != NULL);
+            loader_json_iterate(json, &iter);
+            while (loader_json_next(&iter, &key, &layer_node)) {
+                if (loader_json_string_equals(&key, "layer")) {
+                    result = loader_read_json_layer(inst, layer_instance_list, &layer_node, json_version, is_implicit, filename);
+                }
+            }
         }
     }
 
@@ -2590,6 +2650,196 @@ out:
     return result;
 }
 
+// Manifest scan cache
+//
+// The layer and ICD scans run on every vkEnumerateInstance*Properties and vkCreateInstance call, and each one walks the
+// manifest directories, parses every JSON manifest and opens every ICD library.  Their results are kept here for the
+// life of the process.  While a scan runs, loader_get_manifest_files records each directory it searched and each
+// manifest it found in the entry's watch list.  The entry stays valid as long as none of those paths changed
+// existence, mtime or size, and the environment variables that select the search paths are unchanged.  The cached
+// ICD list holds its own reference to each library, so later scans don't unload and reload the drivers.
+//
+// Sub-second mtimes are compared where stat() reports them (Linux and Apple).  Elsewhere, and on file systems that only
+// keep whole seconds, a rewrite that keeps the size within the same second would go unnoticed, so a path modified in
+// the same second the scan started (or later) is never trusted: the next scan redoes the work and records a fresh time.
+
+struct loader_scan_watch {
+    char *path;
+    bool exists;
+    uint64_t size;
+    int64_t mtime;
+    int64_t mtime_nsec;
+};
+
+struct loader_scan_cache_entry {
+    bool valid;
+    // Cleared when a scan depends on state that can't be watched (the Windows registry)
+    bool cacheable;
+    char *environment;
+    // time() when the scan started
+    int64_t scan_time;
+    uint32_t watch_count;
+    uint32_t watch_capacity;
+    struct loader_scan_watch *watches;
+};
+
+static struct {
+    struct loader_scan_cache_entry layers;
+    struct loader_layer_list layer_list;
+    struct loader_scan_cache_entry implicit_layers;
+    struct loader_layer_list implicit_layer_list;
+    struct loader_scan_cache_entry icds;
+    struct loader_icd_tramp_list icd_list;
+} loader_scan_cache;
+
+// Entry whose watch list is being filled in by the scan in progress, if any.  Only touched with loader_scan_cache_lock
+// held.
+static struct loader_scan_cache_entry *loader_scan_recording = NULL;
+
+// Environment variables that change which manifest files a scan finds
+static const char *const loader_scan_env_vars[] = {
+    "VK_ICD_FILENAMES", LAYERS_PATH_ENV, "XDG_CONFIG_DIRS", "XDG_DATA_DIRS", "XDG_DATA_HOME", "HOME",
+};
+
+static void loader_scan_stat(const char *path, struct loader_scan_watch *watch) {
+    struct stat info;
+    memset(watch, 0, sizeof(*watch));
+    watch->path = (char *)path;
+    if (stat(path, &info) != 0) {
+        return;
+    }
+    watch->exists = true;
+    watch->size = (uint64_t)info.st_size;
+    watch->mtime = (int64_t)info.st_mtime;
+#if defined(__linux__)
+    watch->mtime_nsec = (int64_t)info.st_mtim.tv_nsec;
+#elif defined(__APPLE__)
+    watch->mtime_nsec = (int64_t)info.st_mtimespec.tv_nsec;
+#endif
+}
+
+// Build a single string holding the current value of every variable in loader_scan_env_vars
+static char *loader_scan_cache_environment(void) {
+    const uint32_t var_count = sizeof(loader_scan_env_vars) / sizeof(loader_scan_env_vars[0]);
+    char *values[sizeof(loader_scan_env_vars) / sizeof(loader_scan_env_vars[0])];
+    size_t length = 1;
+    for (uint32_t i = 0; i < var_count; i++) {
+        values[i] = loader_secure_getenv(loader_scan_env_vars[i], NULL);
+        length += strlen(loader_scan_env_vars[i]) + (values[i] ? strlen(values[i]) : 0) + 2;
+    }
+    char *environment = loader_instance_heap_alloc(NULL, length, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL != environment) {
+        environment[0] = '\0';
+        for (uint32_t i = 0; i < var_count; i++) {
+            strcat(environment, loader_scan_env_vars[i]);
+            strcat(environment, "=");
+            if (values[i]) strcat(environment, values[i]);
+            strcat(environment, "\n");
+        }
+    }
+    for (uint32_t i = 0; i < var_count; i++) {
+        if (values[i]) loader_free_getenv(values[i], NULL);
+    }
+    return environment;
+}
+
+static void loader_scan_cache_reset(struct loader_scan_cache_entry *entry) {
+    for (uint32_t i = 0; i < entry->watch_count; i++) {
+        loader_instance_heap_free(NULL, entry->watches[i].path);
+    }
+    loader_instance_heap_free(NULL, entry->watches);
+    loader_instance_heap_free(NULL, entry->environment);
+    memset(entry, 0, sizeof(*entry));
+}
+
+// Record a directory searched or manifest file found by the scan in progress
+static void loader_scan_cache_watch(const char *path) {
+    struct loader_scan_cache_entry *entry = loader_scan_recording;
+    if (NULL == entry || !entry->cacheable) {
+        return;
+    }
+    if (entry->watch_count == entry->watch_capacity) {
+        uint32_t new_capacity = entry->watch_capacity ? entry->watch_capacity * 2 : 16;
+        struct loader_scan_watch *watches =
+            loader_instance_heap_realloc(NULL, entry->watches, sizeof(struct loader_scan_watch) * entry->watch_capacity,
+                                         sizeof(struct loader_scan_watch) * new_capacity, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == watches) {
+            entry->cacheable = false;
+            return;
+        }
+        entry->watches = watches;
+        entry->watch_capacity = new_capacity;
+    }
+    char *path_copy = loader_instance_heap_alloc(NULL, strlen(path) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == path_copy) {
+        entry->cacheable = false;
+        return;
+    }
+    strcpy(path_copy, path);
+    loader_scan_stat(path_copy, &entry->watches[entry->watch_count++]);
+}
+
+#if defined(_WIN32)
+// Mark the scan in progress as depending on state the cache can't watch
+static void loader_scan_cache_uncacheable(void) {
+    if (NULL != loader_scan_recording) {
+        loader_scan_recording->cacheable = false;
+    }
+}
+#endif
+
+static bool loader_scan_cache_is_current(const struct loader_scan_cache_entry *entry) {
+    if (!entry->valid) {
+        return false;
+    }
+    char *environment = loader_scan_cache_environment();
+    bool current = NULL != environment && !strcmp(environment, entry->environment);
+    loader_instance_heap_free(NULL, environment);
+    for (uint32_t i = 0; current && i < entry->watch_count; i++) {
+        const struct loader_scan_watch *cached = &entry->watches[i];
+        struct loader_scan_watch now;
+        loader_scan_stat(cached->path, &now);
+        current = now.exists == cached->exists && now.size == cached->size && now.mtime == cached->mtime &&
+                  now.mtime_nsec == cached->mtime_nsec && (!cached->exists || cached->mtime < entry->scan_time);
+    }
+    return current;
+}
+
+static void loader_scan_cache_begin(struct loader_scan_cache_entry *entry) {
+    loader_scan_cache_reset(entry);
+    entry->environment = loader_scan_cache_environment();
+    entry->cacheable = NULL != entry->environment;
+    entry->scan_time = (int64_t)time(NULL);
+    loader_scan_recording = entry;
+}
+
+static void loader_scan_cache_end(struct loader_scan_cache_entry *entry, bool success) {
+    loader_scan_recording = NULL;
+    if (success && entry->cacheable) {
+        entry->valid = true;
+    } else {
+        loader_scan_cache_reset(entry);
+    }
+}
+
+// Replace the contents of dst with a deep copy of src
+static VkResult loader_copy_layer_list(const struct loader_instance *inst, struct loader_layer_list *dst,
+                                       const struct loader_layer_list *src) {
+    loader_delete_layer_properties(inst, dst);
+    for (uint32_t i = 0; i < src->count; i++) {
+        struct loader_layer_properties *props = loader_get_next_layer_property(inst, dst);
+        if (NULL == props) {
+            loader_delete_layer_properties(inst, dst);
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        if (VK_SUCCESS != loader_copy_layer_properties(inst, props, &src->list[i])) {
+            loader_delete_layer_properties(inst, dst);
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+    }
+    return VK_SUCCESS;
+}
+
 // Find the Vulkan library manifest files.
 //
 // This function scans the "location" or "env_override" directories/files
@@ -2798,6 +3048,8 @@ static VkResult loader_get_manifest_files(const struct loader_instance *inst, co
         }
         orig_loc = loc;
         loc = reg;
+        // Registry contents aren't watched, so results found through it can't be cached
+        loader_scan_cache_uncacheable();
 #endif
     } else {
         loc = loader_stack_alloc(strlen(override) + 1);
@@ -2819,6 +3071,7 @@ static VkResult loader_get_manifest_files(const struct loader_instance *inst, co
     while (*file) {
         next_file = loader_get_next_path(file);
         if (list_is_dirs) {
+            loader_scan_cache_watch(file);
             sysdir = opendir(file);
             name = NULL;
             if (sysdir) {
@@ -2883,6 +3136,7 @@ static VkResult loader_get_manifest_files(const struct loader_instance *inst, co
                 }
                 strcpy(out_files->filename_list[out_files->count], name);
                 out_files->count++;
+                loader_scan_cache_watch(name);
             } else if (!list_is_dirs) {
                 loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0, "Skipping manifest file %s, file name must end in .json",
                            name);
@@ -3014,7 +3268,7 @@ void loader_destroy_icd_lib_list() {}
 // \returns
 // Vulkan result
 // (on result == VK_SUCCESS) a list of icds that were discovered
-VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_tramp_list *icd_tramp_list) {
+static VkResult loader_icd_scan_uncached(const struct loader_instance *inst, struct loader_icd_tramp_list *icd_tramp_list) {
     char *file_str;
     uint16_t file_major_vers = 0;
     uint16_t file_minor_vers = 0;
@@ -3023,10 +3277,11 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
     struct loader_manifest_files manifest_files;
     VkResult res = VK_SUCCESS;
     bool lockedMutex = false;
-    cJSON *json = NULL;
+    struct loader_json_file json;
     uint32_t num_good_icds = 0;
 
     memset(&manifest_files, 0, sizeof(struct loader_manifest_files));
+    memset(&json, 0, sizeof(json));
 
     res = loader_scanned_icd_init(inst, icd_tramp_list);
     if (VK_SUCCESS != res) {
@@ -3048,12 +3303,8 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
             continue;
         }
 
-        VkResult temp_res = loader_get_json(inst, file_str, &json);
-        if (NULL == json || temp_res != VK_SUCCESS) {
-            if (NULL != json) {
-                cJSON_Delete(json);
-                json = NULL;
-            }
+        VkResult temp_res = loader_json_open(inst, file_str, &json);
+        if (temp_res != VK_SUCCESS) {
             // If we haven't already found an ICD, copy this result to
             // the returned result.
             if (num_good_icds == 0) {
@@ -3067,9 +3318,8 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
         }
         res = temp_res;
 
-        cJSON *item, *itemICD;
-        item = cJSON_GetObjectItem(json, "file_format_version");
-        if (item == NULL) {
+        struct loader_json_value item, itemICD;
+        if (!loader_json_get_object_item(&json.root, "file_format_version", &item)) {
             if (num_good_icds == 0) {
                 res = VK_ERROR_INITIALIZATION_FAILED;
             }
@@ -3077,25 +3327,12 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
                        "loader_icd_scan: ICD JSON %s does not have a"
                        " \'file_format_version\' field. Skipping ICD JSON.",
                        file_str);
-            cJSON_Delete(json);
-            json = NULL;
+            loader_json_close(inst, &json);
             continue;
         }
 
-        char *file_vers = cJSON_Print(item);
-        if (NULL == file_vers) {
-            // Only reason the print can fail is if there was an allocation issue
-            if (num_good_icds == 0) {
-                res = VK_ERROR_OUT_OF_HOST_MEMORY;
-            }
-            loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
-                       "loader_icd_scan: Failed retrieving ICD JSON %s"
-                       " \'file_format_version\' field.  Skipping ICD JSON",
-                       file_str);
-            cJSON_Delete(json);
-            json = NULL;
-            continue;
-        }
+        char file_vers[64];
+        loader_json_get_string(&item, file_vers, sizeof(file_vers));
         loader_log(inst, VK_DEBUG_REPORT_INFORMATION_BIT_EXT, 0, "Found ICD manifest file %s, version %s", file_str, file_vers);
 
         // Get the major/minor/and patch as integers for easier comparison
@@ -3117,29 +3354,11 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
                        "loader_icd_scan: Unexpected manifest file version "
                        "(expected 1.0.0 or 1.0.1), may cause errors");
         }
-        cJSON_Free(file_vers);
 
-        itemICD = cJSON_GetObjectItem(json, "ICD");
-        if (itemICD != NULL) {
-            item = cJSON_GetObjectItem(itemICD, "library_path");
-            if (item != NULL) {
-                char *temp = cJSON_Print(item);
-                if (!temp || strlen(temp) == 0) {
-                    if (num_good_icds == 0) {
-                        res = VK_ERROR_OUT_OF_HOST_MEMORY;
-                    }
-                    loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
-                               "loader_icd_scan: Failed retrieving ICD JSON %s"
-                               " \'library_path\' field.  Skipping ICD JSON.",
-                               file_str);
-                    cJSON_Free(temp);
-                    cJSON_Delete(json);
-                    json = NULL;
-                    continue;
-                }
-                // strip out extra quotes
-                temp[strlen(temp) - 1] = '\0';
-                char *library_path = loader_stack_alloc(strlen(temp) + 1);
+        if (loader_json_get_object_item(&json.root, "ICD", &itemICD)) {
+            if (loader_json_get_object_item(&itemICD, "library_path", &item)) {
+                size_t library_path_size = loader_json_get_string(&item, NULL, 0) + 1;
+                char *library_path = loader_stack_alloc(library_path_size);
                 if (NULL == library_path) {
                     loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
                                "loader_icd_scan: Failed to allocate space for "
@@ -3147,20 +3366,15 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
                                "ICD JSON.",
                                file_str);
                     res = VK_ERROR_OUT_OF_HOST_MEMORY;
-                    cJSON_Free(temp);
-                    cJSON_Delete(json);
-                    json = NULL;
                     goto out;
                 }
-                strcpy(library_path, &temp[1]);
-                cJSON_Free(temp);
+                loader_json_get_string(&item, library_path, library_path_size);
                 if (strlen(library_path) == 0) {
                     loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                                "loader_icd_scan: ICD JSON %s \'library_path\'"
                                " field is empty.  Skipping ICD JSON.",
                                file_str);
-                    cJSON_Delete(json);
-                    json = NULL;
+                    loader_json_close(inst, &json);
                     continue;
                 }
                 char fullpath[MAX_STRING_SIZE];
@@ -3180,28 +3394,10 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
                 }
 
                 uint32_t vers = 0;
-                item = cJSON_GetObjectItem(itemICD, "api_version");
-                if (item != NULL) {
-                    temp = cJSON_Print(item);
-                    if (NULL == temp) {
-                        loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
-                                   "loader_icd_scan: Failed retrieving ICD JSON %s"
-                                   " \'api_version\' field.  Skipping ICD JSON.",
-                                   file_str);
-
-                        // Only reason the print can fail is if there was an
-                        // allocation issue
-                        if (num_good_icds == 0) {
-                            res = VK_ERROR_OUT_OF_HOST_MEMORY;
-                        }
-
-                        cJSON_Free(temp);
-                        cJSON_Delete(json);
-                        json = NULL;
-                        continue;
-                    }
-                    vers = loader_make_version(temp);
-                    cJSON_Free(temp);
+                if (loader_json_get_object_item(&itemICD, "api_version", &item)) {
+                    char api_version[64];
+                    loader_json_get_string(&item, api_version, sizeof(api_version));
+                    vers = loader_make_version(api_version);
                 } else {
                     loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
                                "loader_icd_scan: ICD JSON %s does not have an"
@@ -3215,8 +3411,7 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
                                "loader_icd_scan: Failed to add ICD JSON %s. "
                                " Skipping ICD JSON.",
                                fullpath);
-                    cJSON_Delete(json);
-                    json = NULL;
+                    loader_json_close(inst, &json);
                     continue;
                 }
                 num_good_icds++;
@@ -3233,15 +3428,12 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
                        file_str);
         }
 
-        cJSON_Delete(json);
-        json = NULL;
+        loader_json_close(inst, &json);
     }
 
 out:
 
-    if (NULL != json) {
-        cJSON_Delete(json);
-    }
+    loader_json_close(inst, &json);
 
     if (NULL != manifest_files.filename_list) {
         for (uint32_t i = 0; i < manifest_files.count; i++) {
@@ -3258,26 +3450,99 @@ out:
     return res;
 }
 
-void loader_layer_scan(const struct loader_instance *inst, struct loader_layer_list *instance_layers) {
+// Replace the contents of dst with a copy of src.  Each copied entry takes its own reference on the (already loaded)
+// ICD library, so clearing one list never unloads a library the other still uses.
+static VkResult loader_copy_scanned_icds(const struct loader_instance *inst, struct loader_icd_tramp_list *dst,
+                                         const struct loader_icd_tramp_list *src) {
+    VkResult res = loader_scanned_icd_init(inst, dst);
+    if (VK_SUCCESS != res) {
+        return res;
+    }
+    for (uint32_t i = 0; i < src->count; i++) {
+        if ((dst->count * sizeof(struct loader_scanned_icd)) >= dst->capacity) {
+            dst->scanned_list = loader_instance_heap_realloc(inst, dst->scanned_list, dst->capacity, dst->capacity * 2,
+                                                             VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+            if (NULL == dst->scanned_list) {
+                loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                           "loader_copy_scanned_icds: Realloc failed on icd library list");
+                dst->capacity = 0;
+                dst->count = 0;
+                return VK_ERROR_OUT_OF_HOST_MEMORY;
+            }
+            dst->capacity *= 2;
+        }
+
+        struct loader_scanned_icd *icd = &dst->scanned_list[dst->count];
+        *icd = src->scanned_list[i];
+        icd->lib_name = (char *)loader_instance_heap_alloc(inst, strlen(src->scanned_list[i].lib_name) + 1,
+                                                           VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == icd->lib_name) {
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_copy_scanned_icds: Out of memory can't add ICD %s",
+                       src->scanned_list[i].lib_name);
+            loader_scanned_icd_clear(inst, dst);
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        strcpy(icd->lib_name, src->scanned_list[i].lib_name);
+        icd->handle = loader_platform_open_library(icd->lib_name);
+        if (NULL == icd->handle) {
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, loader_platform_open_library_error(icd->lib_name));
+            loader_instance_heap_free(inst, icd->lib_name);
+            loader_scanned_icd_clear(inst, dst);
+            return VK_ERROR_INCOMPATIBLE_DRIVER;
+        }
+        dst->count++;
+    }
+    return VK_SUCCESS;
+}
+
+VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_tramp_list *icd_tramp_list) {
+    VkResult res;
+
+    loader_platform_thread_lock_mutex(&loader_scan_cache_lock);
+    if (loader_scan_cache_is_current(&loader_scan_cache.icds)) {
+        res = loader_copy_scanned_icds(inst, icd_tramp_list, &loader_scan_cache.icd_list);
+        if (VK_SUCCESS == res) {
+            loader_log(inst, VK_DEBUG_REPORT_DEBUG_BIT_EXT, 0, "Using cached ICD manifest scan results");
+            loader_platform_thread_unlock_mutex(&loader_scan_cache_lock);
+            return res;
+        }
+    }
+
+    loader_scanned_icd_clear(NULL, &loader_scan_cache.icd_list);
+    loader_scan_cache_begin(&loader_scan_cache.icds);
+    res = loader_icd_scan_uncached(inst, icd_tramp_list);
+    bool cached = VK_SUCCESS == res && VK_SUCCESS == loader_copy_scanned_icds(NULL, &loader_scan_cache.icd_list, icd_tramp_list);
+    loader_scan_cache_end(&loader_scan_cache.icds, cached);
+    if (!loader_scan_cache.icds.valid) {
+        loader_scanned_icd_clear(NULL, &loader_scan_cache.icd_list);
+    }
+    loader_platform_thread_unlock_mutex(&loader_scan_cache_lock);
+    return res;
+}
+
+static VkResult loader_layer_scan_uncached(const struct loader_instance *inst, struct loader_layer_list *instance_layers) {
     char *file_str;
     struct loader_manifest_files manifest_files[2];  // [0] = explicit, [1] = implicit
-    cJSON *json;
+    struct loader_json_file json;
     uint32_t implicit;
     bool lockedMutex = false;
+    VkResult res;
 
     memset(manifest_files, 0, sizeof(struct loader_manifest_files) * 2);
 
     // Get a list of manifest files for explicit layers
-    if (VK_SUCCESS != loader_get_manifest_files(inst, LAYERS_PATH_ENV, LAYERS_SOURCE_PATH, true, true, DEFAULT_VK_ELAYERS_INFO,
-                                                RELATIVE_VK_ELAYERS_INFO, &manifest_files[0])) {
+    res = loader_get_manifest_files(inst, LAYERS_PATH_ENV, LAYERS_SOURCE_PATH, true, true, DEFAULT_VK_ELAYERS_INFO,
+                                    RELATIVE_VK_ELAYERS_INFO, &manifest_files[0]);
+    if (VK_SUCCESS != res) {
         goto out;
     }
 
     // Get a list of manifest files for any implicit layers
     // Pass NULL for environment variable override - implicit layers are not
     // overridden by LAYERS_PATH_ENV
-    if (VK_SUCCESS != loader_get_manifest_files(inst, NULL, NULL, true, false, DEFAULT_VK_ILAYERS_INFO, RELATIVE_VK_ILAYERS_INFO,
-                                                &manifest_files[1])) {
+    res = loader_get_manifest_files(inst, NULL, NULL, true, false, DEFAULT_VK_ILAYERS_INFO, RELATIVE_VK_ILAYERS_INFO,
+                                    &manifest_files[1]);
+    if (VK_SUCCESS != res) {
         goto out;
     }
 
@@ -3296,18 +3561,19 @@ void loader_layer_scan(const struct loader_instance *inst, struct loader_layer_l
             file_str = manifest_files[implicit].filename_list[i];
             if (file_str == NULL) continue;
 
-            // parse file into JSON struct
-            VkResult res = loader_get_json(inst, file_str, &json);
-            if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
+            // Map the file and check it is well-formed JSON
+            VkResult json_res = loader_json_open(inst, file_str, &json);
+            if (VK_ERROR_OUT_OF_HOST_MEMORY == json_res) {
+                res = json_res;
                 break;
-            } else if (VK_SUCCESS != res || NULL == json) {
+            } else if (VK_SUCCESS != json_res) {
                 continue;
             }
 
-            VkResult local_res = loader_add_layer_properties(inst, instance_layers, json, (implicit == 1), file_str);
-            cJSON_Delete(json);
+            res = loader_add_layer_properties(inst, instance_layers, &json.root, (implicit == 1), file_str);
+            loader_json_close(inst, &json);
 
-            if (VK_SUCCESS != local_res) {
+            if (VK_SUCCESS != res) {
                 goto out;
             }
         }
@@ -3327,6 +3593,7 @@ void loader_layer_scan(const struct loader_instance *inst, struct loader_layer_l
     // the list, then we need to add it manually.  This is likely because we're
     // dealing with a new loader, but an old layer folder.
     if (!found_std_val && !loader_add_legacy_std_val_layer(inst, instance_layers)) {
+        res = VK_ERROR_OUT_OF_HOST_MEMORY;
         goto out;
     }
 
@@ -3349,12 +3616,34 @@ out:
     if (lockedMutex) {
         loader_platform_thread_unlock_mutex(&loader_json_lock);
     }
+    return res;
 }
 
-void loader_implicit_layer_scan(const struct loader_instance *inst, struct loader_layer_list *instance_layers) {
+void loader_layer_scan(const struct loader_instance *inst, struct loader_layer_list *instance_layers) {
+    loader_platform_thread_lock_mutex(&loader_scan_cache_lock);
+    if (loader_scan_cache_is_current(&loader_scan_cache.layers) &&
+        VK_SUCCESS == loader_copy_layer_list(inst, instance_layers, &loader_scan_cache.layer_list)) {
+        loader_log(inst, VK_DEBUG_REPORT_DEBUG_BIT_EXT, 0, "Using cached layer manifest scan results");
+    } else {
+        loader_delete_layer_properties(NULL, &loader_scan_cache.layer_list);
+        loader_scan_cache_begin(&loader_scan_cache.layers);
+        VkResult res = loader_layer_scan_uncached(inst, instance_layers);
+        if (VK_SUCCESS == res) {
+            res = loader_copy_layer_list(NULL, &loader_scan_cache.layer_list, instance_layers);
+        }
+        loader_scan_cache_end(&loader_scan_cache.layers, VK_SUCCESS == res);
+        if (!loader_scan_cache.layers.valid) {
+            loader_delete_layer_properties(NULL, &loader_scan_cache.layer_list);
+        }
+    }
+    loader_platform_thread_unlock_mutex(&loader_scan_cache_lock);
+}
+
+static VkResult loader_implicit_layer_scan_uncached(const struct loader_instance *inst,
+                                                    struct loader_layer_list *instance_layers) {
     char *file_str;
     struct loader_manifest_files manifest_files;
-    cJSON *json;
+    struct loader_json_file json;
     uint32_t i;
 
     // Pass NULL for environment variable override - implicit layers are not
@@ -3362,7 +3651,7 @@ void loader_implicit_layer_scan(const struct loader_instance *inst, struct loade
     VkResult res = loader_get_manifest_files(inst, NULL, NULL, true, false, DEFAULT_VK_ILAYERS_INFO, RELATIVE_VK_ILAYERS_INFO,
                                              &manifest_files);
     if (VK_SUCCESS != res || manifest_files.count == 0) {
-        return;
+        return res;
     }
 
     // Cleanup any previously scanned libraries
@@ -3376,25 +3665,48 @@ void loader_implicit_layer_scan(const struct loader_instance *inst, struct loade
             continue;
         }
 
-        // parse file into JSON struct
-        res = loader_get_json(inst, file_str, &json);
-        if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
+        // Map the file and check it is well-formed JSON
+        VkResult json_res = loader_json_open(inst, file_str, &json);
+        if (VK_ERROR_OUT_OF_HOST_MEMORY == json_res) {
+            res = json_res;
             break;
-        } else if (VK_SUCCESS != res || NULL == json) {
+        } else if (VK_SUCCESS != json_res) {
             continue;
         }
 
-        res = loader_add_layer_properties(inst, instance_layers, json, true, file_str);
+        VkResult local_res = loader_add_layer_properties(inst, instance_layers, &json.root, true, file_str);
 
         loader_instance_heap_free(inst, file_str);
-        cJSON_Delete(json);
+        loader_json_close(inst, &json);
 
-        if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
+        if (VK_ERROR_OUT_OF_HOST_MEMORY == local_res) {
+            res = local_res;
             break;
         }
     }
     loader_instance_heap_free(inst, manifest_files.filename_list);
     loader_platform_thread_unlock_mutex(&loader_json_lock);
+    return res;
+}
+
+void loader_implicit_layer_scan(const struct loader_instance *inst, struct loader_layer_list *instance_layers) {
+    loader_platform_thread_lock_mutex(&loader_scan_cache_lock);
+    if (loader_scan_cache_is_current(&loader_scan_cache.implicit_layers) &&
+        VK_SUCCESS == loader_copy_layer_list(inst, instance_layers, &loader_scan_cache.implicit_layer_list)) {
+        loader_log(inst, VK_DEBUG_REPORT_DEBUG_BIT_EXT, 0, "Using cached implicit layer manifest scan results");
+    } else {
+        loader_delete_layer_properties(NULL, &loader_scan_cache.implicit_layer_list);
+        loader_scan_cache_begin(&loader_scan_cache.implicit_layers);
+        VkResult res = loader_implicit_layer_scan_uncached(inst, instance_layers);
+        if (VK_SUCCESS == res) {
+            res = loader_copy_layer_list(NULL, &loader_scan_cache.implicit_layer_list, instance_layers);
+        }
+        loader_scan_cache_end(&loader_scan_cache.implicit_layers, VK_SUCCESS == res);
+        if (!loader_scan_cache.implicit_layers.valid) {
+            loader_delete_layer_properties(NULL, &loader_scan_cache.implicit_layer_list);
+        }
+    }
+    loader_platform_thread_unlock_mutex(&loader_scan_cache_lock);
 }
 
 static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL loader_gpdpa_instance_internal(VkInstance inst, const char *pName) {
@@ -3534,12 +3846,11 @@ static void loader_init_dispatch_dev_ext_entry(struct loader_instance *inst, str
     }
 }
 
-// Find all dev extension in the hash table  and initialize the dispatch table
-// for dev  for each of those extension entrypoints found in hash table.
+// Initialize the dispatch table of dev for every unknown device extension entrypoint
+// already bound to a trampoline.
 void loader_init_dispatch_dev_ext(struct loader_instance *inst, struct loader_device *dev) {
-    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) {
-        if (inst->dev_ext_disp_hash[i].func_name != NULL)
-            loader_init_dispatch_dev_ext_entry(inst, dev, i, inst->dev_ext_disp_hash[i].func_name);
+    for (uint32_t i = 0; i < inst->dev_ext_names.count; i++) {
+        loader_init_dispatch_dev_ext_entry(inst, dev, i, inst->dev_ext_names.func_names[i]);
     }
 }
 
@@ -3575,112 +3886,99 @@ static bool loader_check_layer_list_for_dev_ext_address(const struct loader_laye
     return false;
 }
 
-static void loader_free_dev_ext_table(struct loader_instance *inst) {
-    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) {
-        loader_instance_heap_free(inst, inst->dev_ext_disp_hash[i].func_name);
-        loader_instance_heap_free(inst, inst->dev_ext_disp_hash[i].list.index);
+// Look funcName up in an unknown extension name table.  Returns true and the
+// trampoline slot the name is bound to if it has been seen before.
+static bool loader_ext_name_table_find(const struct loader_ext_name_table *table, const char *funcName, uint32_t hash,
+                                       uint32_t *slot) {
+    if (table->index_capacity == 0) return false;
+
+    // The index is never more than half full, so probing always reaches an empty bucket
+    const uint32_t mask = table->index_capacity - 1;
+    for (uint32_t bucket = hash & mask;; bucket = (bucket + 1) & mask) {
+        const uint32_t entry = table->index[bucket];
+        if (entry == 0) return false;
+        if (table->hashes[entry - 1] == hash && !strcmp(table->func_names[entry - 1], funcName)) {
+            *slot = entry - 1;
+            return true;
+        }
     }
-    memset(inst->dev_ext_disp_hash, 0, sizeof(inst->dev_ext_disp_hash));
 }
 
-static bool loader_add_dev_ext_table(struct loader_instance *inst, uint32_t *ptr_idx, const char *funcName) {
-    uint32_t i;
-    uint32_t idx = *ptr_idx;
-    struct loader_dispatch_hash_list *list = &inst->dev_ext_disp_hash[idx].list;
-
-    if (!inst->dev_ext_disp_hash[idx].func_name) {
-        // no entry here at this idx, so use it
-        assert(list->capacity == 0);
-        inst->dev_ext_disp_hash[idx].func_name =
-            (char *)loader_instance_heap_alloc(inst, strlen(funcName) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (inst->dev_ext_disp_hash[idx].func_name == NULL) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_add_dev_ext_table: Failed to allocate memory "
-                       "for func_name %s",
-                       funcName);
-            return false;
-        }
-        strncpy(inst->dev_ext_disp_hash[idx].func_name, funcName, strlen(funcName) + 1);
-        return true;
+static void loader_ext_name_table_insert_index(struct loader_ext_name_table *table, uint32_t slot) {
+    const uint32_t mask = table->index_capacity - 1;
+    uint32_t bucket = table->hashes[slot] & mask;
+    while (table->index[bucket] != 0) bucket = (bucket + 1) & mask;
+    table->index[bucket] = slot + 1;
+}
+
+static bool loader_ext_name_table_grow(struct loader_instance *inst, struct loader_ext_name_table *table) {
+    const uint32_t new_capacity = table->index_capacity ? table->index_capacity * 2 : 64;
+    uint32_t *new_index =
+        (uint32_t *)loader_instance_heap_alloc(inst, new_capacity * sizeof(uint32_t), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (new_index == NULL) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "loader_ext_name_table_grow: Failed to allocate memory "
+                   "for %d hash buckets",
+                   new_capacity);
+        return false;
     }
+    memset(new_index, 0, new_capacity * sizeof(uint32_t));
 
-    // check for enough capacity
-    if (list->capacity == 0) {
-        list->index = loader_instance_heap_alloc(inst, 8 * sizeof(*(list->index)), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (list->index == NULL) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_add_dev_ext_table: Failed to allocate memory "
-                       "for list index",
-                       funcName);
-            return false;
-        }
-        list->capacity = 8 * sizeof(*(list->index));
-    } else if (list->capacity < (list->count + 1) * sizeof(*(list->index))) {
-        list->index = loader_instance_heap_realloc(inst, list->index, list->capacity, list->capacity * 2,
-                                                   VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (list->index == NULL) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_add_dev_ext_table: Failed to reallocate memory "
-                       "for list index",
-                       funcName);
-            return false;
-        }
-        list->capacity *= 2;
+    loader_instance_heap_free(inst, table->index);
+    table->index = new_index;
+    table->index_capacity = new_capacity;
+    for (uint32_t slot = 0; slot < table->count; slot++) {
+        loader_ext_name_table_insert_index(table, slot);
     }
+    return true;
+}
 
-    // find an unused index in the hash table and use it
-    i = (idx + 1) % MAX_NUM_UNKNOWN_EXTS;
-    do {
-        if (!inst->dev_ext_disp_hash[i].func_name) {
-            assert(inst->dev_ext_disp_hash[i].list.capacity == 0);
-            inst->dev_ext_disp_hash[i].func_name =
-                (char *)loader_instance_heap_alloc(inst, strlen(funcName) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-            if (inst->dev_ext_disp_hash[i].func_name == NULL) {
-                loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                           "loader_add_dev_ext_table: Failed to allocate memory "
-                           "for func_name %s",
-                           funcName);
-                return false;
-            }
-            strncpy(inst->dev_ext_disp_hash[i].func_name, funcName, strlen(funcName) + 1);
-            list->index[list->count] = i;
-            list->count++;
-            *ptr_idx = i;
-            return true;
-        }
-        i = (i + 1) % MAX_NUM_UNKNOWN_EXTS;
-    } while (i != idx);
+// Bind funcName to the next free trampoline slot of an unknown extension name table.
+static bool loader_ext_name_table_add(struct loader_instance *inst, struct loader_ext_name_table *table, const char *funcName,
+                                      uint32_t hash, uint32_t *slot) {
+    if (table->count >= MAX_NUM_UNKNOWN_EXT_TRAMPOLINES) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "loader_ext_name_table_add: All %d trampolines for unknown "
+                   "extension functions are in use, can't add %s",
+                   MAX_NUM_UNKNOWN_EXT_TRAMPOLINES, funcName);
+        return false;
+    }
+    if ((table->count + 1) * 2 > table->index_capacity && !loader_ext_name_table_grow(inst, table)) {
+        return false;
+    }
 
-    loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-               "loader_add_dev_ext_table:  Could not insert into hash table; is "
-               "it full?");
+    const size_t name_size = strlen(funcName) + 1;
+    char *func_name = (char *)loader_instance_heap_alloc(inst, name_size, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (func_name == NULL) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "loader_ext_name_table_add: Failed to allocate memory "
+                   "for func_name %s",
+                   funcName);
+        return false;
+    }
+    strncpy(func_name, funcName, name_size);
 
-    return false;
+    *slot = table->count++;
+    table->func_names[*slot] = func_name;
+    table->hashes[*slot] = hash;
+    loader_ext_name_table_insert_index(table, *slot);
+    return true;
 }
 
-static bool loader_name_in_dev_ext_table(struct loader_instance *inst, uint32_t *idx, const char *funcName) {
-    uint32_t alt_idx;
-    if (inst->dev_ext_disp_hash[*idx].func_name && !strcmp(inst->dev_ext_disp_hash[*idx].func_name, funcName)) return true;
-
-    // funcName wasn't at the primary spot in the hash table
-    // search the list of secondary locations (shallow search, not deep search)
-    for (uint32_t i = 0; i < inst->dev_ext_disp_hash[*idx].list.count; i++) {
-        alt_idx = inst->dev_ext_disp_hash[*idx].list.index[i];
-        if (!strcmp(inst->dev_ext_disp_hash[*idx].func_name, funcName)) {
-            *idx = alt_idx;
-            return true;
-        }
+static void loader_ext_name_table_free(struct loader_instance *inst, struct loader_ext_name_table *table) {
+    for (uint32_t slot = 0; slot < table->count; slot++) {
+        loader_instance_heap_free(inst, table->func_names[slot]);
     }
-
-    return false;
+    loader_instance_heap_free(inst, table->index);
+    memset(table, 0, sizeof(*table));
 }
 
 // This function returns generic trampoline code address for unknown entry
 // points.
 // Presumably, these unknown entry points (as given by funcName) are device
 // extension entrypoints.  A hash table is used to keep a list of unknown entry
-// points and their mapping to the device extension dispatch table
-// (struct loader_dev_ext_dispatch_table).
+// points and the trampoline slot each is bound to, which is also its index in the
+// device extension dispatch table (struct loader_dev_ext_dispatch_table).
 // \returns
 // For a given entry point string (funcName), if an existing mapping is found
 // the
@@ -3689,15 +3987,13 @@ static bool loader_name_in_dev_ext_table(struct loader_instance *inst, uint32_t
 // has not been seen yet. Next check if a layer or ICD supports it.  If so then
 // a
 // new entry in the hash table is initialized and that trampoline address for
-// the new entry is returned. Null is returned if the hash table is full or
+// the new entry is returned. Null is returned if all trampolines are in use or
 // if no discovered layer or ICD returns a non-NULL GetProcAddr for it.
 void *loader_dev_ext_gpa(struct loader_instance *inst, const char *funcName) {
     uint32_t idx;
-    uint32_t seed = 0;
-
-    idx = murmurhash(funcName, strlen(funcName), seed) % MAX_NUM_UNKNOWN_EXTS;
+    const uint32_t hash = murmurhash(funcName, strlen(funcName), 0);
 
-    if (loader_name_in_dev_ext_table(inst, &idx, funcName))
+    if (loader_ext_name_table_find(&inst->dev_ext_names, funcName, hash, &idx))
         // found funcName already in hash
         return loader_get_dev_ext_trampoline(idx);
 
@@ -3708,7 +4004,7 @@ void *loader_dev_ext_gpa(struct loader_instance *inst, const char *funcName) {
         return NULL;
     }
 
-    if (loader_add_dev_ext_table(inst, &idx, funcName)) {
+    if (loader_ext_name_table_add(inst, &inst->dev_ext_names, funcName, hash, &idx)) {
         // successfully added new table entry
         // init any dev dispatch table entries as needed
         loader_init_dispatch_dev_ext_entry(inst, NULL, idx, funcName);
@@ -3749,98 +4045,6 @@ static bool loader_check_layer_list_for_phys_dev_ext_address(struct loader_insta
     return false;
 }
 
-static void loader_free_phys_dev_ext_table(struct loader_instance *inst) {
-    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) {
-        loader_instance_heap_free(inst, inst->phys_dev_ext_disp_hash[i].func_name);
-        loader_instance_heap_free(inst, inst->phys_dev_ext_disp_hash[i].list.index);
-    }
-    memset(inst->phys_dev_ext_disp_hash, 0, sizeof(inst->phys_dev_ext_disp_hash));
-}
-
-static bool loader_add_phys_dev_ext_table(struct loader_instance *inst, uint32_t *ptr_idx, const char *funcName) {
-    uint32_t i;
-    uint32_t idx = *ptr_idx;
-    struct loader_dispatch_hash_list *list = &inst->phys_dev_ext_disp_hash[idx].list;
-
-    if (!inst->phys_dev_ext_disp_hash[idx].func_name) {
-        // no entry here at this idx, so use it
-        assert(list->capacity == 0);
-        inst->phys_dev_ext_disp_hash[idx].func_name =
-            (char *)loader_instance_heap_alloc(inst, strlen(funcName) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (inst->phys_dev_ext_disp_hash[idx].func_name == NULL) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_add_phys_dev_ext_table() can't allocate memory for "
-                       "func_name");
-            return false;
-        }
-        strncpy(inst->phys_dev_ext_disp_hash[idx].func_name, funcName, strlen(funcName) + 1);
-        return true;
-    }
-
-    // check for enough capacity
-    if (list->capacity == 0) {
-        list->index = loader_instance_heap_alloc(inst, 8 * sizeof(*(list->index)), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (list->index == NULL) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_add_phys_dev_ext_table() can't allocate list memory");
-            return false;
-        }
-        list->capacity = 8 * sizeof(*(list->index));
-    } else if (list->capacity < (list->count + 1) * sizeof(*(list->index))) {
-        list->index = loader_instance_heap_realloc(inst, list->index, list->capacity, list->capacity * 2,
-                                                   VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (list->index == NULL) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_add_phys_dev_ext_table() can't reallocate list memory");
-            return false;
-        }
-        list->capacity *= 2;
-    }
-
-    // find an unused index in the hash table and use it
-    i = (idx + 1) % MAX_NUM_UNKNOWN_EXTS;
-    do {
-        if (!inst->phys_dev_ext_disp_hash[i].func_name) {
-            assert(inst->phys_dev_ext_disp_hash[i].list.capacity == 0);
-            inst->phys_dev_ext_disp_hash[i].func_name =
-                (char *)loader_instance_heap_alloc(inst, strlen(funcName) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-            if (inst->phys_dev_ext_disp_hash[i].func_name == NULL) {
-                loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                           "loader_add_dev_ext_table() can't reallocate "
-                           "func_name memory");
-                return false;
-            }
-            strncpy(inst->phys_dev_ext_disp_hash[i].func_name, funcName, strlen(funcName) + 1);
-            list->index[list->count] = i;
-            list->count++;
-            *ptr_idx = i;
-            return true;
-        }
-        i = (i + 1) % MAX_NUM_UNKNOWN_EXTS;
-    } while (i != idx);
-
-    loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-               "loader_add_phys_dev_ext_table() couldn't insert into hash table; is "
-               "it full?");
-    return false;
-}
-
-static bool loader_name_in_phys_dev_ext_table(struct loader_instance *inst, uint32_t *idx, const char *funcName) {
-    uint32_t alt_idx;
-    if (inst->phys_dev_ext_disp_hash[*idx].func_name && !strcmp(inst->phys_dev_ext_disp_hash[*idx].func_name, funcName))
-        return true;
-
-    // funcName wasn't at the primary spot in the hash table
-    // search the list of secondary locations (shallow search, not deep search)
-    for (uint32_t i = 0; i < inst->phys_dev_ext_disp_hash[*idx].list.count; i++) {
-        alt_idx = inst->phys_dev_ext_disp_hash[*idx].list.index[i];
-        if (!strcmp(inst->phys_dev_ext_disp_hash[*idx].func_name, funcName)) {
-            *idx = alt_idx;
-            return true;
-        }
-    }
-
-    return false;
-}
-
 // This function returns a generic trampoline and/or terminator function
 // address for any unknown physical device extension commands.  A hash
 // table is used to keep a list of unknown entry points and their
@@ -3855,12 +4059,11 @@ static bool loader_name_in_phys_dev_ext_table(struct loader_instance *inst, uint
 // check if a layer or and ICD supports it.  If so then a new entry in
 // the hash table is initialized and the trampoline and/or terminator
 // addresses are returned.
-// Null is returned if the hash table is full or if no discovered layer or
+// Null is returned if all trampolines are in use or if no discovered layer or
 // ICD returns a non-NULL GetProcAddr for it.
 bool loader_phys_dev_ext_gpa(struct loader_instance *inst, const char *funcName, bool perform_checking, void **tramp_addr,
                              void **term_addr) {
     uint32_t idx;
-    uint32_t seed = 0;
     bool success = false;
 
     if (inst == NULL) {
@@ -3874,24 +4077,30 @@ bool loader_phys_dev_ext_gpa(struct loader_instance *inst, const char *funcName,
         *term_addr = NULL;
     }
 
-    // We should always check to see if any ICD supports it.
-    if (!loader_check_icds_for_phys_dev_ext_address(inst, funcName)) {
-        // If we're not checking layers, or we are and it's not in a layer, just
-        // return
-        if (!perform_checking || !loader_check_layer_list_for_phys_dev_ext_address(inst, funcName)) {
+    const uint32_t hash = murmurhash(funcName, strlen(funcName), 0);
+    if (loader_ext_name_table_find(&inst->phys_dev_ext_names, funcName, hash, &idx)) {
+        // Already set up.  Without checking, only hand out the terminator if an
+        // ICD supports it.
+        if (!perform_checking && !loader_check_icds_for_phys_dev_ext_address(inst, funcName)) {
             goto out;
         }
-    }
-
-    idx = murmurhash(funcName, strlen(funcName), seed) % MAX_NUM_UNKNOWN_EXTS;
-    if (perform_checking && !loader_name_in_phys_dev_ext_table(inst, &idx, funcName)) {
+    } else {
         uint32_t i;
-        bool added = false;
 
-        // Only need to add first one to get index in Instance.  Others will use
-        // the same index.
-        if (!added && loader_add_phys_dev_ext_table(inst, &idx, funcName)) {
-            added = true;
+        // Entries are only added with checking, which is what sets them up
+        if (!perform_checking) {
+            goto out;
+        }
+
+        // See if any ICD or layer supports it
+        if (!loader_check_icds_for_phys_dev_ext_address(inst, funcName) &&
+            !loader_check_layer_list_for_phys_dev_ext_address(inst, funcName)) {
+            goto out;
+        }
+
+        // Only the instance needs an entry.  The ICDs use the same index.
+        if (!loader_ext_name_table_add(inst, &inst->phys_dev_ext_names, funcName, hash, &idx)) {
+            goto out;
         }
 
         // Setup the ICD function pointers
@@ -3942,12 +4151,17 @@ out:
 }
 
 struct loader_instance *loader_get_instance(const VkInstance instance) {
-    // look up the loader_instance in our list by comparing dispatch tables, as
-    // there is no guarantee the instance is still a loader_instance* after any
-    // layers which wrap the instance object.
+    // look up the loader_instance by its dispatch table, as there is no
+    // guarantee the instance is still a loader_instance* after any layers
+    // which wrap the instance object.
     const VkLayerInstanceDispatchTable *disp;
     struct loader_instance *ptr_instance = NULL;
     disp = loader_get_instance_layer_dispatch(instance);
+    struct loader_dispatch_index_entry entry;
+    if (loader_dispatch_index_lookup(&loader.instance_index, disp, &entry)) {
+        return (struct loader_instance *)entry.object;
+    }
+    // Only reached if indexing the instance ran out of memory
     for (struct loader_instance *inst = loader.instances; inst; inst = inst->next) {
         if (&inst->disp->layer_inst_disp == disp) {
             ptr_instance = inst;
@@ -4747,6 +4961,7 @@ VKAPI_ATTR void VKAPI_CALL terminator_DestroyInstance(VkInstance instance, const
     struct loader_icd_term *next_icd_term;
 
     // Remove this instance from the list of instances:
+    loader_remove_instance_from_index(ptr_instance);
     struct loader_instance *prev = NULL;
     struct loader_instance *next = loader.instances;
     while (next != NULL) {
@@ -4788,8 +5003,8 @@ VKAPI_ATTR void VKAPI_CALL terminator_DestroyInstance(VkInstance instance, const
         }
         loader_instance_heap_free(ptr_instance, ptr_instance->phys_dev_groups_term);
     }
-    loader_free_dev_ext_table(ptr_instance);
-    loader_free_phys_dev_ext_table(ptr_instance);
+    loader_ext_name_table_free(ptr_instance, &ptr_instance->dev_ext_names);
+    loader_ext_name_table_free(ptr_instance, &ptr_instance->phys_dev_ext_names);
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo *pCreateInfo,
@@ -4944,7 +5159,31 @@ VkResult setupLoaderTrampPhysDevs(VkInstance instance) {
         goto out;
     }
 
+    // Asking for as many devices as there were last time gets the whole list in one call down the chain, and while it
+    // matches the current list there is nothing to rebuild.  Applications may enumerate every frame to check for
+    // hot-plugged devices.  On any change, query the count first like an application would, so that layers tracking it
+    // stay in step.
+    bool changed = true;
+    if (0 < inst->phys_dev_count_tramp) {
+        total_count = inst->phys_dev_count_tramp;
+        local_phys_devs = loader_stack_alloc(sizeof(VkPhysicalDevice) * total_count);
+        if (NULL != local_phys_devs) {
+            res = inst->disp->layer_inst_disp.EnumeratePhysicalDevices(instance, &total_count, local_phys_devs);
+            if (VK_SUCCESS == res && total_count == inst->phys_dev_count_tramp) {
+                changed = false;
+                for (uint32_t i = 0; !changed && i < total_count; i++) {
+                    changed = local_phys_devs[i] != inst->phys_devs_tramp[i]->phys_dev;
+                }
+            }
+        }
+    }
+    if (!changed) {
+        res = VK_SUCCESS;
+        goto out;
+    }
+
     // Query how many gpus there
+    total_count = 0;
     res = inst->disp->layer_inst_disp.EnumeratePhysicalDevices(instance, &total_count, NULL);
     if (res != VK_SUCCESS) {
         loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
@@ -5035,7 +5274,7 @@ out:
             loader_instance_heap_free(inst, new_phys_devs);
         }
         total_count = 0;
-    } else {
+    } else if (NULL != new_phys_devs) {
         // Free everything that didn't carry over to the new array of
         // physical devices
         if (NULL != inst->phys_devs_tramp) {
@@ -5085,10 +5324,57 @@ VkResult setupLoaderTermPhysDevs(struct loader_instance *inst) {
     memset(icd_phys_dev_array, 0, sizeof(struct loader_phys_dev_per_icd) * inst->total_icd_count);
     icd_term = inst->icd_terms;
 
+    // The previous list holds each ICD's physical devices together, in ICD order, so walk it alongside the ICDs to spot
+    // any change.  Applications may enumerate every frame to check for hot-plugged devices, and as long as nothing
+    // changed the list is kept as it is.
+    bool changed = (NULL == inst->phys_devs_term);
+    uint32_t cached_idx = 0;
+
     // For each ICD, query the number of physical devices, and then get an
     // internal value for those physical devices.
     for (uint32_t icd_idx = 0; NULL != icd_term; icd_term = icd_term->next, icd_idx++) {
-        res = icd_term->dispatch.EnumeratePhysicalDevices(icd_term->instance, &icd_phys_dev_array[icd_idx].count, NULL);
+        uint32_t cached_count = 0;
+        while (cached_idx + cached_count < inst->phys_dev_count_term &&
+               inst->phys_devs_term[cached_idx + cached_count]->this_icd_term == icd_term) {
+            cached_count++;
+        }
+
+        // Asking for as many devices as the ICD had last time gets the whole list in one call unless it grew
+        res = VK_INCOMPLETE;
+        if (0 < cached_count) {
+            icd_phys_dev_array[icd_idx].count = cached_count;
+            icd_phys_dev_array[icd_idx].phys_devs = (VkPhysicalDevice *)loader_stack_alloc(cached_count * sizeof(VkPhysicalDevice));
+            if (NULL != icd_phys_dev_array[icd_idx].phys_devs) {
+                res = icd_term->dispatch.EnumeratePhysicalDevices(icd_term->instance, &icd_phys_dev_array[icd_idx].count,
+                                                                  icd_phys_dev_array[icd_idx].phys_devs);
+            }
+        }
+
+        if (VK_INCOMPLETE == res) {
+            res = icd_term->dispatch.EnumeratePhysicalDevices(icd_term->instance, &icd_phys_dev_array[icd_idx].count, NULL);
+            if (VK_SUCCESS != res) {
+                loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                           "setupLoaderTermPhysDevs:  Call to "
+                           "ICD %d's \'vkEnumeratePhysicalDevices\' failed with"
+                           " error 0x%08x",
+                           icd_idx, res);
+                goto out;
+            }
+
+            icd_phys_dev_array[icd_idx].phys_devs =
+                (VkPhysicalDevice *)loader_stack_alloc(icd_phys_dev_array[icd_idx].count * sizeof(VkPhysicalDevice));
+            if (NULL == icd_phys_dev_array[icd_idx].phys_devs) {
+                loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                           "setupLoaderTermPhysDevs:  Failed to allocate temporary "
+                           "ICD Physical device array for ICD %d of size %d",
+                           icd_idx, inst->total_gpu_count);
+                res = VK_ERROR_OUT_OF_HOST_MEMORY;
+                goto out;
+            }
+
+            res = icd_term->dispatch.EnumeratePhysicalDevices(icd_term->instance, &(icd_phys_dev_array[icd_idx].count),
+                                                              icd_phys_dev_array[icd_idx].phys_devs);
+        }
         if (VK_SUCCESS != res) {
             loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
                        "setupLoaderTermPhysDevs:  Call to "
@@ -5097,25 +5383,16 @@ VkResult setupLoaderTermPhysDevs(struct loader_instance *inst) {
                        icd_idx, res);
             goto out;
         }
-
-        icd_phys_dev_array[icd_idx].phys_devs =
-            (VkPhysicalDevice *)loader_stack_alloc(icd_phys_dev_array[icd_idx].count * sizeof(VkPhysicalDevice));
-        if (NULL == icd_phys_dev_array[icd_idx].phys_devs) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "setupLoaderTermPhysDevs:  Failed to allocate temporary "
-                       "ICD Physical device array for ICD %d of size %d",
-                       icd_idx, inst->total_gpu_count);
-            res = VK_ERROR_OUT_OF_HOST_MEMORY;
-            goto out;
-        }
-
-        res = icd_term->dispatch.EnumeratePhysicalDevices(icd_term->instance, &(icd_phys_dev_array[icd_idx].count),
-                                                          icd_phys_dev_array[icd_idx].phys_devs);
-        if (VK_SUCCESS != res) {
-            goto out;
-        }
         inst->total_gpu_count += icd_phys_dev_array[icd_idx].count;
         icd_phys_dev_array[icd_idx].this_icd_term = icd_term;
+
+        if (!changed) {
+            changed = icd_phys_dev_array[icd_idx].count != cached_count;
+            for (uint32_t pd_idx = 0; !changed && pd_idx < cached_count; pd_idx++) {
+                changed = icd_phys_dev_array[icd_idx].phys_devs[pd_idx] != inst->phys_devs_term[cached_idx + pd_idx]->phys_dev;
+            }
+        }
+        cached_idx += cached_count;
     }
 
     if (0 == inst->total_gpu_count) {
@@ -5126,6 +5403,11 @@ VkResult setupLoaderTermPhysDevs(struct loader_instance *inst) {
         goto out;
     }
 
+    // Every ICD reported the same devices as last time (and no ICD's devices went missing)
+    if (!changed && cached_idx == inst->phys_dev_count_term) {
+        goto out;
+    }
+
     new_phys_devs = loader_instance_heap_alloc(inst, sizeof(struct loader_physical_device_term *) * inst->total_gpu_count,
                                                VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
     if (NULL == new_phys_devs) {
@@ -5186,7 +5468,7 @@ out:
             loader_instance_heap_free(inst, new_phys_devs);
         }
         inst->total_gpu_count = 0;
-    } else {
+    } else if (NULL != new_phys_devs) {
         // Free everything that didn't carry over to the new array of
         // physical devices.  Everything else will have been copied over
         // to the new array.
@@ -52,11 +52,11 @@
 #define VK_MINOR(version) ((version >> 12) & 0x3ff)
 #define VK_PATCH(version) (version & 0xfff)
 
-// This is defined in vk_layer.h, but if there's problems we need to create the define
-// here.
-#ifndef MAX_NUM_UNKNOWN_EXTS
-#define MAX_NUM_UNKNOWN_EXTS 250
-#endif
+// Number of generic trampolines instantiated in dev_ext_trampoline.c and of trampoline/terminator
+// pairs in phys_dev_ext.c.  Every unknown device or physical device extension entry point handed
+// out by an instance is bound to one of them, so this is the limit on distinct unknown names.
+// The instantiation lists in those files must be kept in sync with it.
+#define MAX_NUM_UNKNOWN_EXT_TRAMPOLINES 1000
 
 enum layer_type_flags {
     VK_LAYER_TYPE_FLAG_INSTANCE_LAYER = 0x1,  // If not set, indicates Device layer
@@ -148,24 +148,22 @@ struct loader_layer_list {
     struct loader_layer_properties *list;
 };
 
-struct loader_dispatch_hash_list {
-    size_t capacity;
-    uint32_t count;
-    uint32_t *index;  // index into the dev_ext dispatch table
-};
-
-// loader_dispatch_hash_entry and loader_dev_ext_dispatch_table.dev_ext have
-// one to one correspondence; one loader_dispatch_hash_entry for one dev_ext
-// dispatch entry.
-// Also have a one to one correspondence with functions in dev_ext_trampoline.c
-struct loader_dispatch_hash_entry {
-    char *func_name;
-    struct loader_dispatch_hash_list list;  // to handle hashing collisions
+// Binds unknown extension entry point names to trampoline slots.  Slot i corresponds to
+// entry i of the dev_ext / phys_dev_ext dispatch arrays and to the i'th function in
+// dev_ext_trampoline.c or phys_dev_ext.c.  Slots are handed out in order and stay bound for
+// the life of the instance.  Names are looked up through an open-addressed, linearly probed
+// index which is grown once it is half full.
+struct loader_ext_name_table {
+    uint32_t count;           // number of slots in use
+    uint32_t index_capacity;  // number of buckets in index, a power of two
+    uint32_t *index;          // slot + 1 for an occupied bucket, 0 for an empty one
+    uint32_t hashes[MAX_NUM_UNKNOWN_EXT_TRAMPOLINES];
+    char *func_names[MAX_NUM_UNKNOWN_EXT_TRAMPOLINES];
 };
 
 typedef void(VKAPI_PTR *PFN_vkDevExt)(VkDevice device);
 struct loader_dev_ext_dispatch_table {
-    PFN_vkDevExt dev_ext[MAX_NUM_UNKNOWN_EXTS];
+    PFN_vkDevExt dev_ext[MAX_NUM_UNKNOWN_EXT_TRAMPOLINES];
 };
 
 struct loader_dev_dispatch_table {
@@ -206,7 +204,7 @@ struct loader_icd_term {
 
     struct loader_icd_term *next;
 
-    PFN_PhysDevExt phys_dev_ext[MAX_NUM_UNKNOWN_EXTS];
+    PFN_PhysDevExt phys_dev_ext[MAX_NUM_UNKNOWN_EXT_TRAMPOLINES];
 };
 
 // Per ICD library structure
@@ -220,7 +218,7 @@ struct loader_instance_dispatch_table {
     VkLayerInstanceDispatchTable layer_inst_disp;  // must be first entry in structure
 
     // Physical device functions unknown to the loader
-    PFN_PhysDevExt phys_dev_ext[MAX_NUM_UNKNOWN_EXTS];
+    PFN_PhysDevExt phys_dev_ext[MAX_NUM_UNKNOWN_EXT_TRAMPOLINES];
 };
 
 // Per instance structure
@@ -250,8 +248,8 @@ struct loader_instance {
     struct loader_icd_term *icd_terms;
     struct loader_icd_tramp_list icd_tramp_list;
 
-    struct loader_dispatch_hash_entry dev_ext_disp_hash[MAX_NUM_UNKNOWN_EXTS];
-    struct loader_dispatch_hash_entry phys_dev_ext_disp_hash[MAX_NUM_UNKNOWN_EXTS];
+    struct loader_ext_name_table dev_ext_names;
+    struct loader_ext_name_table phys_dev_ext_names;
 
     struct loader_msg_callback_map_entry *icd_msg_callback_map;
 
@@ -327,8 +325,30 @@ struct loader_physical_device_term {
     VkPhysicalDevice phys_dev;  // object from ICD
 };
 
+// Open-addressed, linearly probed table from a dispatchable object's dispatch table pointer
+// (its first word) to the loader structure owning that table.  Lookups come from entry points
+// that don't take loader_lock (vkGetDeviceProcAddr, the WSI functions), while removal moves
+// entries around, so every access goes through loader_dispatch_index_lock and lookups copy
+// the entry out.
+struct loader_dispatch_index_entry {
+    const void *key;                   // dispatch table pointer, NULL for an empty bucket
+    void *object;                      // struct loader_instance or struct loader_device
+    struct loader_icd_term *icd_term;  // devices only
+    uint32_t icd_index;                // devices only, position of icd_term in its instance's list
+};
+
+struct loader_dispatch_index {
+    uint32_t count;
+    uint32_t capacity;  // a power of two
+    struct loader_dispatch_index_entry *entries;
+};
+
 struct loader_struct {
     struct loader_instance *instances;
+
+    // Both indexes are only accessed with loader_dispatch_index_lock held
+    struct loader_dispatch_index instance_index;
+    struct loader_dispatch_index device_index;
 };
 
 struct loader_scanned_icd {
@@ -451,6 +471,8 @@ bool loader_phys_dev_ext_gpa(struct loader_instance *inst, const char *funcName,
 void *loader_get_phys_dev_ext_tramp(uint32_t index);
 void *loader_get_phys_dev_ext_termin(uint32_t index);
 struct loader_instance *loader_get_instance(const VkInstance instance);
+void loader_add_instance_to_index(struct loader_instance *inst);
+void loader_remove_instance_from_index(const struct loader_instance *inst);
 void loader_deactivate_layers(const struct loader_instance *instance, struct loader_device *device, struct loader_layer_list *list);
 struct loader_device *loader_create_logical_device(const struct loader_instance *inst, const VkAllocationCallbacks *pAllocator);
 void loader_add_logical_device(const struct loader_instance *inst, struct loader_icd_term *icd_term,
@@ -0,0 +1,478 @@
+/*
+ * Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "vk_loader_platform.h"
+#include "loader.h"
+#include "manifest_json.h"
+
+// Manifests are only a few levels deep.  The limit keeps a corrupt file from running the validation off the stack.
+#define LOADER_JSON_MAX_DEPTH 64
+
+// Files smaller than this are read into a heap buffer rather than mapped.  Manifests are a few KB, where mapping saves
+// nothing, and a mapped file that is truncated while it's being parsed raises SIGBUS instead of a read error.
+#define LOADER_JSON_MAP_THRESHOLD (64 * 1024)
+
+// Anything up to and including space counts as whitespace, as it did for cJSON
+static const char *json_skip_whitespace(const char *pos, const char *end) {
+    while (pos < end && (unsigned char)*pos <= ' ') {
+        pos++;
+    }
+    return pos;
+}
+
+static int json_hex_digit(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static char json_to_lower(char c) { return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c; }
+
+static uint32_t json_read_hex4(const char *pos) {
+    return (uint32_t)((json_hex_digit(pos[0]) << 12) | (json_hex_digit(pos[1]) << 8) | (json_hex_digit(pos[2]) << 4) |
+                      json_hex_digit(pos[3]));
+}
+
+// Check a \u escape.  pos points at the 'u'; the return value is the last character of the escape, including the low
+// half of a surrogate pair, or NULL if it isn't four hex digits, is \u0000, or is half of a surrogate pair on its own.
+static const char *json_parse_unicode(const char *pos, const char *end) {
+    if (end - pos < 5) {
+        return NULL;
+    }
+    for (uint32_t i = 1; i <= 4; i++) {
+        if (json_hex_digit(pos[i]) < 0) {
+            return NULL;
+        }
+    }
+    uint32_t code = json_read_hex4(pos + 1);
+    if (code == 0 || (code >= 0xDC00 && code <= 0xDFFF)) {
+        return NULL;
+    }
+    pos += 4;
+    if (code >= 0xD800 && code <= 0xDBFF) {
+        if (end - pos < 7 || pos[1] != '\\' || pos[2] != 'u') {
+            return NULL;
+        }
+        for (uint32_t i = 3; i <= 6; i++) {
+            if (json_hex_digit(pos[i]) < 0) {
+                return NULL;
+            }
+        }
+        uint32_t low = json_read_hex4(pos + 3);
+        if (low < 0xDC00 || low > 0xDFFF) {
+            return NULL;
+        }
+        pos += 6;
+    }
+    return pos;
+}
+
+static const char *json_parse_value(const char *pos, const char *end, uint32_t depth);
+
+// Each json_parse_* function takes the first character of a value and returns the character after it, or NULL if the
+// value isn't well-formed.  The same functions skip over values when looking things up, so lookups never need to
+// handle bad input.
+static const char *json_parse_string(const char *pos, const char *end) {
+    for (pos++; pos < end; pos++) {
+        if (*pos == '"') {
+            return pos + 1;
+        }
+        if (*pos == '\\') {
+            if (++pos == end) {
+                return NULL;
+            }
+            if (*pos == 'u' && NULL == (pos = json_parse_unicode(pos, end))) {
+                return NULL;
+            }
+        }
+    }
+    return NULL;
+}
+
+static const char *json_parse_number(const char *pos, const char *end) {
+    const char *digits = (*pos == '-') ? pos + 1 : pos;
+    for (pos = digits; pos < end; pos++) {
+        if (!((*pos >= '0' && *pos <= '9') || *pos == '.' || *pos == 'e' || *pos == 'E' || *pos == '+' || *pos == '-')) {
+            break;
+        }
+    }
+    return (pos > digits) ? pos : NULL;
+}
+
+static const char *json_parse_literal(const char *pos, const char *end, const char *literal) {
+    size_t length = strlen(literal);
+    if ((size_t)(end - pos) < length || strncmp(pos, literal, length) != 0) {
+        return NULL;
+    }
+    return pos + length;
+}
+
+static const char *json_parse_container(const char *pos, const char *end, uint32_t depth) {
+    const char close = (*pos == '{') ? '}' : ']';
+    if (depth >= LOADER_JSON_MAX_DEPTH) {
+        return NULL;
+    }
+    pos = json_skip_whitespace(pos + 1, end);
+    if (pos < end && *pos == close) {
+        return pos + 1;
+    }
+    while (pos < end) {
+        if (close == '}') {
+            if (*pos != '"' || NULL == (pos = json_parse_string(pos, end))) {
+                return NULL;
+            }
+            pos = json_skip_whitespace(pos, end);
+            if (pos == end || *pos != ':') {
+                return NULL;
+            }
+            pos = json_skip_whitespace(pos + 1, end);
+        }
+        pos = json_parse_value(pos, end, depth + 1);
+        if (NULL == pos) {
+            return NULL;
+        }
+        pos = json_skip_whitespace(pos, end);
+        if (pos == end) {
+            return NULL;
+        } else if (*pos == close) {
+            return pos + 1;
+        } else if (*pos != ',') {
+            return NULL;
+        }
+        pos = json_skip_whitespace(pos + 1, end);
+    }
+    return NULL;
+}
+
+static const char *json_parse_value(const char *pos, const char *end, uint32_t depth) {
+    if (pos == end) {
+        return NULL;
+    }
+    switch (*pos) {
+        case '"':
+            return json_parse_string(pos, end);
+        case '{':
+        case '[':
+            return json_parse_container(pos, end, depth);
+        case 'n':
+            return json_parse_literal(pos, end, "null");
+        case 't':
+            return json_parse_literal(pos, end, "true");
+        case 'f':
+            return json_parse_literal(pos, end, "false");
+        default:
+            if (*pos == '-' || (*pos >= '0' && *pos <= '9')) {
+                return json_parse_number(pos, end);
+            }
+            return NULL;
+    }
+}
+
+// Map the file if it's large, otherwise or if that fails read it into a heap buffer.  Windows refuses to truncate a file
+// while a view of it is mapped, so there a mapping can't fault the way it can elsewhere.
+static VkResult json_load_file(const struct loader_instance *inst, const char *filename, struct loader_json_file *file) {
+#if defined(_WIN32)
+    HANDLE handle = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (INVALID_HANDLE_VALUE != handle) {
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(handle, &size) && size.QuadPart > 0 && (uint64_t)size.QuadPart <= (uint64_t)SIZE_MAX) {
+            // The view keeps the mapping alive once both handles are closed
+            HANDLE mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (NULL != mapping) {
+                file->data = (const char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                CloseHandle(mapping);
+            }
+            if (NULL != file->data) {
+                file->size = (size_t)size.QuadPart;
+                file->mapped = true;
+            }
+        }
+        CloseHandle(handle);
+    }
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd >= 0) {
+        struct stat info;
+        if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size >= LOADER_JSON_MAP_THRESHOLD) {
+            void *data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (MAP_FAILED != data) {
+                file->data = (const char *)data;
+                file->size = (size_t)info.st_size;
+                file->mapped = true;
+            }
+        }
+        close(fd);
+    }
+#endif
+    if (file->mapped) {
+        return VK_SUCCESS;
+    }
+
+    FILE *fp = fopen(filename, "rb");
+    if (NULL == fp) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_json_open: Failed to open JSON file %s", filename);
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    VkResult res = VK_SUCCESS;
+    fseek(fp, 0, SEEK_END);
+    long len = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char *buffer = NULL;
+    if (len < 0) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_json_open: Failed to read JSON file %s.", filename);
+        res = VK_ERROR_INITIALIZATION_FAILED;
+        goto out;
+    }
+    buffer = loader_instance_heap_alloc(inst, (size_t)len + 1, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (NULL == buffer) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "loader_json_open: Failed to allocate space for "
+                   "JSON file %s buffer of length %ld",
+                   filename, len);
+        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        goto out;
+    }
+    if (fread(buffer, sizeof(char), (size_t)len, fp) != (size_t)len) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_json_open: Failed to read JSON file %s.", filename);
+        loader_instance_heap_free(inst, buffer);
+        res = VK_ERROR_INITIALIZATION_FAILED;
+        goto out;
+    }
+    file->data = buffer;
+    file->size = (size_t)len;
+
+out:
+    fclose(fp);
+    return res;
+}
+
+VkResult loader_json_open(const struct loader_instance *inst, const char *filename, struct loader_json_file *file) {
+    memset(file, 0, sizeof(*file));
+
+    VkResult res = json_load_file(inst, filename, file);
+    if (VK_SUCCESS != res) {
+        return res;
+    }
+
+    // Check the whole top level value up front.  Anything after it is ignored, as cJSON did.
+    const char *end = file->data + file->size;
+    file->root.start = json_skip_whitespace(file->data, end);
+    file->root.end = json_parse_value(file->root.start, end, 0);
+    if (NULL == file->root.end) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "loader_json_open: Failed to parse JSON file %s", filename);
+        loader_json_close(inst, file);
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    return VK_SUCCESS;
+}
+
+void loader_json_close(const struct loader_instance *inst, struct loader_json_file *file) {
+    if (NULL != file->data) {
+        if (file->mapped) {
+#if defined(_WIN32)
+            UnmapViewOfFile(file->data);
+#else
+            munmap((void *)file->data, file->size);
+#endif
+        } else {
+            loader_instance_heap_free(inst, (void *)file->data);
+        }
+    }
+    memset(file, 0, sizeof(*file));
+}
+
+bool loader_json_iterate(const struct loader_json_value *container, struct loader_json_iterator *iter) {
+    if (NULL == container->start || container->start == container->end ||
+        (*container->start != '{' && *container->start != '[')) {
+        return false;
+    }
+    iter->pos = container->start + 1;
+    iter->end = container->end;
+    iter->is_object = (*container->start == '{');
+    return true;
+}
+
+bool loader_json_next(struct loader_json_iterator *iter, struct loader_json_value *key, struct loader_json_value *item) {
+    const char *pos = json_skip_whitespace(iter->pos, iter->end);
+    if (pos == iter->end || *pos == '}' || *pos == ']') {
+        iter->pos = iter->end;
+        return false;
+    }
+    if (iter->is_object) {
+        const char *key_end = json_parse_string(pos, iter->end);
+        if (NULL != key) {
+            key->start = pos;
+            key->end = key_end;
+        }
+        pos = json_skip_whitespace(key_end, iter->end);
+        pos = json_skip_whitespace(pos + 1, iter->end);
+    }
+    item->start = pos;
+    item->end = json_parse_value(pos, iter->end, 0);
+    pos = json_skip_whitespace(item->end, iter->end);
+    iter->pos = (pos < iter->end && *pos == ',') ? pos + 1 : pos;
+    return true;
+}
+
+bool loader_json_string_equals(const struct loader_json_value *value, const char *name) {
+    const char *pos = value->start;
+    const char *end = value->end;
+    if (end - pos >= 2 && *pos == '"') {
+        pos++;
+        end--;
+    }
+    for (; pos < end && *name != '\0'; pos++, name++) {
+        if (json_to_lower(*pos) != json_to_lower(*name)) {
+            return false;
+        }
+    }
+    return pos == end && *name == '\0';
+}
+
+bool loader_json_get_object_item(const struct loader_json_value *object, const char *name, struct loader_json_value *item) {
+    struct loader_json_iterator iter;
+    struct loader_json_value key;
+    if (!loader_json_iterate(object, &iter) || !iter.is_object) {
+        return false;
+    }
+    while (loader_json_next(&iter, &key, item)) {
+        if (loader_json_string_equals(&key, name)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t loader_json_get_array_size(const struct loader_json_value *array) {
+    struct loader_json_iterator iter;
+    struct loader_json_value item;
+    uint32_t count = 0;
+    if (loader_json_iterate(array, &iter)) {
+        while (loader_json_next(&iter, NULL, &item)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+bool loader_json_get_array_item(const struct loader_json_value *array, uint32_t index, struct loader_json_value *item) {
+    struct loader_json_iterator iter;
+    if (!loader_json_iterate(array, &iter)) {
+        return false;
+    }
+    for (uint32_t i = 0; loader_json_next(&iter, NULL, item); i++) {
+        if (i == index) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void json_put_char(char *buffer, size_t buffer_size, size_t *length, char c) {
+    if (*length + 1 < buffer_size) {
+        buffer[*length] = c;
+    }
+    (*length)++;
+}
+
+// Decode a \u escape, pairing up UTF-16 surrogates, and write it as UTF-8.  pos points at the 'u' and the return value at
+// the last character consumed.  json_parse_unicode() has already checked the escape.
+static const char *json_put_unicode(const char *pos, char *buffer, size_t buffer_size, size_t *length) {
+    uint32_t code = json_read_hex4(pos + 1);
+    pos += 4;
+    if (code >= 0xD800 && code <= 0xDBFF) {
+        uint32_t low = json_read_hex4(pos + 3);
+        code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+        pos += 6;
+    }
+    if (code < 0x80) {
+        json_put_char(buffer, buffer_size, length, (char)code);
+    } else if (code < 0x800) {
+        json_put_char(buffer, buffer_size, length, (char)(0xC0 | (code >> 6)));
+        json_put_char(buffer, buffer_size, length, (char)(0x80 | (code & 0x3F)));
+    } else if (code < 0x10000) {
+        json_put_char(buffer, buffer_size, length, (char)(0xE0 | (code >> 12)));
+        json_put_char(buffer, buffer_size, length, (char)(0x80 | ((code >> 6) & 0x3F)));
+        json_put_char(buffer, buffer_size, length, (char)(0x80 | (code & 0x3F)));
+    } else {
+        json_put_char(buffer, buffer_size, length, (char)(0xF0 | (code >> 18)));
+        json_put_char(buffer, buffer_size, length, (char)(0x80 | ((code >> 12) & 0x3F)));
+        json_put_char(buffer, buffer_size, length, (char)(0x80 | ((code >> 6) & 0x3F)));
+        json_put_char(buffer, buffer_size, length, (char)(0x80 | (code & 0x3F)));
+    }
+    return pos;
+}
+
+size_t loader_json_get_string(const struct loader_json_value *value, char *buffer, size_t buffer_size) {
+    const char *pos = value->start;
+    const char *end = value->end;
+    size_t length = 0;
+
+    if (end - pos >= 2 && *pos == '"') {
+        for (pos++, end--; pos < end; pos++) {
+            if (*pos != '\\') {
+                json_put_char(buffer, buffer_size, &length, *pos);
+                continue;
+            }
+            switch (*++pos) {
+                case 'b':
+                    json_put_char(buffer, buffer_size, &length, '\b');
+                    break;
+                case 'f':
+                    json_put_char(buffer, buffer_size, &length, '\f');
+                    break;
+                case 'n':
+                    json_put_char(buffer, buffer_size, &length, '\n');
+                    break;
+                case 'r':
+                    json_put_char(buffer, buffer_size, &length, '\r');
+                    break;
+                case 't':
+                    json_put_char(buffer, buffer_size, &length, '\t');
+                    break;
+                case 'u':
+                    pos = json_put_unicode(pos, buffer, buffer_size, &length);
+                    break;
+                default:
+                    json_put_char(buffer, buffer_size, &length, *pos);
+                    break;
+            }
+        }
+    } else {
+        for (; pos < end; pos++) {
+            json_put_char(buffer, buffer_size, &length, *pos);
+        }
+    }
+
+    if (buffer_size > 0) {
+        buffer[(length < buffer_size) ? length : buffer_size - 1] = '\0';
+    }
+    return length;
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef MANIFEST_JSON_H
+#define MANIFEST_JSON_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vulkan/vulkan.h"
+
+// Reader for ICD and layer manifest files.
+//
+// The loader only needs a handful of fields from each manifest, so rather than building a tree of the whole document,
+// the file is mapped into memory, checked once for well-formed JSON, and each lookup then scans the text for just the
+// value asked for.  Values refer straight into the file's text and stay valid until the file is closed.  Reading a
+// manifest doesn't allocate unless the file can't be mapped, in which case it is read into a buffer from the instance
+// allocator.
+
+struct loader_instance;
+
+// A JSON value: the text from its first character up to, but not including, end
+struct loader_json_value {
+    const char *start;
+    const char *end;
+};
+
+// Walks the members of an object or the elements of an array
+struct loader_json_iterator {
+    const char *pos;
+    const char *end;
+    bool is_object;
+};
+
+struct loader_json_file {
+    // The top level value of the file
+    struct loader_json_value root;
+    const char *data;
+    size_t size;
+    bool mapped;
+};
+
+VkResult loader_json_open(const struct loader_instance *inst, const char *filename, struct loader_json_file *file);
+void loader_json_close(const struct loader_instance *inst, struct loader_json_file *file);
+
+// Start walking an object or array.  Returns false if the value is neither.
+bool loader_json_iterate(const struct loader_json_value *container, struct loader_json_iterator *iter);
+
+// Get the next member or element.  key is set for object members and may be NULL.
+bool loader_json_next(struct loader_json_iterator *iter, struct loader_json_value *key, struct loader_json_value *item);
+
+// Find an object's member by name, ignoring case like the cJSON based parsing this replaced
+bool loader_json_get_object_item(const struct loader_json_value *object, const char *name, struct loader_json_value *item);
+
+uint32_t loader_json_get_array_size(const struct loader_json_value *array);
+bool loader_json_get_array_item(const struct loader_json_value *array, uint32_t index, struct loader_json_value *item);
+
+// Check whether a key or string value matches name, ignoring case
+bool loader_json_string_equals(const struct loader_json_value *value, const char *name);
+
+// Copy a value into buffer as a null terminated string, truncating it to fit.  Strings are unquoted and unescaped, and
+// any other value is copied as written in the file.  Returns the length of the whole string, so calling with a
+// buffer_size of 0 gives the size needed, less the terminator.
+size_t loader_json_get_string(const struct loader_json_value *value, char *buffer, size_t buffer_size);
+
+#endif  // MANIFEST_JSON_H
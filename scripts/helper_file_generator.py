@@ -85,6 +85,7 @@ class HelperFileOutputGenerator(OutputGenerator):
         self.structMembers = []                           # List of StructMemberData records for all Vulkan structs
         self.object_types = []                            # List of all handle types
         self.debug_report_object_types = []               # Handy copy of debug_report_object_type enum data
+        self.command_names = []                           # List of all Vulkan command names
 
         # Named tuples to store struct and command data
         self.StructType = namedtuple('StructType', ['name', 'value'])
@@ -160,6 +161,12 @@ class HelperFileOutputGenerator(OutputGenerator):
                     item_name = elem.get('name')
                     self.debug_report_object_types.append(item_name)
     #
+    # Record each command name for the command name hash header
+    def genCmd(self, cmdinfo, name):
+        OutputGenerator.genCmd(self, cmdinfo, name)
+        if self.helper_file_type == 'command_name_hash_header':
+            self.command_names.append(name)
+    #
     # Called for each type -- if the type is a struct/union, grab the metadata
     def genType(self, typeinfo, name):
         OutputGenerator.genType(self, typeinfo, name)
@@ -757,6 +764,113 @@ class HelperFileOutputGenerator(OutputGenerator):
                 safe_struct_body.append("#endif // %s\n" % item.ifdef_protect)
         return "\n".join(safe_struct_body)
     #
+    # Command name hash helpers. These must match vk_command_name_hash() and vk_command_hash_mix() in the generated header.
+    def CommandNameHash(self, name):
+        hash = 2166136261
+        for c in name:
+            hash = ((hash ^ ord(c)) * 16777619) & 0xffffffff
+        return hash
+    def CommandHashMix(self, hash, seed):
+        hash = (hash ^ ((seed * 0x9e3779b9) & 0xffffffff)) & 0xffffffff
+        hash ^= hash >> 16
+        hash = (hash * 0x85ebca6b) & 0xffffffff
+        hash ^= hash >> 13
+        hash = (hash * 0xc2b2ae35) & 0xffffffff
+        hash ^= hash >> 16
+        return hash
+    #
+    # Build a hash-and-displace perfect hash over the command names: names are split into buckets by a first hash, and
+    # each bucket gets a seed that places all of its names into free slots of the slot table with a second hash.
+    def BuildCommandNamePerfectHash(self, names):
+        slot_count = 1
+        while slot_count < (len(names) * 3) // 2:
+            slot_count *= 2
+        bucket_count = max(1, slot_count // 4)
+        hashes = [self.CommandNameHash(name) for name in names]
+        if len(set(hashes)) != len(hashes):
+            raise Exception('Command name hash collision; change vk_command_name_hash()')
+        buckets = [[] for i in range(bucket_count)]
+        for index, hash in enumerate(hashes):
+            buckets[self.CommandHashMix(hash, 0) & (bucket_count - 1)].append(index)
+        seeds = [0] * bucket_count
+        slots = [None] * slot_count
+        for bucket_index in sorted(range(bucket_count), key=lambda b: (-len(buckets[b]), b)):
+            bucket = buckets[bucket_index]
+            if not bucket:
+                continue
+            for seed in range(1, 0x10000):
+                placed = [self.CommandHashMix(hashes[index], seed) & (slot_count - 1) for index in bucket]
+                if len(set(placed)) == len(placed) and all(slots[slot] is None for slot in placed):
+                    break
+            else:
+                raise Exception('Unable to build command name perfect hash')
+            seeds[bucket_index] = seed
+            for index, slot in zip(bucket, placed):
+                slots[slot] = index
+        return seeds, slots
+    #
+    # Command name hash header: map Vulkan command name strings onto a dense enum with a single perfect-hash probe
+    def GenerateCommandNameHashHelperHeader(self):
+        # vk_layerGetPhysicalDeviceProcAddr is part of the loader/layer interface rather than vk.xml
+        names = self.command_names + ['vk_layerGetPhysicalDeviceProcAddr']
+        seeds, slots = self.BuildCommandNamePerfectHash(names)
+        enum_names = ['kVulkanCommand%s' % name[2:] for name in names]
+        header = '\n'
+        header += '#pragma once\n'
+        header += '\n'
+        header += '#include <stdint.h>\n'
+        header += '#include <string.h>\n\n'
+        header += '// Dense index of every Vulkan command name, used to replace strcmp chains in GetProcAddr implementations\n'
+        header += 'typedef enum VulkanCommand {\n'
+        for index, enum_name in enumerate(enum_names):
+            header += '    %s = %d,\n' % (enum_name, index)
+        header += '    kVulkanCommandCount = %d,\n' % len(names)
+        header += '    kVulkanCommandUnknown = %d,\n' % len(names)
+        header += '} VulkanCommand;\n\n'
+        header += '// Array of command name strings, indexed by VulkanCommand\n'
+        header += 'static const char *const vulkan_command_names[kVulkanCommandCount] = {\n'
+        for name in names:
+            header += '    "%s",\n' % name
+        header += '};\n\n'
+        header += '// Per-bucket seeds for the second-level hash\n'
+        header += 'static const uint16_t vulkan_command_hash_seeds[%d] = {' % len(seeds)
+        for index, seed in enumerate(seeds):
+            header += '%s%d,' % ('\n    ' if index % 16 == 0 else ' ', seed)
+        header += '\n};\n\n'
+        header += '// Slot table holding the VulkanCommand that hashes to each slot, or kVulkanCommandUnknown\n'
+        header += 'static const uint16_t vulkan_command_hash_slots[%d] = {' % len(slots)
+        for index, slot in enumerate(slots):
+            header += '%s%d,' % ('\n    ' if index % 16 == 0 else ' ', len(names) if slot is None else slot)
+        header += '\n};\n\n'
+        header += '// 32-bit FNV-1a hash of a command name\n'
+        header += 'static inline uint32_t vk_command_name_hash(const char *name) {\n'
+        header += '    uint32_t hash = 2166136261u;\n'
+        header += '    for (; *name; ++name) {\n'
+        header += '        hash = (hash ^ (uint8_t)*name) * 16777619u;\n'
+        header += '    }\n'
+        header += '    return hash;\n'
+        header += '}\n\n'
+        header += '// Derive an independent hash from a name hash and a seed\n'
+        header += 'static inline uint32_t vk_command_hash_mix(uint32_t hash, uint32_t seed) {\n'
+        header += '    hash ^= seed * 0x9e3779b9u;\n'
+        header += '    hash ^= hash >> 16;\n'
+        header += '    hash *= 0x85ebca6bu;\n'
+        header += '    hash ^= hash >> 13;\n'
+        header += '    hash *= 0xc2b2ae35u;\n'
+        header += '    hash ^= hash >> 16;\n'
+        header += '    return hash;\n'
+        header += '}\n\n'
+        header += '// Look up a command name, returning kVulkanCommandUnknown for names that are not Vulkan commands\n'
+        header += 'static inline VulkanCommand LookupVulkanCommand(const char *name) {\n'
+        header += '    if (!name) return kVulkanCommandUnknown;\n'
+        header += '    const uint32_t hash = vk_command_name_hash(name);\n'
+        header += '    const uint32_t seed = vulkan_command_hash_seeds[vk_command_hash_mix(hash, 0) & %du];\n' % (len(seeds) - 1)
+        header += '    const uint32_t command = vulkan_command_hash_slots[vk_command_hash_mix(hash, seed) & %du];\n' % (len(slots) - 1)
+        header += '    if (command == kVulkanCommandUnknown || strcmp(vulkan_command_names[command], name)) return kVulkanCommandUnknown;\n'
+        header += '    return (VulkanCommand)command;\n'
+        header += '}\n'
+        return header
+    #
     # Create a helper file and return it as a string
     def OutputDestFile(self):
         if self.helper_file_type == 'enum_string_header':
@@ -771,6 +885,8 @@ class HelperFileOutputGenerator(OutputGenerator):
             return self.GenerateSafeStructHelperSource()
         elif self.helper_file_type == 'object_types_header':
             return self.GenerateObjectTypesHelperHeader()
+        elif self.helper_file_type == 'command_name_hash_header':
+            return self.GenerateCommandNameHashHelperHeader()
         else:
             return 'Bad Helper File Generator Option %s' % self.helper_file_type
 
@@ -155,6 +155,7 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
             preamble += '#include "vk_loader_platform.h"\n'
             preamble += '#include "loader.h"\n'
             preamble += '#include "vk_loader_extensions.h"\n'
+            preamble += '#include "vk_command_name_hash.h"\n'
             preamble += '#include <vulkan/vk_icd.h>\n'
             preamble += '#include "wsi.h"\n'
             preamble += '#include "debug_report.h"\n'
@@ -686,7 +687,7 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                 tables += 'VKAPI_ATTR void VKAPI_CALL loader_init_device_dispatch_table(struct loader_dev_dispatch_table *dev_table, PFN_vkGetDeviceProcAddr gpa,\n'
                 tables += '                                                             VkDevice dev) {\n'
                 tables += '    VkLayerDispatchTable *table = &dev_table->core_dispatch;\n'
-                tables += '    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) dev_table->ext_dispatch.dev_ext[i] = (PFN_vkDevExt)vkDevExtError;\n'
+                tables += '    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXT_TRAMPOLINES; i++) dev_table->ext_dispatch.dev_ext[i] = (PFN_vkDevExt)vkDevExtError;\n'
 
             elif x == 1:
                 cur_type = 'device'
@@ -768,22 +769,15 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
 
                 tables += '// Device command lookup function\n'
                 tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_device_dispatch_table(const VkLayerDispatchTable *table, const char *name) {\n'
-                tables += '    if (!name || name[0] != \'v\' || name[1] != \'k\') return NULL;\n'
-                tables += '\n'
-                tables += '    name += 2;\n'
+                tables += '    switch (LookupVulkanCommand(name)) {\n'
             else:
                 cur_type = 'instance'
 
                 tables += '// Instance command lookup function\n'
                 tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_instance_dispatch_table(const VkLayerInstanceDispatchTable *table, const char *name,\n'
                 tables += '                                                                 bool *found_name) {\n'
-                tables += '    if (!name || name[0] != \'v\' || name[1] != \'k\') {\n'
-                tables += '        *found_name = false;\n'
-                tables += '        return NULL;\n'
-                tables += '    }\n'
-                tables += '\n'
                 tables += '    *found_name = true;\n'
-                tables += '    name += 2;\n'
+                tables += '    switch (LookupVulkanCommand(name)) {\n'
 
             for y in range(0, 2):
                 if y == 0:
@@ -797,9 +791,9 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
 
                         if cur_cmd.ext_name != cur_extension_name:
                             if 'VK_VERSION_' in cur_cmd.ext_name:
-                                tables += '\n    // ---- Core %s commands\n' % cur_cmd.ext_name[11:]
+                                tables += '\n        // ---- Core %s commands\n' % cur_cmd.ext_name[11:]
                             else:
-                                tables += '\n    // ---- %s extension commands\n' % cur_cmd.ext_name
+                                tables += '\n        // ---- %s extension commands\n' % cur_cmd.ext_name
                             cur_extension_name = cur_cmd.ext_name
 
                         # Remove 'vk' from proto name
@@ -813,11 +807,15 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                         if cur_cmd.protect is not None:
                             tables += '#ifdef %s\n' % cur_cmd.protect
 
-                        tables += '    if (!strcmp(name, "%s")) return (void *)table->%s;\n' % (base_name, base_name)
+                        tables += '        case kVulkanCommand%s: return (void *)table->%s;\n' % (base_name, base_name)
 
                         if cur_cmd.protect is not None:
                             tables += '#endif // %s\n' % cur_cmd.protect
 
+            tables += '\n'
+            tables += '        default:\n'
+            tables += '            break;\n'
+            tables += '    }\n'
             tables += '\n'
             if x == 1:
                 tables += '    *found_name = false;\n'
@@ -146,6 +146,8 @@ class ParamCheckerOutputGenerator(OutputGenerator):
         self.sections = dict([(section, []) for section in self.ALL_SECTIONS])
         self.structNames = []                             # List of Vulkan struct typenames
         self.stypes = []                                  # Values from the VkStructureType enumeration
+        self.stypeIndices = dict()                        # Map of every VkStructureType value to its dense allowlist index
+        self.stypeIndexTable = None                       # GetStructureTypeIndex definition, written by the feature defining VkStructureType
         self.structTypes = dict()                         # Map of Vulkan struct typename to required VkStructureType
         self.handleTypes = set()                          # Set of handle type names
         self.commands = []                                # List of CommandData records for all Vulkan commands
@@ -259,6 +261,10 @@ class ParamCheckerOutputGenerator(OutputGenerator):
             if self.headerVersion:
                 write('const uint32_t GeneratedHeaderVersion = {};'.format(self.headerVersion), file=self.outFile)
                 self.newline()
+            # Write the VkStructureType index function used by the pNext allowlists
+            if self.stypeIndexTable:
+                write(self.stypeIndexTable, file=self.outFile)
+                self.stypeIndexTable = None
             # Write the declarations for the VkFlags values combining all flag bits
             for flag in sorted(self.newFlags):
                 flagBits = flag.replace('Flags', 'FlagBits')
@@ -392,6 +398,7 @@ class ParamCheckerOutputGenerator(OutputGenerator):
         if groupName == 'VkStructureType':
             for elem in groupElem.findall('enum'):
                 self.stypes.append(elem.get('name'))
+            self.genStructureTypeIndex()
         elif 'FlagBits' in groupName:
             bits = []
             for elem in groupElem.findall('enum'):
@@ -720,21 +727,50 @@ class ParamCheckerOutputGenerator(OutputGenerator):
             checkExpr.append('skipCall |= validate_flags_array(report_data, "{}", {ppp}"{}"{pps}, {ppp}"{}"{pps}, "{}", {}, {pf}{}, {pf}{}, {}, {});\n'.format(funcPrintName, lenPrintName, valuePrintName, flagBitsName, allFlags, lenValue.name, value.name, lenValueRequired, valueRequired, pf=prefix, **postProcSpec))
         return checkExpr
     #
+    # Generate GetStructureTypeIndex, mapping each VkStructureType value to a dense index for the pNext allowlist bitmasks
+    def genStructureTypeIndex(self):
+        lines = ['// Dense index for each VkStructureType value, used to key the pNext allowlist bitmasks',
+                 'static inline uint32_t GetStructureTypeIndex(VkStructureType sType) {',
+                 '    switch (sType) {']
+        for stype in self.stypes:
+            if stype not in self.stypeIndices:
+                self.stypeIndices[stype] = len(self.stypeIndices)
+                lines.append('        case {}: return {};'.format(stype, self.stypeIndices[stype]))
+        lines += ['        default: return UnknownStructureTypeIndex;',
+                  '    }',
+                  '}',
+                  '']
+        self.stypeIndexTable = '\n'.join(lines)
+    #
+    # Get the VkStructureType value of a pNext extension struct from its registry definition.  The struct may belong
+    # to a feature that has not been processed yet, so self.structTypes can't be used.
+    def getExtStructType(self, typename):
+        typeinfo = self.registry.typedict.get(typename)
+        if typeinfo is not None:
+            result = re.search(r'VK_STRUCTURE_TYPE_\w+', etree.tostring(typeinfo.elem).decode('ascii'))
+            if result:
+                return result.group(0)
+        return self.getStructType(typename)
+    #
     # Generate pNext check string
     def makeStructNextCheck(self, prefix, value, funcPrintName, valuePrintName, postProcSpec):
         checkExpr = []
-        # Generate an array of acceptable VkStructureType values for pNext
-        extStructCount = 0
+        # Generate a bitmask of acceptable VkStructureType values for pNext, indexed by GetStructureTypeIndex
         extStructVar = 'NULL'
         extStructNames = 'NULL'
         if value.extstructs:
             structs = value.extstructs.split(',')
-            checkExpr.append('const VkStructureType allowedStructs[] = {' + ', '.join([self.getStructType(s) for s in structs]) + '};\n')
-            extStructCount = 'ARRAY_SIZE(allowedStructs)'
+            words = [0] * ((len(self.stypeIndices) + 63) // 64)
+            for struct in structs:
+                stype = self.getExtStructType(struct)
+                if stype in self.stypeIndices:
+                    index = self.stypeIndices[stype]
+                    words[index // 64] |= 1 << (index % 64)
+            checkExpr.append('static const uint64_t allowedStructs[] = {' + ', '.join(['0x{:016x}ull'.format(w) for w in words]) + '};\n')
             extStructVar = 'allowedStructs'
             extStructNames = '"' + ', '.join(structs) + '"'
-        checkExpr.append('skipCall |= validate_struct_pnext(report_data, "{}", {ppp}"{}"{pps}, {}, {}{}, {}, {}, GeneratedHeaderVersion);\n'.format(
-            funcPrintName, valuePrintName, extStructNames, prefix, value.name, extStructCount, extStructVar, **postProcSpec))
+        checkExpr.append('skipCall |= validate_struct_pnext(report_data, "{}", {ppp}"{}"{pps}, {}, {}{}, {}, GeneratedHeaderVersion);\n'.format(
+            funcPrintName, valuePrintName, extStructNames, prefix, value.name, extStructVar, **postProcSpec))
         return checkExpr
     #
     # Generate the pointer check string
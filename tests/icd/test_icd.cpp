@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Minimal stand-in ICD for loader tests.  It exposes one physical device with one graphics
+// queue family and no extensions, and answers GetProcAddr queries for any number of synthetic
+// extension commands:
+//
+//   vkSyntheticDeviceExt<N>(VkDevice, uint32_t *)                 through vk_icdGetInstanceProcAddr
+//                                                                  and vkGetDeviceProcAddr
+//   vkSyntheticPhysicalDeviceExt<N>(VkPhysicalDevice, uint32_t *)  through vk_icdGetPhysicalDeviceProcAddr
+//
+// Each writes N % kSyntheticFunctionCount to its second parameter so callers can tell which
+// implementation a loader trampoline dispatched to.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <vulkan/vulkan.h>
+#include <vulkan/vk_icd.h>
+
+// Windows exports come from VkICD_test.def
+#if defined(__GNUC__) && __GNUC__ >= 4
+#define TEST_ICD_EXPORT __attribute__((visibility("default")))
+#else
+#define TEST_ICD_EXPORT
+#endif
+
+namespace test_icd {
+
+struct PhysicalDevice {
+    VK_LOADER_DATA loader_data;
+};
+
+struct Instance {
+    VK_LOADER_DATA loader_data;
+    PhysicalDevice physical_device;
+};
+
+struct Device {
+    VK_LOADER_DATA loader_data;
+};
+
+static const char kSyntheticDevicePrefix[] = "vkSyntheticDeviceExt";
+static const char kSyntheticPhysicalDevicePrefix[] = "vkSyntheticPhysicalDeviceExt";
+static const uint32_t kSyntheticFunctionCount = 8;
+
+template <uint32_t N>
+static VKAPI_ATTR void VKAPI_CALL SyntheticExt(void *, uint32_t *pResult) {
+    *pResult = N;
+}
+
+typedef void(VKAPI_PTR *PFN_SyntheticExt)(void *, uint32_t *);
+static const PFN_SyntheticExt synthetic_functions[kSyntheticFunctionCount] = {
+    SyntheticExt<0>, SyntheticExt<1>, SyntheticExt<2>, SyntheticExt<3>,
+    SyntheticExt<4>, SyntheticExt<5>, SyntheticExt<6>, SyntheticExt<7>,
+};
+
+// Returns the implementation of "<prefix><N>", or NULL if pName is not of that form.
+static PFN_vkVoidFunction GetSyntheticFunction(const char *pName, const char *prefix, size_t prefix_length) {
+    if (strncmp(pName, prefix, prefix_length) != 0) return nullptr;
+    const char *digits = pName + prefix_length;
+    if (*digits < '0' || *digits > '9') return nullptr;
+    char *end = nullptr;
+    const unsigned long n = strtoul(digits, &end, 10);
+    if (*end != '\0') return nullptr;
+    return reinterpret_cast<PFN_vkVoidFunction>(synthetic_functions[n % kSyntheticFunctionCount]);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreateInfo,
+                                                     const VkAllocationCallbacks *pAllocator, VkInstance *pInstance) {
+    Instance *instance = new Instance();
+    set_loader_magic_value(instance);
+    set_loader_magic_value(&instance->physical_device);
+    *pInstance = reinterpret_cast<VkInstance>(instance);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocationCallbacks *pAllocator) {
+    delete reinterpret_cast<Instance *>(instance);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumerateInstanceExtensionProperties(const char *pLayerName, uint32_t *pPropertyCount,
+                                                                           VkExtensionProperties *pProperties) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDevices(VkInstance instance, uint32_t *pPhysicalDeviceCount,
+                                                               VkPhysicalDevice *pPhysicalDevices) {
+    if (pPhysicalDevices == nullptr) {
+        *pPhysicalDeviceCount = 1;
+        return VK_SUCCESS;
+    }
+    if (*pPhysicalDeviceCount < 1) return VK_INCOMPLETE;
+    *pPhysicalDeviceCount = 1;
+    pPhysicalDevices[0] = reinterpret_cast<VkPhysicalDevice>(&reinterpret_cast<Instance *>(instance)->physical_device);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice,
+                                                              VkPhysicalDeviceProperties *pProperties) {
+    memset(pProperties, 0, sizeof(*pProperties));
+    pProperties->apiVersion = VK_API_VERSION_1_0;
+    pProperties->deviceType = VK_PHYSICAL_DEVICE_TYPE_CPU;
+    strncpy(pProperties->deviceName, "Loader test ICD", VK_MAX_PHYSICAL_DEVICE_NAME_SIZE);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures *pFeatures) {
+    memset(pFeatures, 0, sizeof(*pFeatures));
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format,
+                                                                    VkFormatProperties *pFormatProperties) {
+    memset(pFormatProperties, 0, sizeof(*pFormatProperties));
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format,
+                                                                             VkImageType type, VkImageTiling tiling,
+                                                                             VkImageUsageFlags usage, VkImageCreateFlags flags,
+                                                                             VkImageFormatProperties *pImageFormatProperties) {
+    return VK_ERROR_FORMAT_NOT_SUPPORTED;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties(VkPhysicalDevice physicalDevice,
+                                                                    VkPhysicalDeviceMemoryProperties *pMemoryProperties) {
+    memset(pMemoryProperties, 0, sizeof(*pMemoryProperties));
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format,
+                                                                              VkImageType type, VkSampleCountFlagBits samples,
+                                                                              VkImageUsageFlags usage, VkImageTiling tiling,
+                                                                              uint32_t *pPropertyCount,
+                                                                              VkSparseImageFormatProperties *pProperties) {
+    *pPropertyCount = 0;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice,
+                                                                         uint32_t *pQueueFamilyPropertyCount,
+                                                                         VkQueueFamilyProperties *pQueueFamilyProperties) {
+    if (pQueueFamilyProperties == nullptr) {
+        *pQueueFamilyPropertyCount = 1;
+        return;
+    }
+    if (*pQueueFamilyPropertyCount < 1) return;
+    *pQueueFamilyPropertyCount = 1;
+    memset(pQueueFamilyProperties, 0, sizeof(*pQueueFamilyProperties));
+    pQueueFamilyProperties->queueFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+    pQueueFamilyProperties->queueCount = 1;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char *pLayerName,
+                                                                         uint32_t *pPropertyCount,
+                                                                         VkExtensionProperties *pProperties) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo *pCreateInfo,
+                                                   const VkAllocationCallbacks *pAllocator, VkDevice *pDevice) {
+    Device *device = new Device();
+    set_loader_magic_value(device);
+    *pDevice = reinterpret_cast<VkDevice>(device);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    delete reinterpret_cast<Device *>(device);
+}
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char *pName) {
+    if (!strcmp(pName, "vkGetDeviceProcAddr")) return reinterpret_cast<PFN_vkVoidFunction>(GetDeviceProcAddr);
+    if (!strcmp(pName, "vkDestroyDevice")) return reinterpret_cast<PFN_vkVoidFunction>(DestroyDevice);
+    return GetSyntheticFunction(pName, kSyntheticDevicePrefix, sizeof(kSyntheticDevicePrefix) - 1);
+}
+
+static const struct {
+    const char *name;
+    PFN_vkVoidFunction function;
+} instance_functions[] = {
+    {"vkCreateInstance", reinterpret_cast<PFN_vkVoidFunction>(CreateInstance)},
+    {"vkDestroyInstance", reinterpret_cast<PFN_vkVoidFunction>(DestroyInstance)},
+    {"vkEnumerateInstanceExtensionProperties", reinterpret_cast<PFN_vkVoidFunction>(EnumerateInstanceExtensionProperties)},
+    {"vkEnumeratePhysicalDevices", reinterpret_cast<PFN_vkVoidFunction>(EnumeratePhysicalDevices)},
+    {"vkGetPhysicalDeviceFeatures", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceFeatures)},
+    {"vkGetPhysicalDeviceFormatProperties", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceFormatProperties)},
+    {"vkGetPhysicalDeviceImageFormatProperties", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceImageFormatProperties)},
+    {"vkGetPhysicalDeviceProperties", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceProperties)},
+    {"vkGetPhysicalDeviceMemoryProperties", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceMemoryProperties)},
+    {"vkGetPhysicalDeviceSparseImageFormatProperties",
+     reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceSparseImageFormatProperties)},
+    {"vkGetPhysicalDeviceQueueFamilyProperties", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceQueueFamilyProperties)},
+    {"vkEnumerateDeviceExtensionProperties", reinterpret_cast<PFN_vkVoidFunction>(EnumerateDeviceExtensionProperties)},
+    {"vkCreateDevice", reinterpret_cast<PFN_vkVoidFunction>(CreateDevice)},
+    {"vkDestroyDevice", reinterpret_cast<PFN_vkVoidFunction>(DestroyDevice)},
+    {"vkGetDeviceProcAddr", reinterpret_cast<PFN_vkVoidFunction>(GetDeviceProcAddr)},
+};
+
+}  // namespace test_icd
+
+extern "C" {
+
+TEST_ICD_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vk_icdNegotiateLoaderICDInterfaceVersion(uint32_t *pSupportedVersion) {
+    if (*pSupportedVersion > CURRENT_LOADER_ICD_INTERFACE_VERSION) *pSupportedVersion = CURRENT_LOADER_ICD_INTERFACE_VERSION;
+    return VK_SUCCESS;
+}
+
+TEST_ICD_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_icdGetInstanceProcAddr(VkInstance instance, const char *pName) {
+    for (const auto &entry : test_icd::instance_functions) {
+        if (!strcmp(pName, entry.name)) return entry.function;
+    }
+    return test_icd::GetSyntheticFunction(pName, test_icd::kSyntheticDevicePrefix, sizeof(test_icd::kSyntheticDevicePrefix) - 1);
+}
+
+TEST_ICD_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_icdGetPhysicalDeviceProcAddr(VkInstance instance, const char *pName) {
+    return test_icd::GetSyntheticFunction(pName, test_icd::kSyntheticPhysicalDevicePrefix,
+                                          sizeof(test_icd::kSyntheticPhysicalDevicePrefix) - 1);
+}
+
+}  // extern "C"
@@ -0,0 +1,1319 @@
+/*
+ * Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Throughput benchmarks for the validation layers.
+//
+// The benchmarks drive the Vulkan API directly and are meant to be run against the null ICD in tests/null_icd so that the
+// numbers reflect layer overhead rather than driver work. Point VK_ICD_FILENAMES at its VkICD_null.json and VK_LAYER_PATH
+// at the built layers:
+//
+//   ./vk_layer_benchmarks --layer VK_LAYER_LUNARG_core_validation --threads 16
+//
+// Benchmarks:
+//   record   Each thread records the same stream of state-setting, binding and transfer commands into its own command buffer
+//            (allocated from its own pool) while sharing buffers and descriptor sets with the other threads. Reports recorded
+//            commands per second for 1, 2, 4, ... threads.
+//   contention
+//            Like record, but only records dynamic state commands so that threads touch nothing but their own command buffer
+//            and pool. This isolates per-handle bookkeeping such as VK_LAYER_GOOGLE_threading's use tracking.
+//   descriptors
+//            Each thread alternates vkUpdateDescriptorSets on its own descriptor set with vkCmdBindDescriptorSets of it,
+//            which is dominated by handle unwrapping in VK_LAYER_GOOGLE_unique_objects. Reports calls per second.
+//   pipeline Creates a pipeline from each SPIR-V module in a corpus given with --spirv, which exercises the shader interface
+//            walks done by core_validation. GLCompute entry points get a compute pipeline, Vertex entry points a graphics
+//            pipeline with rasterization discarded; other modules are skipped. Modules whose resources don't match the
+//            benchmark's pipeline layout will report validation errors, so consider filtering those out via report_flags.
+//            Without --spirv, a built-in corpus of generated compute and vertex modules of a few sizes is used; real
+//            shaders give more representative numbers.
+//   reset    Records --buffers command buffers from one pool per frame, like an application re-recording everything each
+//            frame, and resets them between frames with vkResetCommandPool or with one vkResetCommandBuffer each. Exercises
+//            the per-command-buffer state that layers clear on reset and rebuild while recording. Reports command buffers
+//            and frames per second; keep --commands small (e.g. 8) so that the reset cost isn't drowned out by recording.
+//   bind     Binds --bindings small buffers side by side into a single allocation, as a sub-allocator would, then destroys
+//            them. Exercises the aliasing checks that core_validation runs against the ranges already bound to the memory
+//            object. Reports binds and destroys per second.
+//   gpa      Resolves every Vulkan command name through vkGetDeviceProcAddr, resolves names no layer knows (which walk the
+//            whole layer chain down to the driver), and creates and destroys devices, during which each layer fills its
+//            dispatch table through the next layer's vkGetDeviceProcAddr. Reports nanoseconds per call.
+//   devices  Creates --devices logical devices spread over --instances instances, then resolves an unknown command name on
+//            each (which the loader answers after finding the device's ICD from its dispatch pointer) and destroys them. Needs
+//            nothing but vkCreateDevice from the driver, so it runs against the loader test ICD in tests/icd. Reports
+//            nanoseconds per call.
+//   streams  Runs representative call streams through the enabled layers on 1, 2, 4, ... threads: draw records --commands
+//            vkCmdDraw calls per command buffer with a descriptor set rebind before each, update issues bursts of
+//            vkUpdateDescriptorSets, submit hands 64 prerecorded command buffers to each vkQueueSubmit and waits on its
+//            fence, and map cycles vkMapMemory, vkFlushMappedMemoryRanges and vkUnmapMemory. Reports thread time and heap
+//            allocations per call and throughput scaling, and with --json writes them to a file so that runs against
+//            different layer stacks or revisions can be compared.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+#include "vk_command_name_hash.h"
+
+// Allocations made by the calling thread through operator new. Replacing the global operator new in the executable replaces
+// it for the layers as well where the platform resolves symbols globally, as on Linux; the loader allocates with malloc and
+// isn't counted.
+static thread_local uint64_t thread_allocations = 0;
+
+void *operator new(size_t size) {
+    ++thread_allocations;
+    void *p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void *p) noexcept { free(p); }
+
+namespace {
+
+struct Options {
+    std::vector<const char *> layers;
+    uint32_t max_threads = 8;
+    uint32_t iterations = 200;
+    uint32_t commands_per_buffer = 256;
+    uint32_t command_buffers = 3000;
+    uint32_t bindings = 100000;
+    uint32_t devices = 256;
+    uint32_t instances = 4;
+    std::string benchmark = "record";
+    std::vector<const char *> spirv_files;
+    std::vector<std::string> streams;
+    const char *json_file = nullptr;
+};
+
+#define CHECK_VK(expr)                                                                            \
+    do {                                                                                          \
+        VkResult check_result = (expr);                                                           \
+        if (check_result != VK_SUCCESS) {                                                         \
+            fprintf(stderr, "%s:%d: %s failed (%d)\n", __FILE__, __LINE__, #expr, check_result); \
+            exit(1);                                                                              \
+        }                                                                                         \
+    } while (0)
+
+// Instance, device and the objects shared by every benchmark thread
+class BenchmarkDevice {
+   public:
+    explicit BenchmarkDevice(const Options &options) {
+        VkApplicationInfo app_info = {};
+        app_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+        app_info.pApplicationName = "vk_layer_benchmarks";
+        app_info.apiVersion = VK_API_VERSION_1_0;
+
+        VkInstanceCreateInfo instance_ci = {};
+        instance_ci.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+        instance_ci.pApplicationInfo = &app_info;
+        instance_ci.enabledLayerCount = static_cast<uint32_t>(options.layers.size());
+        instance_ci.ppEnabledLayerNames = options.layers.data();
+        CHECK_VK(vkCreateInstance(&instance_ci, nullptr, &instance));
+
+        uint32_t gpu_count = 1;
+        VkResult result = vkEnumeratePhysicalDevices(instance, &gpu_count, &gpu);
+        if (gpu_count == 0 || (result != VK_SUCCESS && result != VK_INCOMPLETE)) {
+            fprintf(stderr, "No physical devices found\n");
+            exit(1);
+        }
+
+        uint32_t family_count = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(gpu, &family_count, nullptr);
+        std::vector<VkQueueFamilyProperties> families(family_count);
+        vkGetPhysicalDeviceQueueFamilyProperties(gpu, &family_count, families.data());
+        queue_family = family_count;
+        for (uint32_t i = 0; i < family_count; ++i) {
+            if (families[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) {
+                queue_family = i;
+                break;
+            }
+        }
+        if (queue_family == family_count) {
+            fprintf(stderr, "No graphics queue family found\n");
+            exit(1);
+        }
+
+        // One queue per benchmark thread where the family has enough of them
+        uint32_t queue_count = std::min(std::max(options.max_threads, 1u), families[queue_family].queueCount);
+        std::vector<float> priorities(queue_count, 1.0f);
+        VkDeviceQueueCreateInfo queue_ci = {};
+        queue_ci.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queue_ci.queueFamilyIndex = queue_family;
+        queue_ci.queueCount = queue_count;
+        queue_ci.pQueuePriorities = priorities.data();
+
+        VkDeviceCreateInfo device_ci = {};
+        device_ci.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+        device_ci.queueCreateInfoCount = 1;
+        device_ci.pQueueCreateInfos = &queue_ci;
+        CHECK_VK(vkCreateDevice(gpu, &device_ci, nullptr, &device));
+
+        queues.resize(queue_count);
+        for (uint32_t i = 0; i < queue_count; ++i) {
+            vkGetDeviceQueue(device, queue_family, i, &queues[i]);
+            queue_mutexes.emplace_back(new std::mutex);
+        }
+
+        CreateBuffers();
+        CreateDescriptors();
+    }
+
+    ~BenchmarkDevice() {
+        vkDestroyPipelineLayout(device, pipeline_layout, nullptr);
+        vkDestroyDescriptorPool(device, descriptor_pool, nullptr);
+        vkDestroyDescriptorSetLayout(device, set_layout, nullptr);
+        for (auto buffer : buffers) vkDestroyBuffer(device, buffer, nullptr);
+        vkFreeMemory(device, memory, nullptr);
+        vkDestroyDevice(device, nullptr);
+        vkDestroyInstance(instance, nullptr);
+    }
+
+    static const VkDeviceSize kBufferSize = 64 * 1024;
+    static const uint32_t kBufferCount = 2;
+
+    VkInstance instance = VK_NULL_HANDLE;
+    VkPhysicalDevice gpu = VK_NULL_HANDLE;
+    VkDevice device = VK_NULL_HANDLE;
+    uint32_t queue_family = 0;
+    std::vector<VkQueue> queues;
+    std::vector<std::unique_ptr<std::mutex>> queue_mutexes;  // queues are externally synchronized
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkBuffer buffers[kBufferCount] = {};
+    VkDescriptorSetLayout set_layout = VK_NULL_HANDLE;
+    VkDescriptorPool descriptor_pool = VK_NULL_HANDLE;
+    VkDescriptorSet descriptor_set = VK_NULL_HANDLE;
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+
+    // Creates a pool holding a single set of set_layout and allocates that set, pointing it at buffers[0]
+    void CreateDescriptorSet(VkDescriptorPool *pool, VkDescriptorSet *set) const {
+        VkDescriptorPoolSize pool_size = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1};
+        VkDescriptorPoolCreateInfo pool_ci = {};
+        pool_ci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        pool_ci.maxSets = 1;
+        pool_ci.poolSizeCount = 1;
+        pool_ci.pPoolSizes = &pool_size;
+        CHECK_VK(vkCreateDescriptorPool(device, &pool_ci, nullptr, pool));
+
+        VkDescriptorSetAllocateInfo set_alloc_info = {};
+        set_alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        set_alloc_info.descriptorPool = *pool;
+        set_alloc_info.descriptorSetCount = 1;
+        set_alloc_info.pSetLayouts = &set_layout;
+        CHECK_VK(vkAllocateDescriptorSets(device, &set_alloc_info, set));
+
+        VkDescriptorBufferInfo buffer_info = {buffers[0], 0, 256};
+        VkWriteDescriptorSet write = {};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = *set;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        write.pBufferInfo = &buffer_info;
+        vkUpdateDescriptorSets(device, 1, &write, 0, nullptr);
+    }
+
+    // Returns the first memory type allowed by type_bits that has all of the required properties, exiting if there is none
+    uint32_t MemoryTypeIndex(uint32_t type_bits, VkMemoryPropertyFlags required = 0) const {
+        uint32_t type_index = FindMemoryType(type_bits, required, 0);
+        if (type_index == UINT32_MAX) {
+            fprintf(stderr, "No usable memory type for buffers\n");
+            exit(1);
+        }
+        return type_index;
+    }
+
+    // Returns the first memory type allowed by type_bits that has all of the required properties and none of the excluded
+    // ones, or UINT32_MAX
+    uint32_t FindMemoryType(uint32_t type_bits, VkMemoryPropertyFlags required, VkMemoryPropertyFlags excluded) const {
+        VkPhysicalDeviceMemoryProperties memory_props;
+        vkGetPhysicalDeviceMemoryProperties(gpu, &memory_props);
+        for (uint32_t i = 0; i < memory_props.memoryTypeCount; ++i) {
+            VkMemoryPropertyFlags flags = memory_props.memoryTypes[i].propertyFlags;
+            if ((type_bits & (1u << i)) && (flags & required) == required && !(flags & excluded)) return i;
+        }
+        return UINT32_MAX;
+    }
+
+   private:
+    void CreateBuffers() {
+        VkBufferCreateInfo buffer_ci = {};
+        buffer_ci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        buffer_ci.size = kBufferSize;
+        buffer_ci.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT |
+                          VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        buffer_ci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        for (auto &buffer : buffers) CHECK_VK(vkCreateBuffer(device, &buffer_ci, nullptr, &buffer));
+
+        VkMemoryRequirements reqs;
+        vkGetBufferMemoryRequirements(device, buffers[0], &reqs);
+        VkDeviceSize alignment = reqs.alignment ? reqs.alignment : 1;
+        VkDeviceSize stride = (reqs.size + alignment - 1) / alignment * alignment;
+
+        VkMemoryAllocateInfo alloc_info = {};
+        alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        alloc_info.allocationSize = stride * kBufferCount;
+        alloc_info.memoryTypeIndex = MemoryTypeIndex(reqs.memoryTypeBits);
+        CHECK_VK(vkAllocateMemory(device, &alloc_info, nullptr, &memory));
+        for (uint32_t i = 0; i < kBufferCount; ++i) CHECK_VK(vkBindBufferMemory(device, buffers[i], memory, stride * i));
+    }
+
+    void CreateDescriptors() {
+        VkDescriptorSetLayoutBinding binding = {};
+        binding.binding = 0;
+        binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        binding.descriptorCount = 1;
+        binding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+        VkDescriptorSetLayoutCreateInfo set_layout_ci = {};
+        set_layout_ci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        set_layout_ci.bindingCount = 1;
+        set_layout_ci.pBindings = &binding;
+        CHECK_VK(vkCreateDescriptorSetLayout(device, &set_layout_ci, nullptr, &set_layout));
+
+        CreateDescriptorSet(&descriptor_pool, &descriptor_set);
+
+        VkPushConstantRange push_range = {VK_SHADER_STAGE_VERTEX_BIT, 0, 16};
+        VkPipelineLayoutCreateInfo pipeline_layout_ci = {};
+        pipeline_layout_ci.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipeline_layout_ci.setLayoutCount = 1;
+        pipeline_layout_ci.pSetLayouts = &set_layout;
+        pipeline_layout_ci.pushConstantRangeCount = 1;
+        pipeline_layout_ci.pPushConstantRanges = &push_range;
+        CHECK_VK(vkCreatePipelineLayout(device, &pipeline_layout_ci, nullptr, &pipeline_layout));
+    }
+};
+
+// Per-thread command pool, command buffer and descriptor set; pools are externally synchronized so each thread gets its own
+struct RecordThreadState {
+    VkCommandPool pool = VK_NULL_HANDLE;
+    VkCommandBuffer cmd = VK_NULL_HANDLE;
+    VkDescriptorPool descriptor_pool = VK_NULL_HANDLE;
+    VkDescriptorSet descriptor_set = VK_NULL_HANDLE;
+};
+
+// Records a fixed group of kCommandsPerGroup Vulkan calls; index varies the parameters
+typedef void (*RecordCommandGroupFunc)(const BenchmarkDevice &dev, const RecordThreadState &state, uint32_t index);
+
+const uint32_t kCommandsPerGroup = 8;
+
+void RecordCommandGroup(const BenchmarkDevice &dev, const RecordThreadState &state, uint32_t index) {
+    VkCommandBuffer cmd = state.cmd;
+    VkViewport viewport = {0.0f, 0.0f, 256.0f, 256.0f, 0.0f, 1.0f};
+    VkRect2D scissor = {{0, 0}, {256, 256}};
+    VkDeviceSize offset = 0;
+    float push_data[4] = {static_cast<float>(index), 0.0f, 0.0f, 1.0f};
+    VkBufferCopy region = {0, 256, 256};
+
+    vkCmdSetViewport(cmd, 0, 1, &viewport);
+    vkCmdSetScissor(cmd, 0, 1, &scissor);
+    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, dev.pipeline_layout, 0, 1, &dev.descriptor_set, 0, nullptr);
+    vkCmdBindVertexBuffers(cmd, 0, 1, &dev.buffers[0], &offset);
+    vkCmdBindIndexBuffer(cmd, dev.buffers[1], 0, VK_INDEX_TYPE_UINT16);
+    vkCmdPushConstants(cmd, dev.pipeline_layout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(push_data), push_data);
+    vkCmdFillBuffer(cmd, dev.buffers[1], 0, 256, index);
+    vkCmdCopyBuffer(cmd, dev.buffers[0], dev.buffers[1], 1, &region);
+}
+
+void RecordDynamicStateGroup(const BenchmarkDevice &, const RecordThreadState &state, uint32_t index) {
+    VkCommandBuffer cmd = state.cmd;
+    VkViewport viewport = {0.0f, 0.0f, 256.0f, 256.0f, 0.0f, 1.0f};
+    VkRect2D scissor = {{0, 0}, {256, 256}};
+    float blend_constants[4] = {static_cast<float>(index), 0.0f, 0.0f, 1.0f};
+
+    vkCmdSetViewport(cmd, 0, 1, &viewport);
+    vkCmdSetScissor(cmd, 0, 1, &scissor);
+    vkCmdSetLineWidth(cmd, 1.0f);
+    vkCmdSetDepthBias(cmd, 0.0f, 0.0f, 0.0f);
+    vkCmdSetBlendConstants(cmd, blend_constants);
+    vkCmdSetStencilCompareMask(cmd, VK_STENCIL_FRONT_AND_BACK, index & 0xff);
+    vkCmdSetStencilWriteMask(cmd, VK_STENCIL_FRONT_AND_BACK, index & 0xff);
+    vkCmdSetStencilReference(cmd, VK_STENCIL_FRONT_AND_BACK, index & 0xff);
+}
+
+// Alternates rewriting the thread's own descriptor set with binding it, so nearly every handle passed is a wrapped one
+void RecordDescriptorGroup(const BenchmarkDevice &dev, const RecordThreadState &state, uint32_t index) {
+    VkDescriptorBufferInfo buffer_info = {dev.buffers[index % BenchmarkDevice::kBufferCount], 0, 256};
+    VkWriteDescriptorSet write = {};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = state.descriptor_set;
+    write.descriptorCount = 1;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    write.pBufferInfo = &buffer_info;
+
+    for (uint32_t i = 0; i < kCommandsPerGroup / 2; ++i) {
+        vkUpdateDescriptorSets(dev.device, 1, &write, 0, nullptr);
+        vkCmdBindDescriptorSets(state.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, dev.pipeline_layout, 0, 1, &state.descriptor_set, 0,
+                                nullptr);
+    }
+}
+
+double RunRecordBenchmark(const BenchmarkDevice &dev, const Options &options, RecordCommandGroupFunc record_group,
+                          uint32_t thread_count) {
+    std::vector<RecordThreadState> states(thread_count);
+    for (auto &state : states) {
+        VkCommandPoolCreateInfo pool_ci = {};
+        pool_ci.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        pool_ci.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        pool_ci.queueFamilyIndex = dev.queue_family;
+        CHECK_VK(vkCreateCommandPool(dev.device, &pool_ci, nullptr, &state.pool));
+
+        VkCommandBufferAllocateInfo cmd_alloc_info = {};
+        cmd_alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        cmd_alloc_info.commandPool = state.pool;
+        cmd_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        cmd_alloc_info.commandBufferCount = 1;
+        CHECK_VK(vkAllocateCommandBuffers(dev.device, &cmd_alloc_info, &state.cmd));
+
+        dev.CreateDescriptorSet(&state.descriptor_pool, &state.descriptor_set);
+    }
+
+    std::atomic<uint32_t> ready(0);
+    std::atomic<bool> go(false);
+    auto record = [&](RecordThreadState *state) {
+        VkCommandBufferBeginInfo begin_info = {};
+        begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        ready++;
+        while (!go) std::this_thread::yield();
+        for (uint32_t i = 0; i < options.iterations; ++i) {
+            vkBeginCommandBuffer(state->cmd, &begin_info);
+            for (uint32_t j = 0; j < options.commands_per_buffer; ++j) record_group(dev, *state, j);
+            vkEndCommandBuffer(state->cmd);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (auto &state : states) threads.emplace_back(record, &state);
+    while (ready != thread_count) std::this_thread::yield();
+    auto start = std::chrono::steady_clock::now();
+    go = true;
+    for (auto &thread : threads) thread.join();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    for (auto &state : states) {
+        vkDestroyCommandPool(dev.device, state.pool, nullptr);
+        vkDestroyDescriptorPool(dev.device, state.descriptor_pool, nullptr);
+    }
+
+    double commands = static_cast<double>(thread_count) * options.iterations * options.commands_per_buffer * kCommandsPerGroup;
+    return commands / elapsed.count();
+}
+
+void RunRecordBenchmarks(const BenchmarkDevice &dev, const Options &options, RecordCommandGroupFunc record_group) {
+    std::vector<uint32_t> thread_counts;
+    for (uint32_t threads = 1; threads < options.max_threads; threads *= 2) thread_counts.push_back(threads);
+    thread_counts.push_back(options.max_threads);
+
+    printf("%-8s %16s %10s\n", "threads", "commands/s", "scaling");
+    double single_thread_rate = 0.0;
+    for (auto threads : thread_counts) {
+        double rate = RunRecordBenchmark(dev, options, record_group, threads);
+        if (threads == 1) single_thread_rate = rate;
+        printf("%-8u %16.0f %9.2fx\n", threads, rate, rate / single_thread_rate);
+    }
+}
+
+// Returns command buffers recorded per second when all of options.command_buffers are re-recorded once per iteration
+double RunResetBenchmark(const BenchmarkDevice &dev, const Options &options, bool reset_pool) {
+    RecordThreadState state;
+    VkCommandPoolCreateInfo pool_ci = {};
+    pool_ci.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    pool_ci.flags = reset_pool ? 0 : VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_ci.queueFamilyIndex = dev.queue_family;
+    CHECK_VK(vkCreateCommandPool(dev.device, &pool_ci, nullptr, &state.pool));
+
+    std::vector<VkCommandBuffer> cmds(options.command_buffers);
+    VkCommandBufferAllocateInfo cmd_alloc_info = {};
+    cmd_alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    cmd_alloc_info.commandPool = state.pool;
+    cmd_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    cmd_alloc_info.commandBufferCount = options.command_buffers;
+    CHECK_VK(vkAllocateCommandBuffers(dev.device, &cmd_alloc_info, cmds.data()));
+
+    dev.CreateDescriptorSet(&state.descriptor_pool, &state.descriptor_set);
+
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < options.iterations; ++i) {
+        if (reset_pool) vkResetCommandPool(dev.device, state.pool, 0);
+        for (auto cmd : cmds) {
+            if (!reset_pool) vkResetCommandBuffer(cmd, 0);
+            state.cmd = cmd;
+            vkBeginCommandBuffer(cmd, &begin_info);
+            for (uint32_t j = 0; j < options.commands_per_buffer; ++j) RecordCommandGroup(dev, state, j);
+            vkEndCommandBuffer(cmd);
+        }
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    vkDestroyCommandPool(dev.device, state.pool, nullptr);
+    vkDestroyDescriptorPool(dev.device, state.descriptor_pool, nullptr);
+    return static_cast<double>(options.iterations) * options.command_buffers / elapsed.count();
+}
+
+void RunResetBenchmarks(const BenchmarkDevice &dev, const Options &options) {
+    if (options.command_buffers == 0) {
+        fprintf(stderr, "The reset benchmark needs at least one command buffer\n");
+        exit(1);
+    }
+
+    printf("%-24s %16s %12s\n", "reset", "buffers/s", "frames/s");
+    for (bool reset_pool : {true, false}) {
+        double rate = RunResetBenchmark(dev, options, reset_pool);
+        printf("%-24s %16.0f %12.1f\n", reset_pool ? "vkResetCommandPool" : "vkResetCommandBuffer", rate,
+               rate / options.command_buffers);
+    }
+}
+
+void RunBindBenchmark(const BenchmarkDevice &dev, const Options &options) {
+    if (options.bindings == 0) {
+        fprintf(stderr, "The bind benchmark needs at least one binding\n");
+        exit(1);
+    }
+
+    VkBufferCreateInfo buffer_ci = {};
+    buffer_ci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_ci.size = 256;
+    buffer_ci.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    buffer_ci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    std::vector<VkBuffer> buffers(options.bindings);
+    for (auto &buffer : buffers) CHECK_VK(vkCreateBuffer(dev.device, &buffer_ci, nullptr, &buffer));
+
+    VkMemoryRequirements reqs;
+    vkGetBufferMemoryRequirements(dev.device, buffers[0], &reqs);
+    VkDeviceSize alignment = reqs.alignment ? reqs.alignment : 1;
+    VkDeviceSize stride = (reqs.size + alignment - 1) / alignment * alignment;
+
+    VkDeviceMemory memory;
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = stride * options.bindings;
+    alloc_info.memoryTypeIndex = dev.MemoryTypeIndex(reqs.memoryTypeBits);
+    CHECK_VK(vkAllocateMemory(dev.device, &alloc_info, nullptr, &memory));
+
+    printf("%-24s %12s %16s\n", "bind", "buffers", "calls/s");
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < options.bindings; ++i) vkBindBufferMemory(dev.device, buffers[i], memory, stride * i);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    printf("%-24s %12u %16.0f\n", "vkBindBufferMemory", options.bindings, options.bindings / elapsed.count());
+
+    start = std::chrono::steady_clock::now();
+    for (auto buffer : buffers) vkDestroyBuffer(dev.device, buffer, nullptr);
+    elapsed = std::chrono::steady_clock::now() - start;
+    printf("%-24s %12u %16.0f\n", "vkDestroyBuffer", options.bindings, options.bindings / elapsed.count());
+
+    vkFreeMemory(dev.device, memory, nullptr);
+}
+
+// A SPIR-V module from the corpus along with its first entry point
+struct ShaderCorpusEntry {
+    std::string filename;
+    std::vector<uint32_t> words;
+    uint32_t execution_model = ~0u;
+    std::string entry_point;
+};
+
+// SPIR-V constants used to find entry points; kept local so the benchmark doesn't depend on the SPIR-V headers
+const uint32_t kSpirvMagic = 0x07230203;
+const uint32_t kSpirvOpEntryPoint = 15;
+const uint32_t kSpirvExecutionModelVertex = 0;
+const uint32_t kSpirvExecutionModelGLCompute = 5;
+
+// Checks the module's words and finds its first entry point
+bool ParseShaderCorpusEntry(ShaderCorpusEntry *entry) {
+    if (entry->words.size() < 5 || entry->words[0] != kSpirvMagic) return false;
+
+    for (size_t offset = 5; offset < entry->words.size();) {
+        uint32_t opcode = entry->words[offset] & 0xffffu;
+        uint32_t length = entry->words[offset] >> 16;
+        if (length == 0 || offset + length > entry->words.size()) return false;
+        if (opcode == kSpirvOpEntryPoint && length > 3) {
+            entry->execution_model = entry->words[offset + 1];
+            const char *name = reinterpret_cast<const char *>(&entry->words[offset + 3]);
+            entry->entry_point.assign(name, strnlen(name, (length - 3) * sizeof(uint32_t)));
+            break;
+        }
+        offset += length;
+    }
+    return true;
+}
+
+bool LoadShaderCorpusEntry(const char *filename, ShaderCorpusEntry *entry) {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+    std::streamsize size = file.tellg();
+    if (size < 20 || size % 4) return false;
+    entry->filename = filename;
+    entry->words.resize(static_cast<size_t>(size / 4));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char *>(entry->words.data()), size)) return false;
+    return ParseShaderCorpusEntry(entry);
+}
+
+// Builds a valid module whose "main" keeps a running sum in a function variable, adding each of statement_count (at least 1)
+// constants to it in turn. A Vertex module also writes gl_Position, and a GLCompute one declares a 1x1x1 workgroup. The
+// statements give core_validation's instruction walks and id lookups something to chew on without needing any resources.
+ShaderCorpusEntry GenerateShaderCorpusEntry(uint32_t execution_model, uint32_t statement_count) {
+    enum : uint32_t {
+        kVoid = 1,
+        kFunctionType,
+        kFloat,
+        kFloatPointer,
+        kVec4,
+        kVec4OutputPointer,
+        kPosition,
+        kZeroVec4,
+        kMain,
+        kLabel,
+        kSum,
+        kFirstId
+    };
+    const uint32_t constant_base = kFirstId;
+    const uint32_t result_base = constant_base + statement_count;
+    const uint32_t bound = result_base + 2 * statement_count;
+    const bool vertex = execution_model == kSpirvExecutionModelVertex;
+
+    std::vector<uint32_t> words = {kSpirvMagic, 0x00010000, 0, bound, 0};
+    auto op = [&words](uint32_t opcode, std::initializer_list<uint32_t> operands) {
+        words.push_back(static_cast<uint32_t>(operands.size() + 1) << 16 | opcode);
+        words.insert(words.end(), operands.begin(), operands.end());
+    };
+    const uint32_t kMainName = 0x6e69616d;  // "main", little-endian
+    op(17, {1});     // OpCapability Shader
+    op(14, {0, 1});  // OpMemoryModel Logical GLSL450
+    if (vertex) {
+        op(15, {execution_model, kMain, kMainName, 0, kPosition});  // OpEntryPoint Vertex %main "main" %position
+        op(71, {kPosition, 11, 0});                                 // OpDecorate %position BuiltIn Position
+    } else {
+        op(15, {execution_model, kMain, kMainName, 0});  // OpEntryPoint GLCompute %main "main"
+        op(16, {kMain, 17, 1, 1, 1});                    // OpExecutionMode %main LocalSize 1 1 1
+    }
+    op(19, {kVoid});                             // OpTypeVoid
+    op(33, {kFunctionType, kVoid});              // OpTypeFunction %void
+    op(22, {kFloat, 32});                        // OpTypeFloat 32
+    op(32, {kFloatPointer, 7, kFloat});          // OpTypePointer Function %float
+    op(23, {kVec4, kFloat, 4});                  // OpTypeVector %float 4
+    op(32, {kVec4OutputPointer, 3, kVec4});      // OpTypePointer Output %vec4
+    for (uint32_t i = 0; i < statement_count; ++i) {
+        float value = static_cast<float>(i);
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        op(43, {kFloat, constant_base + i, bits});  // OpConstant %float i
+    }
+    op(46, {kVec4, kZeroVec4});                  // OpConstantNull %vec4
+    if (vertex) op(59, {kVec4OutputPointer, kPosition, 3});  // OpVariable Output
+    op(54, {kVoid, kMain, 0, kFunctionType});    // OpFunction %void None %fn
+    op(248, {kLabel});                           // OpLabel
+    op(59, {kFloatPointer, kSum, 7});            // OpVariable Function
+    op(62, {kSum, constant_base});               // OpStore
+    for (uint32_t i = 1; i < statement_count; ++i) {
+        uint32_t loaded = result_base + 2 * i, added = loaded + 1;
+        op(61, {kFloat, loaded, kSum});                      // OpLoad
+        op(129, {kFloat, added, loaded, constant_base + i});  // OpFAdd
+        op(62, {kSum, added});                               // OpStore
+    }
+    if (vertex) op(62, {kPosition, kZeroVec4});  // OpStore
+    op(253, {});                                 // OpReturn
+    op(56, {});                                  // OpFunctionEnd
+
+    ShaderCorpusEntry entry;
+    entry.filename = std::string(vertex ? "(built-in) vertex, " : "(built-in) compute, ") + std::to_string(statement_count) +
+                     " statements";
+    entry.words = std::move(words);
+    ParseShaderCorpusEntry(&entry);
+    return entry;
+}
+
+// Returns pipelines created per second, or 0 if the module's entry point isn't one the benchmark knows how to build
+double RunPipelineBenchmark(const BenchmarkDevice &dev, const Options &options, VkRenderPass render_pass,
+                            const ShaderCorpusEntry &entry) {
+    if (entry.execution_model != kSpirvExecutionModelGLCompute && entry.execution_model != kSpirvExecutionModelVertex) return 0.0;
+
+    VkShaderModuleCreateInfo module_ci = {};
+    module_ci.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    module_ci.codeSize = entry.words.size() * sizeof(uint32_t);
+    module_ci.pCode = entry.words.data();
+    VkShaderModule module;
+    CHECK_VK(vkCreateShaderModule(dev.device, &module_ci, nullptr, &module));
+
+    VkPipelineShaderStageCreateInfo stage = {};
+    stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stage.module = module;
+    stage.pName = entry.entry_point.c_str();
+
+    VkComputePipelineCreateInfo compute_ci = {};
+    compute_ci.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    compute_ci.layout = dev.pipeline_layout;
+
+    VkPipelineVertexInputStateCreateInfo vertex_input = {};
+    vertex_input.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    VkPipelineInputAssemblyStateCreateInfo input_assembly = {};
+    input_assembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_POINT_LIST;
+    VkPipelineRasterizationStateCreateInfo rasterization = {};
+    rasterization.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterization.rasterizerDiscardEnable = VK_TRUE;
+    rasterization.lineWidth = 1.0f;
+    VkGraphicsPipelineCreateInfo graphics_ci = {};
+    graphics_ci.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    graphics_ci.stageCount = 1;
+    graphics_ci.pStages = &stage;
+    graphics_ci.pVertexInputState = &vertex_input;
+    graphics_ci.pInputAssemblyState = &input_assembly;
+    graphics_ci.pRasterizationState = &rasterization;
+    graphics_ci.layout = dev.pipeline_layout;
+    graphics_ci.renderPass = render_pass;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < options.iterations; ++i) {
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        VkResult result;
+        if (entry.execution_model == kSpirvExecutionModelGLCompute) {
+            stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+            compute_ci.stage = stage;
+            result = vkCreateComputePipelines(dev.device, VK_NULL_HANDLE, 1, &compute_ci, nullptr, &pipeline);
+        } else {
+            stage.stage = VK_SHADER_STAGE_VERTEX_BIT;
+            result = vkCreateGraphicsPipelines(dev.device, VK_NULL_HANDLE, 1, &graphics_ci, nullptr, &pipeline);
+        }
+        if (result == VK_SUCCESS) vkDestroyPipeline(dev.device, pipeline, nullptr);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    vkDestroyShaderModule(dev.device, module, nullptr);
+    return options.iterations / elapsed.count();
+}
+
+void RunPipelineBenchmarks(const BenchmarkDevice &dev, const Options &options) {
+    std::vector<ShaderCorpusEntry> corpus;
+    for (auto filename : options.spirv_files) {
+        ShaderCorpusEntry entry;
+        if (!LoadShaderCorpusEntry(filename, &entry)) {
+            fprintf(stderr, "Skipping %s: not a readable SPIR-V module\n", filename);
+            continue;
+        }
+        corpus.push_back(std::move(entry));
+    }
+    if (options.spirv_files.empty()) {
+        fprintf(stderr, "No --spirv modules given; using the built-in corpus of generated shaders\n");
+        for (uint32_t statement_count : {16u, 256u, 4096u}) {
+            corpus.push_back(GenerateShaderCorpusEntry(kSpirvExecutionModelGLCompute, statement_count));
+            corpus.push_back(GenerateShaderCorpusEntry(kSpirvExecutionModelVertex, statement_count));
+        }
+    }
+
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    VkRenderPassCreateInfo render_pass_ci = {};
+    render_pass_ci.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    render_pass_ci.subpassCount = 1;
+    render_pass_ci.pSubpasses = &subpass;
+    VkRenderPass render_pass;
+    CHECK_VK(vkCreateRenderPass(dev.device, &render_pass_ci, nullptr, &render_pass));
+
+    printf("%-48s %10s %16s\n", "module", "words", "pipelines/s");
+    double total_time = 0.0;
+    uint32_t measured = 0;
+    for (auto const &entry : corpus) {
+        double rate = RunPipelineBenchmark(dev, options, render_pass, entry);
+        if (rate == 0.0) {
+            fprintf(stderr, "Skipping %s: no compute or vertex entry point\n", entry.filename.c_str());
+            continue;
+        }
+        printf("%-48s %10zu %16.1f\n", entry.filename.c_str(), entry.words.size(), rate);
+        total_time += 1.0 / rate;
+        ++measured;
+    }
+    if (measured) printf("%-48s %10s %16.1f\n", "(corpus)", "", measured / total_time);
+
+    vkDestroyRenderPass(dev.device, render_pass, nullptr);
+}
+
+double NanosecondsPerCall(std::chrono::steady_clock::time_point start, uint64_t calls) {
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / calls;
+}
+
+void RunProcAddrBenchmarks(const BenchmarkDevice &dev, const Options &options) {
+    printf("%-24s %12s %12s\n", "lookup", "calls", "ns/call");
+
+    // Every name, resolved; instance-level names come back NULL from vkGetDeviceProcAddr but still cost a lookup
+    uintptr_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < options.iterations; ++i) {
+        for (uint32_t j = 0; j < kVulkanCommandCount; ++j) {
+            sink += reinterpret_cast<uintptr_t>(vkGetDeviceProcAddr(dev.device, vulkan_command_names[j]));
+        }
+    }
+    uint64_t calls = static_cast<uint64_t>(options.iterations) * kVulkanCommandCount;
+    printf("%-24s %12llu %12.1f\n", "known commands", static_cast<unsigned long long>(calls), NanosecondsPerCall(start, calls));
+
+    std::vector<std::string> unknown_names;
+    for (uint32_t j = 0; j < kVulkanCommandCount; ++j) unknown_names.push_back(std::string(vulkan_command_names[j]) + "XYZ");
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < options.iterations; ++i) {
+        for (const auto &name : unknown_names) sink += reinterpret_cast<uintptr_t>(vkGetDeviceProcAddr(dev.device, name.c_str()));
+    }
+    printf("%-24s %12llu %12.1f\n", "unknown commands", static_cast<unsigned long long>(calls), NanosecondsPerCall(start, calls));
+
+    float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_ci = {};
+    queue_ci.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queue_ci.queueFamilyIndex = dev.queue_family;
+    queue_ci.queueCount = 1;
+    queue_ci.pQueuePriorities = &priority;
+    VkDeviceCreateInfo device_ci = {};
+    device_ci.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    device_ci.queueCreateInfoCount = 1;
+    device_ci.pQueueCreateInfos = &queue_ci;
+    const uint32_t device_count = options.iterations / 10 + 1;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < device_count; ++i) {
+        VkDevice device;
+        CHECK_VK(vkCreateDevice(dev.gpu, &device_ci, nullptr, &device));
+        vkDestroyDevice(device, nullptr);
+    }
+    printf("%-24s %12u %12.1f\n", "vkCreateDevice", device_count, NanosecondsPerCall(start, device_count));
+
+    if (sink == 1) printf("\n");  // Keep the lookups from being optimized away
+}
+
+void RunDeviceLookupBenchmark(const Options &options) {
+    VkApplicationInfo app_info = {};
+    app_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    app_info.pApplicationName = "vk_layer_benchmarks";
+    app_info.apiVersion = VK_API_VERSION_1_0;
+    VkInstanceCreateInfo instance_ci = {};
+    instance_ci.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instance_ci.pApplicationInfo = &app_info;
+    instance_ci.enabledLayerCount = static_cast<uint32_t>(options.layers.size());
+    instance_ci.ppEnabledLayerNames = options.layers.data();
+
+    std::vector<VkInstance> instances(options.instances);
+    std::vector<VkPhysicalDevice> gpus(options.instances);
+    for (uint32_t i = 0; i < options.instances; ++i) {
+        CHECK_VK(vkCreateInstance(&instance_ci, nullptr, &instances[i]));
+        uint32_t gpu_count = 1;
+        VkResult result = vkEnumeratePhysicalDevices(instances[i], &gpu_count, &gpus[i]);
+        if (gpu_count == 0 || (result != VK_SUCCESS && result != VK_INCOMPLETE)) {
+            fprintf(stderr, "No physical devices found\n");
+            exit(1);
+        }
+        // core_validation expects the queue families to have been queried before vkCreateDevice
+        uint32_t family_count = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(gpus[i], &family_count, nullptr);
+        std::vector<VkQueueFamilyProperties> families(family_count);
+        vkGetPhysicalDeviceQueueFamilyProperties(gpus[i], &family_count, families.data());
+    }
+
+    float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_ci = {};
+    queue_ci.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queue_ci.queueFamilyIndex = 0;
+    queue_ci.queueCount = 1;
+    queue_ci.pQueuePriorities = &priority;
+    VkDeviceCreateInfo device_ci = {};
+    device_ci.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    device_ci.queueCreateInfoCount = 1;
+    device_ci.pQueueCreateInfos = &queue_ci;
+
+    printf("%-24s %12s %12s\n", "call", "calls", "ns/call");
+
+    std::vector<VkDevice> devices(options.devices);
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < options.devices; ++i) {
+        CHECK_VK(vkCreateDevice(gpus[i % options.instances], &device_ci, nullptr, &devices[i]));
+    }
+    printf("%-24s %12u %12.1f\n", "vkCreateDevice", options.devices, NanosecondsPerCall(start, options.devices));
+
+    // Names outside the dispatch table go down to the loader's terminator, which looks the device up
+    uintptr_t sink = 0;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < options.iterations; ++i) {
+        for (auto device : devices) sink += reinterpret_cast<uintptr_t>(vkGetDeviceProcAddr(device, "vkBenchmarkUnknownCommand"));
+    }
+    uint64_t calls = static_cast<uint64_t>(options.iterations) * options.devices;
+    printf("%-24s %12llu %12.1f\n", "vkGetDeviceProcAddr", static_cast<unsigned long long>(calls),
+           NanosecondsPerCall(start, calls));
+
+    start = std::chrono::steady_clock::now();
+    for (auto device : devices) vkDestroyDevice(device, nullptr);
+    printf("%-24s %12u %12.1f\n", "vkDestroyDevice", options.devices, NanosecondsPerCall(start, options.devices));
+
+    for (auto instance : instances) vkDestroyInstance(instance, nullptr);
+    if (sink == 1) printf("\n");  // Keep the lookups from being optimized away
+}
+
+// A vertex shader that does nothing, for pipelines that are only ever drawn with rasterization discarded:
+//   OpCapability Shader
+//   OpMemoryModel Logical GLSL450
+//   OpEntryPoint Vertex %3 "main"
+//   %1 = OpTypeVoid
+//   %2 = OpTypeFunction %1
+//   %3 = OpFunction %1 None %2
+//   %4 = OpLabel
+//        OpReturn
+//        OpFunctionEnd
+const uint32_t kEmptyVertexShader[] = {
+    kSpirvMagic, 0x00010000, 0, 5, 0, 0x00020011, 1, 0x0003000e, 0, 1, 0x0005000f, 0, 3, 0x6e69616d, 0,
+    0x00020013, 1, 0x00030021, 2, 1, 0x00050036, 1, 3, 0, 2, 0x000200f8, 4, 0x000100fd, 0x00010038,
+};
+
+// Command buffers handed to each vkQueueSubmit by the submit stream
+const uint32_t kSubmitCommandBuffers = 64;
+
+// Descriptor writes passed to each vkUpdateDescriptorSets by the update stream
+const uint32_t kDescriptorWritesPerUpdate = 8;
+
+// Objects shared by every thread running a call stream
+struct StreamContext {
+    const BenchmarkDevice &dev;
+    const Options &options;
+    VkRenderPass render_pass;
+    VkFramebuffer framebuffer;
+    VkPipeline pipeline;
+};
+
+// Per-thread objects for the call streams; each thread owns everything it records into, maps or submits
+struct StreamThreadState : RecordThreadState {
+    uint32_t queue_index = 0;
+    std::vector<VkCommandBuffer> submit_cmds;
+    VkFence fence = VK_NULL_HANDLE;
+    VkDeviceMemory host_memory = VK_NULL_HANDLE;
+    uint64_t calls = 0;
+    uint64_t allocations = 0;
+};
+
+// Issues one round of a call stream and returns the number of Vulkan calls it made
+typedef uint64_t (*StreamRoundFunc)(const StreamContext &context, StreamThreadState *state);
+
+// Records one command buffer of --commands draws inside a render pass, rebinding a descriptor set before each one
+uint64_t RunDrawRound(const StreamContext &context, StreamThreadState *state) {
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    VkRenderPassBeginInfo render_pass_begin = {};
+    render_pass_begin.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    render_pass_begin.renderPass = context.render_pass;
+    render_pass_begin.framebuffer = context.framebuffer;
+    render_pass_begin.renderArea = {{0, 0}, {256, 256}};
+
+    VkCommandBuffer cmd = state->cmd;
+    const VkDescriptorSet sets[2] = {context.dev.descriptor_set, state->descriptor_set};
+    vkBeginCommandBuffer(cmd, &begin_info);
+    vkCmdBeginRenderPass(cmd, &render_pass_begin, VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, context.pipeline);
+    for (uint32_t i = 0; i < context.options.commands_per_buffer; ++i) {
+        vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, context.dev.pipeline_layout, 0, 1, &sets[i & 1], 0,
+                                nullptr);
+        vkCmdDraw(cmd, 3, 1, 0, 0);
+    }
+    vkCmdEndRenderPass(cmd);
+    vkEndCommandBuffer(cmd);
+    return 5 + 2ull * context.options.commands_per_buffer;
+}
+
+// Issues --commands vkUpdateDescriptorSets calls back to back, each rewriting the thread's descriptor set several times
+uint64_t RunUpdateRound(const StreamContext &context, StreamThreadState *state) {
+    VkDescriptorBufferInfo buffer_infos[BenchmarkDevice::kBufferCount];
+    for (uint32_t i = 0; i < BenchmarkDevice::kBufferCount; ++i) buffer_infos[i] = {context.dev.buffers[i], 0, 256};
+    VkWriteDescriptorSet writes[kDescriptorWritesPerUpdate] = {};
+    for (uint32_t i = 0; i < kDescriptorWritesPerUpdate; ++i) {
+        writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[i].dstSet = state->descriptor_set;
+        writes[i].descriptorCount = 1;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        writes[i].pBufferInfo = &buffer_infos[i % BenchmarkDevice::kBufferCount];
+    }
+    for (uint32_t i = 0; i < context.options.commands_per_buffer; ++i) {
+        vkUpdateDescriptorSets(context.dev.device, kDescriptorWritesPerUpdate, writes, 0, nullptr);
+    }
+    return context.options.commands_per_buffer;
+}
+
+// Submits the thread's prerecorded command buffers in one batch and waits for them, so that layers retire the work each round
+uint64_t RunSubmitRound(const StreamContext &context, StreamThreadState *state) {
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = static_cast<uint32_t>(state->submit_cmds.size());
+    submit_info.pCommandBuffers = state->submit_cmds.data();
+    {
+        std::lock_guard<std::mutex> lock(*context.dev.queue_mutexes[state->queue_index]);
+        CHECK_VK(vkQueueSubmit(context.dev.queues[state->queue_index], 1, &submit_info, state->fence));
+    }
+    CHECK_VK(vkWaitForFences(context.dev.device, 1, &state->fence, VK_TRUE, UINT64_MAX));
+    CHECK_VK(vkResetFences(context.dev.device, 1, &state->fence));
+    return 3;
+}
+
+// Maps the thread's host-visible allocation, writes to it, flushes the write and unmaps it again
+uint64_t RunMapRound(const StreamContext &context, StreamThreadState *state) {
+    void *data = nullptr;
+    CHECK_VK(vkMapMemory(context.dev.device, state->host_memory, 0, VK_WHOLE_SIZE, 0, &data));
+    memset(data, static_cast<int>(state->calls & 0xff), 256);
+    VkMappedMemoryRange range = {};
+    range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+    range.memory = state->host_memory;
+    range.size = VK_WHOLE_SIZE;
+    CHECK_VK(vkFlushMappedMemoryRanges(context.dev.device, 1, &range));
+    vkUnmapMemory(context.dev.device, state->host_memory);
+    return 3;
+}
+
+struct CallStream {
+    const char *name;
+    StreamRoundFunc run_round;
+};
+
+const CallStream kCallStreams[] = {
+    {"draw", RunDrawRound}, {"update", RunUpdateRound}, {"submit", RunSubmitRound}, {"map", RunMapRound},
+};
+
+void CreateStreamThreadState(const StreamContext &context, uint32_t thread_index, StreamThreadState *state) {
+    const BenchmarkDevice &dev = context.dev;
+    VkCommandPoolCreateInfo pool_ci = {};
+    pool_ci.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    pool_ci.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_ci.queueFamilyIndex = dev.queue_family;
+    CHECK_VK(vkCreateCommandPool(dev.device, &pool_ci, nullptr, &state->pool));
+
+    std::vector<VkCommandBuffer> cmds(kSubmitCommandBuffers + 1);
+    VkCommandBufferAllocateInfo cmd_alloc_info = {};
+    cmd_alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    cmd_alloc_info.commandPool = state->pool;
+    cmd_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    cmd_alloc_info.commandBufferCount = static_cast<uint32_t>(cmds.size());
+    CHECK_VK(vkAllocateCommandBuffers(dev.device, &cmd_alloc_info, cmds.data()));
+    state->cmd = cmds.back();
+    cmds.pop_back();
+    state->submit_cmds = cmds;
+
+    dev.CreateDescriptorSet(&state->descriptor_pool, &state->descriptor_set);
+
+    // The submitted command buffers are recorded once and resubmitted every round
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    RecordThreadState record_state = *state;
+    for (auto cmd : state->submit_cmds) {
+        record_state.cmd = cmd;
+        vkBeginCommandBuffer(cmd, &begin_info);
+        for (uint32_t i = 0; i < 4; ++i) RecordCommandGroup(dev, record_state, i);
+        vkEndCommandBuffer(cmd);
+    }
+    state->queue_index = thread_index % dev.queues.size();
+
+    VkFenceCreateInfo fence_ci = {};
+    fence_ci.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    CHECK_VK(vkCreateFence(dev.device, &fence_ci, nullptr, &state->fence));
+
+    // Prefer memory that needs the flush, so that the stream measures the layers' checks on it
+    const VkMemoryPropertyFlags host_visible = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    uint32_t type_index = dev.FindMemoryType(UINT32_MAX, host_visible, VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    if (type_index == UINT32_MAX) type_index = dev.MemoryTypeIndex(UINT32_MAX, host_visible);
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = BenchmarkDevice::kBufferSize;
+    alloc_info.memoryTypeIndex = type_index;
+    CHECK_VK(vkAllocateMemory(dev.device, &alloc_info, nullptr, &state->host_memory));
+}
+
+void DestroyStreamThreadState(const StreamContext &context, StreamThreadState *state) {
+    const BenchmarkDevice &dev = context.dev;
+    vkFreeMemory(dev.device, state->host_memory, nullptr);
+    vkDestroyFence(dev.device, state->fence, nullptr);
+    vkDestroyCommandPool(dev.device, state->pool, nullptr);
+    vkDestroyDescriptorPool(dev.device, state->descriptor_pool, nullptr);
+}
+
+// Result of running one call stream on some number of threads
+struct StreamResult {
+    const char *stream;
+    uint32_t threads;
+    uint64_t calls;
+    double ns_per_call;  // thread time per call
+    double allocations_per_call;
+    double calls_per_second;
+};
+
+StreamResult RunCallStream(const StreamContext &context, const CallStream &stream, uint32_t thread_count) {
+    std::vector<StreamThreadState> states(thread_count);
+    for (uint32_t i = 0; i < thread_count; ++i) CreateStreamThreadState(context, i, &states[i]);
+
+    std::atomic<uint32_t> ready(0);
+    std::atomic<bool> go(false);
+    auto run = [&](StreamThreadState *state) {
+        ready++;
+        while (!go) std::this_thread::yield();
+        uint64_t allocations_before = thread_allocations;
+        for (uint32_t i = 0; i < context.options.iterations; ++i) state->calls += stream.run_round(context, state);
+        state->allocations = thread_allocations - allocations_before;
+    };
+
+    std::vector<std::thread> threads;
+    for (auto &state : states) threads.emplace_back(run, &state);
+    while (ready != thread_count) std::this_thread::yield();
+    auto start = std::chrono::steady_clock::now();
+    go = true;
+    for (auto &thread : threads) thread.join();
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    StreamResult result = {stream.name, thread_count, 0, 0.0, 0.0, 0.0};
+    uint64_t allocations = 0;
+    for (auto &state : states) {
+        result.calls += state.calls;
+        allocations += state.allocations;
+        DestroyStreamThreadState(context, &state);
+    }
+    if (result.calls) {
+        result.ns_per_call = elapsed.count() * thread_count / result.calls;
+        result.allocations_per_call = static_cast<double>(allocations) / result.calls;
+        result.calls_per_second = result.calls * 1e9 / elapsed.count();
+    }
+    return result;
+}
+
+void WriteStreamResults(const char *filename, const BenchmarkDevice &dev, const Options &options,
+                        const std::vector<StreamResult> &results, const std::vector<double> &scaling) {
+    FILE *file = fopen(filename, "w");
+    if (!file) {
+        fprintf(stderr, "Could not open %s for writing\n", filename);
+        exit(1);
+    }
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(dev.gpu, &properties);
+
+    // Layer and device names are identifiers, so nothing in them needs escaping
+    fprintf(file, "{\n  \"benchmark\": \"streams\",\n  \"device\": \"%s\",\n  \"layers\": [", properties.deviceName);
+    for (size_t i = 0; i < options.layers.size(); ++i) fprintf(file, "%s\"%s\"", i ? ", " : "", options.layers[i]);
+    fprintf(file, "],\n  \"iterations\": %u,\n  \"commands\": %u,\n  \"results\": [\n", options.iterations,
+            options.commands_per_buffer);
+    for (size_t i = 0; i < results.size(); ++i) {
+        const StreamResult &result = results[i];
+        fprintf(file,
+                "    {\"stream\": \"%s\", \"threads\": %u, \"calls\": %llu, \"ns_per_call\": %.2f, \"allocations_per_call\": %.3f, "
+                "\"calls_per_second\": %.0f, \"scaling\": %.3f}%s\n",
+                result.stream, result.threads, static_cast<unsigned long long>(result.calls), result.ns_per_call,
+                result.allocations_per_call, result.calls_per_second, scaling[i], i + 1 < results.size() ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+}
+
+void RunStreamBenchmarks(const BenchmarkDevice &dev, const Options &options) {
+    std::vector<const CallStream *> streams;
+    for (const auto &stream : kCallStreams) streams.push_back(&stream);
+    if (!options.streams.empty()) {
+        streams.clear();
+        for (const auto &name : options.streams) {
+            auto it = std::find_if(std::begin(kCallStreams), std::end(kCallStreams),
+                                   [&name](const CallStream &stream) { return name == stream.name; });
+            if (it == std::end(kCallStreams)) {
+                fprintf(stderr, "Unknown stream %s; the streams are draw, update, submit and map\n", name.c_str());
+                exit(1);
+            }
+            streams.push_back(&*it);
+        }
+    }
+
+    // A render pass without attachments and a pipeline that discards rasterization are all the draws need
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    VkRenderPassCreateInfo render_pass_ci = {};
+    render_pass_ci.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    render_pass_ci.subpassCount = 1;
+    render_pass_ci.pSubpasses = &subpass;
+    VkRenderPass render_pass;
+    CHECK_VK(vkCreateRenderPass(dev.device, &render_pass_ci, nullptr, &render_pass));
+
+    VkFramebufferCreateInfo framebuffer_ci = {};
+    framebuffer_ci.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    framebuffer_ci.renderPass = render_pass;
+    framebuffer_ci.width = 256;
+    framebuffer_ci.height = 256;
+    framebuffer_ci.layers = 1;
+    VkFramebuffer framebuffer;
+    CHECK_VK(vkCreateFramebuffer(dev.device, &framebuffer_ci, nullptr, &framebuffer));
+
+    VkShaderModuleCreateInfo module_ci = {};
+    module_ci.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    module_ci.codeSize = sizeof(kEmptyVertexShader);
+    module_ci.pCode = kEmptyVertexShader;
+    VkShaderModule module;
+    CHECK_VK(vkCreateShaderModule(dev.device, &module_ci, nullptr, &module));
+
+    VkPipelineShaderStageCreateInfo stage = {};
+    stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stage.stage = VK_SHADER_STAGE_VERTEX_BIT;
+    stage.module = module;
+    stage.pName = "main";
+    VkPipelineVertexInputStateCreateInfo vertex_input = {};
+    vertex_input.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    VkPipelineInputAssemblyStateCreateInfo input_assembly = {};
+    input_assembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    VkPipelineRasterizationStateCreateInfo rasterization = {};
+    rasterization.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterization.rasterizerDiscardEnable = VK_TRUE;
+    rasterization.lineWidth = 1.0f;
+    VkGraphicsPipelineCreateInfo pipeline_ci = {};
+    pipeline_ci.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipeline_ci.stageCount = 1;
+    pipeline_ci.pStages = &stage;
+    pipeline_ci.pVertexInputState = &vertex_input;
+    pipeline_ci.pInputAssemblyState = &input_assembly;
+    pipeline_ci.pRasterizationState = &rasterization;
+    pipeline_ci.layout = dev.pipeline_layout;
+    pipeline_ci.renderPass = render_pass;
+    VkPipeline pipeline;
+    CHECK_VK(vkCreateGraphicsPipelines(dev.device, VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &pipeline));
+
+    StreamContext context = {dev, options, render_pass, framebuffer, pipeline};
+
+    std::vector<uint32_t> thread_counts;
+    for (uint32_t threads = 1; threads < options.max_threads; threads *= 2) thread_counts.push_back(threads);
+    thread_counts.push_back(options.max_threads);
+
+    std::vector<StreamResult> results;
+    std::vector<double> scaling;
+    printf("%-8s %8s %12s %12s %14s %10s\n", "stream", "threads", "calls", "ns/call", "allocs/call", "scaling");
+    for (auto stream : streams) {
+        double single_thread_rate = 0.0;
+        for (auto threads : thread_counts) {
+            StreamResult result = RunCallStream(context, *stream, threads);
+            if (threads == 1) single_thread_rate = result.calls_per_second;
+            results.push_back(result);
+            scaling.push_back(single_thread_rate > 0.0 ? result.calls_per_second / single_thread_rate : 0.0);
+            printf("%-8s %8u %12llu %12.1f %14.2f %9.2fx\n", result.stream, threads, static_cast<unsigned long long>(result.calls),
+                   result.ns_per_call, result.allocations_per_call, scaling.back());
+        }
+    }
+    if (options.json_file) WriteStreamResults(options.json_file, dev, options, results, scaling);
+
+    vkDestroyPipeline(dev.device, pipeline, nullptr);
+    vkDestroyShaderModule(dev.device, module, nullptr);
+    vkDestroyFramebuffer(dev.device, framebuffer, nullptr);
+    vkDestroyRenderPass(dev.device, render_pass, nullptr);
+}
+
+void Usage(const char *argv0) {
+    fprintf(stderr,
+            "Usage: %s [--benchmark record|contention|descriptors|reset|bind|pipeline|gpa|devices|streams]\n"
+            "          [--layer <name>]... [--threads <max>] [--iterations <n>] [--commands <n>] [--buffers <n>]\n"
+            "          [--bindings <n>] [--devices <n>] [--instances <n>] [--spirv <file>]... [--stream <name>]...\n"
+            "          [--json <file>]\n"
+            "  --benchmark   benchmark to run (default record)\n"
+            "  --layer       enable an instance layer (may be repeated)\n"
+            "  --threads     largest recording thread count to measure (default 8)\n"
+            "  --iterations  command buffers recorded per thread, frames recorded, pipelines created per module,\n"
+            "                passes over the command names or devices, or rounds of each call stream (default 200)\n"
+            "  --commands    command groups recorded per command buffer, or draws or descriptor updates per call\n"
+            "                stream round (default 256)\n"
+            "  --buffers     command buffers re-recorded per frame by the reset benchmark (default 3000)\n"
+            "  --bindings    buffers bound into one allocation by the bind benchmark (default 100000)\n"
+            "  --devices     logical devices created by the devices benchmark (default 256)\n"
+            "  --instances   instances the devices benchmark spreads its devices over (default 4)\n"
+            "  --spirv       SPIR-V module to add to the pipeline benchmark corpus (may be repeated; default a small\n"
+            "                built-in corpus of generated shaders)\n"
+            "  --stream      call stream run by the streams benchmark: draw, update, submit or map (may be repeated;\n"
+            "                default all)\n"
+            "  --json        file to write the streams benchmark results to as JSON\n",
+            argv0);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        bool has_value = i + 1 < argc;
+        if (!strcmp(argv[i], "--benchmark") && has_value) {
+            options.benchmark = argv[++i];
+        } else if (!strcmp(argv[i], "--layer") && has_value) {
+            options.layers.push_back(argv[++i]);
+        } else if (!strcmp(argv[i], "--threads") && has_value) {
+            options.max_threads = static_cast<uint32_t>(atoi(argv[++i]));
+        } else if (!strcmp(argv[i], "--iterations") && has_value) {
+            options.iterations = static_cast<uint32_t>(atoi(argv[++i]));
+        } else if (!strcmp(argv[i], "--commands") && has_value) {
+            options.commands_per_buffer = static_cast<uint32_t>(atoi(argv[++i]));
+        } else if (!strcmp(argv[i], "--buffers") && has_value) {
+            options.command_buffers = static_cast<uint32_t>(atoi(argv[++i]));
+        } else if (!strcmp(argv[i], "--bindings") && has_value) {
+            options.bindings = static_cast<uint32_t>(atoi(argv[++i]));
+        } else if (!strcmp(argv[i], "--devices") && has_value) {
+            options.devices = static_cast<uint32_t>(atoi(argv[++i]));
+        } else if (!strcmp(argv[i], "--instances") && has_value) {
+            options.instances = static_cast<uint32_t>(atoi(argv[++i]));
+        } else if (!strcmp(argv[i], "--spirv") && has_value) {
+            options.spirv_files.push_back(argv[++i]);
+        } else if (!strcmp(argv[i], "--stream") && has_value) {
+            options.streams.push_back(argv[++i]);
+        } else if (!strcmp(argv[i], "--json") && has_value) {
+            options.json_file = argv[++i];
+        } else {
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+    if (options.max_threads == 0) options.max_threads = 1;
+    if (options.instances == 0) options.instances = 1;
+
+    if (options.benchmark != "record" && options.benchmark != "contention" && options.benchmark != "descriptors" &&
+        options.benchmark != "reset" && options.benchmark != "bind" && options.benchmark != "pipeline" &&
+        options.benchmark != "gpa" && options.benchmark != "devices" && options.benchmark != "streams") {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    // Runs without the shared device, which needs more of the driver than the loader test ICD provides
+    if (options.benchmark == "devices") {
+        RunDeviceLookupBenchmark(options);
+        return 0;
+    }
+
+    BenchmarkDevice dev(options);
+
+    if (options.benchmark == "record") {
+        RunRecordBenchmarks(dev, options, RecordCommandGroup);
+    } else if (options.benchmark == "contention") {
+        RunRecordBenchmarks(dev, options, RecordDynamicStateGroup);
+    } else if (options.benchmark == "descriptors") {
+        RunRecordBenchmarks(dev, options, RecordDescriptorGroup);
+    } else if (options.benchmark == "reset") {
+        RunResetBenchmarks(dev, options);
+    } else if (options.benchmark == "bind") {
+        RunBindBenchmark(dev, options);
+    } else if (options.benchmark == "pipeline") {
+        RunPipelineBenchmarks(dev, options);
+    } else if (options.benchmark == "streams") {
+        RunStreamBenchmarks(dev, options);
+    } else {
+        RunProcAddrBenchmarks(dev, options);
+    }
+    return 0;
+}
@@ -33,11 +33,17 @@
 #include <stdint.h> // For UINT32_MAX
 
 #include <algorithm>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <vector>
 
+#if !defined(_WIN32)
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
 #include "test_common.h"
 #include <vulkan/vulkan.h>
 
@@ -547,6 +553,54 @@ TEST(EnumeratePhysicalDevices, TwoCallIncomplete) {
     vkDestroyInstance(instance, nullptr);
 }
 
+// Test that enumerating the physical devices again returns the same handles, and that the loader
+// reuses its cached lists instead of allocating new ones while the drivers report no change.
+TEST(EnumeratePhysicalDevices, RepeatCallReusesHandles) {
+    auto const info = VK::InstanceCreateInfo();
+    VkInstance instance = VK_NULL_HANDLE;
+    VkAllocationCallbacks alloc_callbacks = {};
+    alloc_callbacks.pUserData = (void *)0x00000021;
+    alloc_callbacks.pfnAllocation = AllocCallbackFunc;
+    alloc_callbacks.pfnReallocation = ReallocCallbackFunc;
+    alloc_callbacks.pfnFree = FreeCallbackFunc;
+
+    InitAllocTracker(2048);
+
+    VkResult result = vkCreateInstance(info, &alloc_callbacks, &instance);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    uint32_t physicalCount = 0;
+    result = vkEnumeratePhysicalDevices(instance, &physicalCount, nullptr);
+    ASSERT_EQ(result, VK_SUCCESS);
+    ASSERT_GT(physicalCount, 0u);
+
+    std::unique_ptr<VkPhysicalDevice[]> physical(new VkPhysicalDevice[physicalCount]);
+    result = vkEnumeratePhysicalDevices(instance, &physicalCount, physical.get());
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    // Fail any further allocation so a repeat enumeration that rebuilds its lists shows up as an error.
+    g_intentional_fail_enabled = true;
+    g_intenional_fail_index = 1;
+    g_intenional_fail_count = 0;
+
+    uint32_t repeatCount = physicalCount;
+    std::unique_ptr<VkPhysicalDevice[]> repeat(new VkPhysicalDevice[repeatCount]);
+    result = vkEnumeratePhysicalDevices(instance, &repeatCount, repeat.get());
+    ASSERT_EQ(result, VK_SUCCESS);
+    ASSERT_EQ(physicalCount, repeatCount);
+    for (uint32_t iii = 0; iii < physicalCount; iii++) {
+        ASSERT_EQ(physical[iii], repeat[iii]);
+    }
+    ASSERT_EQ(0u, g_intenional_fail_count);
+
+    g_intentional_fail_enabled = false;
+    vkDestroyInstance(instance, &alloc_callbacks);
+
+    // Make sure everything's been freed
+    ASSERT_EQ(true, IsAllocTrackerEmpty());
+    FreeAllocTracker();
+}
+
 TEST(CreateDevice, ExtensionNotPresent) {
     VkInstance instance = VK_NULL_HANDLE;
     VkResult result = vkCreateInstance(VK::InstanceCreateInfo(), VK_NULL_HANDLE, &instance);
@@ -897,6 +951,195 @@ TEST(EnumerateDeviceExtensionProperties, DeviceExtensionEnumerated) {
     vkDestroyInstance(instance, nullptr);
 }
 
+#if !defined(_WIN32)
+// A temporary directory that VK_LAYER_PATH points at for the life of the object, for tests that write their own layer
+// manifests.  The previous VK_LAYER_PATH is restored afterwards.
+class ScratchLayerPath {
+   public:
+    ScratchLayerPath() {
+        char pattern[] = "/tmp/vk_loader_test_XXXXXX";
+        if (mkdtemp(pattern)) {
+            directory_ = pattern;
+        }
+        char const *previous = getenv("VK_LAYER_PATH");
+        had_previous_ = previous != nullptr;
+        if (had_previous_) {
+            previous_ = previous;
+        }
+        setenv("VK_LAYER_PATH", directory_.c_str(), 1);
+    }
+    ~ScratchLayerPath() {
+        for (auto const &file : files_) {
+            unlink(file.c_str());
+        }
+        rmdir(directory_.c_str());
+        if (had_previous_) {
+            setenv("VK_LAYER_PATH", previous_.c_str(), 1);
+        } else {
+            unsetenv("VK_LAYER_PATH");
+        }
+    }
+
+    bool Valid() const { return !directory_.empty(); }
+
+    // Create or overwrite a file in the directory
+    void Write(std::string const &name, std::string const &contents) {
+        std::string const path = directory_ + "/" + name;
+        std::ofstream(path.c_str(), std::ios::binary | std::ios::trunc) << contents;
+        if (std::find(files_.begin(), files_.end(), path) == files_.end()) {
+            files_.push_back(path);
+        }
+    }
+
+   private:
+    std::string directory_;
+    std::string previous_;
+    bool had_previous_;
+    std::vector<std::string> files_;
+};
+
+// Manifest for a layer whose library is never loaded; enumerating layers only reads the manifest.  The strings are
+// written into the JSON as given, so they may hold escapes.
+static std::string LayerManifest(std::string const &name, std::string const &description = "loader test layer",
+                                 std::string const &library_path = "./libVkLayer_not_present.so") {
+    return "{\"file_format_version\": \"1.0.0\", \"layer\": {\"name\": \"" + name +
+           "\", \"type\": \"GLOBAL\", \"library_path\": \"" + library_path +
+           "\", \"api_version\": \"1.0.0\", \"implementation_version\": \"1\", \"description\": \"" + description + "\"}}";
+}
+
+static std::vector<VkLayerProperties> InstanceLayers() {
+    uint32_t count = 0u;
+    EXPECT_EQ(vkEnumerateInstanceLayerProperties(&count, nullptr), VK_SUCCESS);
+    std::vector<VkLayerProperties> properties(count);
+    EXPECT_EQ(vkEnumerateInstanceLayerProperties(&count, properties.data()), VK_SUCCESS);
+    properties.resize(count);
+    return properties;
+}
+
+static std::vector<std::string> InstanceLayerNames() {
+    std::vector<std::string> names;
+    for (auto const &properties : InstanceLayers()) {
+        names.push_back(properties.layerName);
+    }
+    return names;
+}
+
+static bool Contains(std::vector<std::string> const &names, std::string const &name) {
+    return std::find(names.begin(), names.end(), name) != names.end();
+}
+
+// The loader caches manifest scans.  Rewriting a manifest in place, even to one of the same size within the same second,
+// must show up in the next scan.
+TEST(ManifestScanCache, RewrittenManifest) {
+    ScratchLayerPath layer_path;
+    ASSERT_TRUE(layer_path.Valid());
+
+    layer_path.Write("scan_cache.json", LayerManifest("VK_LAYER_LOADERTEST_scan_cache_a"));
+    auto names = InstanceLayerNames();
+    EXPECT_TRUE(Contains(names, "VK_LAYER_LOADERTEST_scan_cache_a"));
+
+    // A repeated scan with nothing changed sees the same layers
+    EXPECT_EQ(InstanceLayerNames(), names);
+
+    layer_path.Write("scan_cache.json", LayerManifest("VK_LAYER_LOADERTEST_scan_cache_b"));
+    names = InstanceLayerNames();
+    EXPECT_FALSE(Contains(names, "VK_LAYER_LOADERTEST_scan_cache_a"));
+    EXPECT_TRUE(Contains(names, "VK_LAYER_LOADERTEST_scan_cache_b"));
+
+    // Adding a manifest changes the directory
+    layer_path.Write("scan_cache_added.json", LayerManifest("VK_LAYER_LOADERTEST_scan_cache_c"));
+    names = InstanceLayerNames();
+    EXPECT_TRUE(Contains(names, "VK_LAYER_LOADERTEST_scan_cache_b"));
+    EXPECT_TRUE(Contains(names, "VK_LAYER_LOADERTEST_scan_cache_c"));
+}
+
+// Backslashes in Windows paths have to be escaped in JSON; strings come back unescaped, with \u escapes as UTF-8
+TEST(ManifestJson, EscapedStrings) {
+    ScratchLayerPath layer_path;
+    ASSERT_TRUE(layer_path.Valid());
+
+    layer_path.Write("escaped.json", LayerManifest("VK_LAYER_LOADERTEST_\\u0065scaped",
+                                                   "C:\\\\VulkanSDK\\\\Bin\\\\VkLayer_test.dll \\u00e9\\ud83d\\ude00\\t\\/",
+                                                   "C:\\\\VulkanSDK\\\\Bin\\\\VkLayer_test.dll"));
+    bool found = false;
+    for (auto const &properties : InstanceLayers()) {
+        if (std::string(properties.layerName) == "VK_LAYER_LOADERTEST_escaped") {
+            found = true;
+            EXPECT_STREQ(properties.description, "C:\\VulkanSDK\\Bin\\VkLayer_test.dll \xC3\xA9\xF0\x9F\x98\x80\t/");
+        }
+    }
+    EXPECT_TRUE(found);
+}
+
+// A manifest that isn't valid JSON is skipped, without affecting the others in the same directory
+TEST(ManifestJson, MalformedManifests) {
+    ScratchLayerPath layer_path;
+    ASSERT_TRUE(layer_path.Valid());
+
+    char const *const bad_descriptions[] = {
+        "\\u0000",        // NUL
+        "\\ud800",        // high surrogate alone
+        "\\ud800\\u0041",  // high surrogate followed by something else
+        "\\udc00",        // low surrogate alone
+        "\\u12G4",        // not hex
+        "\\u12",          // too short
+        "\\",             // escape at the end of the string
+    };
+    std::vector<std::string> bad_names;
+    for (size_t i = 0; i < sizeof(bad_descriptions) / sizeof(bad_descriptions[0]); ++i) {
+        bad_names.push_back("VK_LAYER_LOADERTEST_bad_escape_" + std::to_string(i));
+        layer_path.Write("bad_escape_" + std::to_string(i) + ".json", LayerManifest(bad_names.back(), bad_descriptions[i]));
+    }
+
+    std::string const good = LayerManifest("VK_LAYER_LOADERTEST_good");
+    std::string const bad_structures[] = {
+        "{\"file_format_version\" \"1.0.0\", " + good.substr(good.find("\"layer\"")),  // missing ':'
+        good.substr(0, good.size() - 1) + ",}",                                        // trailing ','
+        "[" + good + ",]",                                                              // trailing ',' in an array
+        good.substr(0, good.find("\"GLOBAL\"")) + "GLOBAL" + good.substr(good.find("\"GLOBAL\"") + 8),  // unquoted string
+    };
+    for (size_t i = 0; i < sizeof(bad_structures) / sizeof(bad_structures[0]); ++i) {
+        std::string name = "VK_LAYER_LOADERTEST_bad_structure_" + std::to_string(i);
+        std::string manifest = bad_structures[i];
+        manifest.replace(manifest.find("VK_LAYER_LOADERTEST_good"), strlen("VK_LAYER_LOADERTEST_good"), name);
+        bad_names.push_back(name);
+        layer_path.Write("bad_structure_" + std::to_string(i) + ".json", manifest);
+    }
+
+    layer_path.Write("good.json", good);
+
+    auto const names = InstanceLayerNames();
+    EXPECT_TRUE(Contains(names, "VK_LAYER_LOADERTEST_good"));
+    for (auto const &name : bad_names) {
+        EXPECT_FALSE(Contains(names, name)) << name;
+    }
+}
+
+// Every truncation of a manifest, down to an empty file, is rejected
+TEST(ManifestJson, TruncatedManifest) {
+    ScratchLayerPath layer_path;
+    ASSERT_TRUE(layer_path.Valid());
+
+    std::string const manifest = LayerManifest("VK_LAYER_LOADERTEST_truncated", "\\u00e9\\ud83d\\ude00");
+    for (size_t length = 0; length < manifest.size(); ++length) {
+        layer_path.Write("truncated.json", manifest.substr(0, length));
+        EXPECT_FALSE(Contains(InstanceLayerNames(), "VK_LAYER_LOADERTEST_truncated")) << "length " << length;
+    }
+    layer_path.Write("truncated.json", manifest);
+    EXPECT_TRUE(Contains(InstanceLayerNames(), "VK_LAYER_LOADERTEST_truncated"));
+}
+
+// Large manifests are mapped rather than read; padding one out with whitespace takes that path
+TEST(ManifestJson, LargeManifest) {
+    ScratchLayerPath layer_path;
+    ASSERT_TRUE(layer_path.Valid());
+
+    std::string const manifest = LayerManifest("VK_LAYER_LOADERTEST_large");
+    layer_path.Write("large.json", manifest.substr(0, manifest.size() - 1) + std::string(256 * 1024, ' ') + "}");
+    EXPECT_TRUE(Contains(InstanceLayerNames(), "VK_LAYER_LOADERTEST_large"));
+}
+#endif  // !defined(_WIN32)
+
 TEST_F(ImplicitLayer, Present) {
     auto const info = VK::InstanceCreateInfo();
     VkInstance instance = VK_NULL_HANDLE;
@@ -1640,6 +1883,120 @@ TEST(EnumeratePhysicalDeviceGroupsKHX, TwoCallIncomplete) {
     vkDestroyInstance(instance, nullptr);
 }
 
+// The UnknownExtension tests register thousands of extension commands the loader knows nothing
+// about, so that every one is routed through a generic trampoline.  They need the stand-in ICD
+// in tests/icd (point VK_ICD_FILENAMES at VkICD_test.json), which implements every
+// vkSyntheticDeviceExt<N> and vkSyntheticPhysicalDeviceExt<N> command by writing N % 8 to its
+// second parameter.  They are disabled so that a run against a real driver skips them; run
+// them with --gtest_also_run_disabled_tests, as run_loader_tests.sh does.  Against any other
+// driver they fail.
+typedef void(VKAPI_PTR *PFN_vkSyntheticExt)(void *dispatchable, uint32_t *pResult);
+static uint32_t const syntheticNameCount = 4096;
+static uint32_t const syntheticFunctionCount = 8;
+
+static bool StandInICDPresent(VkInstance instance) {
+    return vkGetInstanceProcAddr(instance, "vkSyntheticDeviceExt0") != nullptr;
+}
+
+// Query every synthetic name with the given prefix.  Each name the loader accepts must get
+// its own trampoline, names must be accepted in order until the trampolines run out, and
+// asking again must return the same trampoline.
+static void QuerySyntheticNames(VkInstance instance, char const *prefix, std::vector<PFN_vkVoidFunction> &addresses,
+                                uint32_t &boundCount) {
+    addresses.assign(syntheticNameCount, nullptr);
+    boundCount = 0;
+    for (uint32_t i = 0; i < syntheticNameCount; ++i) {
+        addresses[i] = vkGetInstanceProcAddr(instance, (prefix + std::to_string(i)).c_str());
+        if (addresses[i] != nullptr) {
+            ASSERT_EQ(boundCount, i);
+            ++boundCount;
+        }
+    }
+    // More than the original fixed table held, but not unlimited.
+    ASSERT_GT(boundCount, 250u);
+    ASSERT_LT(boundCount, syntheticNameCount);
+
+    std::vector<PFN_vkVoidFunction> unique(addresses.begin(), addresses.begin() + boundCount);
+    std::sort(unique.begin(), unique.end());
+    ASSERT_EQ(std::unique(unique.begin(), unique.end()), unique.end());
+
+    for (uint32_t i = 0; i < syntheticNameCount; ++i) {
+        ASSERT_EQ(addresses[i], vkGetInstanceProcAddr(instance, (prefix + std::to_string(i)).c_str()));
+    }
+}
+
+static void CallSyntheticFunctions(void *dispatchable, std::vector<PFN_vkVoidFunction> const &addresses, uint32_t boundCount) {
+    for (uint32_t i = 0; i < boundCount; ++i) {
+        uint32_t result = UINT32_MAX;
+        reinterpret_cast<PFN_vkSyntheticExt>(addresses[i])(dispatchable, &result);
+        ASSERT_EQ(result, i % syntheticFunctionCount);
+    }
+}
+
+static void CreateSyntheticDevice(VkPhysicalDevice physical, VkDevice &device) {
+    float const priorities[] = {0.0f};  // Temporary required due to MSVC bug.
+    VkDeviceQueueCreateInfo const queueInfo[1]{
+        VK::DeviceQueueCreateInfo().queueFamilyIndex(0).queueCount(1).pQueuePriorities(priorities)};
+    auto const deviceInfo = VK::DeviceCreateInfo().queueCreateInfoCount(1).pQueueCreateInfos(queueInfo);
+    ASSERT_EQ(vkCreateDevice(physical, deviceInfo, nullptr, &device), VK_SUCCESS);
+}
+
+TEST(UnknownExtension, DISABLED_DeviceCommands) {
+    VkInstance instance = VK_NULL_HANDLE;
+    VkResult result = vkCreateInstance(VK::InstanceCreateInfo(), VK_NULL_HANDLE, &instance);
+    ASSERT_EQ(result, VK_SUCCESS);
+    if (!StandInICDPresent(instance)) {
+        vkDestroyInstance(instance, nullptr);
+        FAIL() << "Stand-in ICD not loaded; set VK_ICD_FILENAMES to tests/icd/VkICD_test.json";
+    }
+
+    uint32_t physicalCount = 1;
+    VkPhysicalDevice physical = VK_NULL_HANDLE;
+    result = vkEnumeratePhysicalDevices(instance, &physicalCount, &physical);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    // One device exists before the names are registered and one is created after
+    VkDevice deviceBefore = VK_NULL_HANDLE;
+    CreateSyntheticDevice(physical, deviceBefore);
+
+    std::vector<PFN_vkVoidFunction> addresses;
+    uint32_t boundCount = 0;
+    QuerySyntheticNames(instance, "vkSyntheticDeviceExt", addresses, boundCount);
+
+    VkDevice deviceAfter = VK_NULL_HANDLE;
+    CreateSyntheticDevice(physical, deviceAfter);
+
+    CallSyntheticFunctions(deviceBefore, addresses, boundCount);
+    CallSyntheticFunctions(deviceAfter, addresses, boundCount);
+
+    vkDestroyDevice(deviceAfter, nullptr);
+    vkDestroyDevice(deviceBefore, nullptr);
+    vkDestroyInstance(instance, nullptr);
+}
+
+TEST(UnknownExtension, DISABLED_PhysicalDeviceCommands) {
+    VkInstance instance = VK_NULL_HANDLE;
+    VkResult result = vkCreateInstance(VK::InstanceCreateInfo(), VK_NULL_HANDLE, &instance);
+    ASSERT_EQ(result, VK_SUCCESS);
+    if (!StandInICDPresent(instance)) {
+        vkDestroyInstance(instance, nullptr);
+        FAIL() << "Stand-in ICD not loaded; set VK_ICD_FILENAMES to tests/icd/VkICD_test.json";
+    }
+
+    uint32_t physicalCount = 1;
+    VkPhysicalDevice physical = VK_NULL_HANDLE;
+    result = vkEnumeratePhysicalDevices(instance, &physicalCount, &physical);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    std::vector<PFN_vkVoidFunction> addresses;
+    uint32_t boundCount = 0;
+    QuerySyntheticNames(instance, "vkSyntheticPhysicalDeviceExt", addresses, boundCount);
+
+    CallSyntheticFunctions(physical, addresses, boundCount);
+
+    vkDestroyInstance(instance, nullptr);
+}
+
 int main(int argc, char **argv) {
     int result;
 
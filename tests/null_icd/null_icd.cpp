@@ -0,0 +1,942 @@
+/*
+ * Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Headless null driver for measuring loader and layer overhead without a GPU.  Point
+// VK_ICD_FILENAMES at the VkICD_null.json manifest next to the library to use it.
+//
+// It implements every Vulkan 1.0 command and exposes one physical device with no extensions.
+// Nothing is ever executed: command buffer recording, submission and waits return immediately,
+// fences and queries complete at once, and non-dispatchable handles are unique counter values
+// except for the few objects (memory, buffers, images, events, command pools) whose state later
+// calls have to answer for.  Memory is backed by host memory only once it is mapped.
+//
+// The device reports generous desktop-class limits, every feature, and four memory types, one of
+// them host visible but not coherent.  Set VK_NULL_ICD_PROFILE to a JSON file written by
+// vkjson_info to report that device's properties, features, memory, queue families and formats
+// instead.  Extensions listed in a profile are not reported, since their commands aren't
+// implemented.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+#include <vulkan/vk_icd.h>
+
+#ifdef NULL_ICD_VKJSON_PROFILES
+#include "vkjson.h"
+#endif
+
+// Windows exports come from VkICD_null.def
+#if defined(__GNUC__) && __GNUC__ >= 4
+#define NULL_ICD_EXPORT __attribute__((visibility("default")))
+#else
+#define NULL_ICD_EXPORT
+#endif
+
+namespace null_icd {
+
+// Dispatchable objects only need to carry the loader's dispatch pointer
+struct DispatchableObject {
+    VK_LOADER_DATA loader_data;
+};
+
+struct Instance {
+    VK_LOADER_DATA loader_data;
+    DispatchableObject physical_device;
+};
+
+struct Device {
+    VK_LOADER_DATA loader_data;
+    std::vector<std::vector<DispatchableObject *>> queues;  // by family, then index
+};
+
+struct DeviceMemory {
+    VkDeviceSize size;
+    void *host;  // allocated on first map
+};
+
+struct Buffer {
+    VkDeviceSize size;
+};
+
+struct Image {
+    VkDeviceSize size;
+};
+
+struct Event {
+    std::atomic<bool> signaled;
+};
+
+struct CommandPool {
+    std::unordered_set<DispatchableObject *> command_buffers;
+};
+
+// Alignment reported for every buffer and image, and used for the offset alignment limits
+static const VkDeviceSize kResourceAlignment = 256;
+static const uint32_t kMemoryTypeBits = (1u << 4) - 1;
+
+static std::atomic<uint64_t> next_handle(1);
+
+template <typename Handle>
+static Handle NewHandle() {
+    return (Handle)(uintptr_t)next_handle.fetch_add(1);
+}
+
+template <typename Handle, typename T>
+static Handle ToHandle(T *object) {
+    return (Handle)(uintptr_t)object;
+}
+
+template <typename T, typename Handle>
+static T *FromHandle(Handle handle) {
+    return reinterpret_cast<T *>((uintptr_t)handle);
+}
+
+// Device description reported by the physical device
+struct Profile {
+    VkPhysicalDeviceProperties properties;
+    VkPhysicalDeviceFeatures features;
+    VkPhysicalDeviceMemoryProperties memory;
+    std::vector<VkQueueFamilyProperties> queue_families;
+    bool has_formats;  // if set, formats absent from the map are unsupported
+    std::map<VkFormat, VkFormatProperties> formats;
+};
+
+static void SetDefaultLimits(VkPhysicalDeviceLimits *limits) {
+    limits->maxImageDimension1D = 16384;
+    limits->maxImageDimension2D = 16384;
+    limits->maxImageDimension3D = 2048;
+    limits->maxImageDimensionCube = 16384;
+    limits->maxImageArrayLayers = 2048;
+    limits->maxTexelBufferElements = 128 * 1024 * 1024;
+    limits->maxUniformBufferRange = 64 * 1024;
+    limits->maxStorageBufferRange = UINT32_MAX;
+    limits->maxPushConstantsSize = 256;
+    limits->maxMemoryAllocationCount = UINT32_MAX;
+    limits->maxSamplerAllocationCount = 64 * 1024;
+    limits->bufferImageGranularity = 1024;
+    limits->sparseAddressSpaceSize = 1ULL << 40;
+    limits->maxBoundDescriptorSets = 8;
+    limits->maxPerStageDescriptorSamplers = 1024 * 1024;
+    limits->maxPerStageDescriptorUniformBuffers = 1024 * 1024;
+    limits->maxPerStageDescriptorStorageBuffers = 1024 * 1024;
+    limits->maxPerStageDescriptorSampledImages = 1024 * 1024;
+    limits->maxPerStageDescriptorStorageImages = 1024 * 1024;
+    limits->maxPerStageDescriptorInputAttachments = 1024 * 1024;
+    limits->maxPerStageResources = 1024 * 1024;
+    limits->maxDescriptorSetSamplers = 1024 * 1024;
+    limits->maxDescriptorSetUniformBuffers = 1024 * 1024;
+    limits->maxDescriptorSetUniformBuffersDynamic = 16;
+    limits->maxDescriptorSetStorageBuffers = 1024 * 1024;
+    limits->maxDescriptorSetStorageBuffersDynamic = 16;
+    limits->maxDescriptorSetSampledImages = 1024 * 1024;
+    limits->maxDescriptorSetStorageImages = 1024 * 1024;
+    limits->maxDescriptorSetInputAttachments = 1024 * 1024;
+    limits->maxVertexInputAttributes = 32;
+    limits->maxVertexInputBindings = 32;
+    limits->maxVertexInputAttributeOffset = 2047;
+    limits->maxVertexInputBindingStride = 2048;
+    limits->maxVertexOutputComponents = 128;
+    limits->maxTessellationGenerationLevel = 64;
+    limits->maxTessellationPatchSize = 32;
+    limits->maxTessellationControlPerVertexInputComponents = 128;
+    limits->maxTessellationControlPerVertexOutputComponents = 128;
+    limits->maxTessellationControlPerPatchOutputComponents = 120;
+    limits->maxTessellationControlTotalOutputComponents = 4096;
+    limits->maxTessellationEvaluationInputComponents = 128;
+    limits->maxTessellationEvaluationOutputComponents = 128;
+    limits->maxGeometryShaderInvocations = 32;
+    limits->maxGeometryInputComponents = 128;
+    limits->maxGeometryOutputComponents = 128;
+    limits->maxGeometryOutputVertices = 256;
+    limits->maxGeometryTotalOutputComponents = 1024;
+    limits->maxFragmentInputComponents = 128;
+    limits->maxFragmentOutputAttachments = 8;
+    limits->maxFragmentDualSrcAttachments = 1;
+    limits->maxFragmentCombinedOutputResources = 1024 * 1024;
+    limits->maxComputeSharedMemorySize = 48 * 1024;
+    limits->maxComputeWorkGroupCount[0] = 65535;
+    limits->maxComputeWorkGroupCount[1] = 65535;
+    limits->maxComputeWorkGroupCount[2] = 65535;
+    limits->maxComputeWorkGroupInvocations = 1024;
+    limits->maxComputeWorkGroupSize[0] = 1024;
+    limits->maxComputeWorkGroupSize[1] = 1024;
+    limits->maxComputeWorkGroupSize[2] = 64;
+    limits->subPixelPrecisionBits = 8;
+    limits->subTexelPrecisionBits = 8;
+    limits->mipmapPrecisionBits = 8;
+    limits->maxDrawIndexedIndexValue = UINT32_MAX;
+    limits->maxDrawIndirectCount = UINT32_MAX;
+    limits->maxSamplerLodBias = 16.0f;
+    limits->maxSamplerAnisotropy = 16.0f;
+    limits->maxViewports = 16;
+    limits->maxViewportDimensions[0] = 16384;
+    limits->maxViewportDimensions[1] = 16384;
+    limits->viewportBoundsRange[0] = -32768.0f;
+    limits->viewportBoundsRange[1] = 32767.0f;
+    limits->viewportSubPixelBits = 8;
+    limits->minMemoryMapAlignment = 64;
+    limits->minTexelBufferOffsetAlignment = kResourceAlignment;
+    limits->minUniformBufferOffsetAlignment = kResourceAlignment;
+    limits->minStorageBufferOffsetAlignment = kResourceAlignment;
+    limits->minTexelOffset = -8;
+    limits->maxTexelOffset = 7;
+    limits->minTexelGatherOffset = -32;
+    limits->maxTexelGatherOffset = 31;
+    limits->minInterpolationOffset = -0.5f;
+    limits->maxInterpolationOffset = 0.4375f;
+    limits->subPixelInterpolationOffsetBits = 4;
+    limits->maxFramebufferWidth = 16384;
+    limits->maxFramebufferHeight = 16384;
+    limits->maxFramebufferLayers = 2048;
+    const VkSampleCountFlags sample_counts =
+        VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_2_BIT | VK_SAMPLE_COUNT_4_BIT | VK_SAMPLE_COUNT_8_BIT;
+    limits->framebufferColorSampleCounts = sample_counts;
+    limits->framebufferDepthSampleCounts = sample_counts;
+    limits->framebufferStencilSampleCounts = sample_counts;
+    limits->framebufferNoAttachmentsSampleCounts = sample_counts;
+    limits->maxColorAttachments = 8;
+    limits->sampledImageColorSampleCounts = sample_counts;
+    limits->sampledImageIntegerSampleCounts = sample_counts;
+    limits->sampledImageDepthSampleCounts = sample_counts;
+    limits->sampledImageStencilSampleCounts = sample_counts;
+    limits->storageImageSampleCounts = sample_counts;
+    limits->maxSampleMaskWords = 1;
+    limits->timestampComputeAndGraphics = VK_TRUE;
+    limits->timestampPeriod = 1.0f;
+    limits->maxClipDistances = 8;
+    limits->maxCullDistances = 8;
+    limits->maxCombinedClipAndCullDistances = 8;
+    limits->discreteQueuePriorities = 2;
+    limits->pointSizeRange[0] = 1.0f;
+    limits->pointSizeRange[1] = 2047.0f;
+    limits->lineWidthRange[0] = 1.0f;
+    limits->lineWidthRange[1] = 64.0f;
+    limits->pointSizeGranularity = 0.125f;
+    limits->lineWidthGranularity = 0.125f;
+    limits->strictLines = VK_TRUE;
+    limits->standardSampleLocations = VK_TRUE;
+    limits->optimalBufferCopyOffsetAlignment = 1;
+    limits->optimalBufferCopyRowPitchAlignment = 1;
+    limits->nonCoherentAtomSize = 64;
+}
+
+static void SetDefaultProfile(Profile *profile) {
+    memset(&profile->properties, 0, sizeof(profile->properties));
+    profile->properties.apiVersion = VK_MAKE_VERSION(1, 0, VK_HEADER_VERSION);
+    profile->properties.driverVersion = 1;
+    profile->properties.deviceType = VK_PHYSICAL_DEVICE_TYPE_CPU;
+    strncpy(profile->properties.deviceName, "Null ICD", VK_MAX_PHYSICAL_DEVICE_NAME_SIZE);
+    memcpy(profile->properties.pipelineCacheUUID, "null-icd-cache-1", VK_UUID_SIZE);
+    SetDefaultLimits(&profile->properties.limits);
+
+    // Every member of VkPhysicalDeviceFeatures is a VkBool32
+    VkBool32 *features = reinterpret_cast<VkBool32 *>(&profile->features);
+    for (size_t i = 0; i < sizeof(profile->features) / sizeof(VkBool32); ++i) features[i] = VK_TRUE;
+
+    // Heap 0 is device memory, heap 1 system memory; type 2 makes flush/invalidate paths reachable
+    VkPhysicalDeviceMemoryProperties &memory = profile->memory;
+    memset(&memory, 0, sizeof(memory));
+    memory.memoryHeapCount = 2;
+    memory.memoryHeaps[0] = {8ULL << 30, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT};
+    memory.memoryHeaps[1] = {16ULL << 30, 0};
+    memory.memoryTypeCount = 4;
+    memory.memoryTypes[0] = {VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0};
+    memory.memoryTypes[1] = {VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 1};
+    memory.memoryTypes[2] = {VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT, 1};
+    memory.memoryTypes[3] = {
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 0};
+
+    // A universal family plus async compute and transfer families, as on desktop parts
+    profile->queue_families.clear();
+    const VkQueueFlags universal =
+        VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_SPARSE_BINDING_BIT;
+    profile->queue_families.push_back({universal, 4, 64, {1, 1, 1}});
+    profile->queue_families.push_back({VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, 4, 64, {1, 1, 1}});
+    profile->queue_families.push_back({VK_QUEUE_TRANSFER_BIT, 2, 64, {1, 1, 1}});
+
+    profile->has_formats = false;
+    profile->formats.clear();
+}
+
+#ifdef NULL_ICD_VKJSON_PROFILES
+// Accepts either a single device or a whole instance, in which case its first device is used
+static bool LoadProfile(const char *filename, Profile *profile) {
+    std::ifstream file(filename);
+    if (!file) return false;
+    std::stringstream contents;
+    contents << file.rdbuf();
+
+    VkJsonDevice device;
+    std::string errors;
+    if (!VkJsonDeviceFromJson(contents.str(), &device, &errors)) {
+        VkJsonInstance instance;
+        if (!VkJsonInstanceFromJson(contents.str(), &instance, &errors) || instance.devices.empty()) return false;
+        device = instance.devices[0];
+    }
+
+    profile->properties = device.properties;
+    profile->features = device.features;
+    profile->memory = device.memory;
+    if (!device.queues.empty()) profile->queue_families = device.queues;
+    profile->has_formats = !device.formats.empty();
+    profile->formats = device.formats;
+    return true;
+}
+#endif
+
+static const Profile &GetProfile() {
+    static Profile profile;
+    static std::once_flag once;
+    std::call_once(once, [] {
+        SetDefaultProfile(&profile);
+#ifdef NULL_ICD_VKJSON_PROFILES
+        const char *filename = getenv("VK_NULL_ICD_PROFILE");
+        if (filename && *filename && !LoadProfile(filename, &profile)) SetDefaultProfile(&profile);
+#endif
+    });
+    return profile;
+}
+
+static bool IsDepthStencilFormat(VkFormat format) {
+    return format >= VK_FORMAT_D16_UNORM && format <= VK_FORMAT_D32_SFLOAT_S8_UINT;
+}
+
+static bool IsCompressedFormat(VkFormat format) {
+    return format >= VK_FORMAT_BC1_RGB_UNORM_BLOCK && format <= VK_FORMAT_ASTC_12x12_SRGB_BLOCK;
+}
+
+static VkFormatProperties DefaultFormatProperties(VkFormat format) {
+    VkFormatProperties props = {};
+    if (format == VK_FORMAT_UNDEFINED || format > VK_FORMAT_ASTC_12x12_SRGB_BLOCK) return props;
+
+    const VkFormatFeatureFlags transfer =
+        VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+    if (IsCompressedFormat(format)) {
+        props.optimalTilingFeatures = transfer;
+    } else if (IsDepthStencilFormat(format)) {
+        props.optimalTilingFeatures = transfer | VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT;
+    } else {
+        const VkFormatFeatureFlags color = transfer | VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT |
+                                           VK_FORMAT_FEATURE_STORAGE_IMAGE_ATOMIC_BIT | VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT |
+                                           VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BLEND_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT;
+        props.linearTilingFeatures = color;
+        props.optimalTilingFeatures = color;
+        props.bufferFeatures = VK_FORMAT_FEATURE_UNIFORM_TEXEL_BUFFER_BIT | VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_BIT |
+                               VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_ATOMIC_BIT | VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
+    }
+    return props;
+}
+
+static VkFormatProperties FormatProperties(VkFormat format) {
+    const Profile &profile = GetProfile();
+    if (!profile.has_formats) return DefaultFormatProperties(format);
+    auto it = profile.formats.find(format);
+    if (it == profile.formats.end()) return VkFormatProperties{};
+    return it->second;
+}
+
+// Writes count items of src to pProperties following the usual two-call enumeration idiom
+template <typename T>
+static VkResult EnumerateArray(const T *src, uint32_t count, uint32_t *pCount, T *pProperties) {
+    if (!pProperties) {
+        *pCount = count;
+        return VK_SUCCESS;
+    }
+    const uint32_t copied = *pCount < count ? *pCount : count;
+    for (uint32_t i = 0; i < copied; ++i) pProperties[i] = src[i];
+    *pCount = copied;
+    return copied < count ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+// Commands with nothing to report: void ones do nothing and the rest return VK_SUCCESS
+template <typename F>
+struct NoOp;
+
+template <typename... Args>
+struct NoOp<void(VKAPI_PTR *)(Args...)> {
+    static VKAPI_ATTR void VKAPI_CALL Call(Args...) {}
+};
+
+template <typename... Args>
+struct NoOp<VkResult(VKAPI_PTR *)(Args...)> {
+    static VKAPI_ATTR VkResult VKAPI_CALL Call(Args...) { return VK_SUCCESS; }
+};
+
+// vkCreate<Object>(device, pCreateInfo, pAllocator, pObject) for objects that keep no state
+template <typename F>
+struct CreateHandle;
+
+template <typename Info, typename Handle>
+struct CreateHandle<VkResult(VKAPI_PTR *)(VkDevice, const Info *, const VkAllocationCallbacks *, Handle *)> {
+    static VKAPI_ATTR VkResult VKAPI_CALL Call(VkDevice, const Info *, const VkAllocationCallbacks *, Handle *pHandle) {
+        *pHandle = NewHandle<Handle>();
+        return VK_SUCCESS;
+    }
+};
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreateInfo,
+                                                     const VkAllocationCallbacks *pAllocator, VkInstance *pInstance) {
+    Instance *instance = new Instance();
+    set_loader_magic_value(instance);
+    set_loader_magic_value(&instance->physical_device);
+    *pInstance = reinterpret_cast<VkInstance>(instance);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocationCallbacks *pAllocator) {
+    delete reinterpret_cast<Instance *>(instance);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumerateInstanceExtensionProperties(const char *pLayerName, uint32_t *pPropertyCount,
+                                                                           VkExtensionProperties *pProperties) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumerateInstanceLayerProperties(uint32_t *pPropertyCount, VkLayerProperties *pProperties) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDevices(VkInstance instance, uint32_t *pPhysicalDeviceCount,
+                                                               VkPhysicalDevice *pPhysicalDevices) {
+    VkPhysicalDevice physical_device = reinterpret_cast<VkPhysicalDevice>(&reinterpret_cast<Instance *>(instance)->physical_device);
+    return EnumerateArray(&physical_device, 1, pPhysicalDeviceCount, pPhysicalDevices);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures *pFeatures) {
+    *pFeatures = GetProfile().features;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format,
+                                                                    VkFormatProperties *pFormatProperties) {
+    *pFormatProperties = FormatProperties(format);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format,
+                                                                             VkImageType type, VkImageTiling tiling,
+                                                                             VkImageUsageFlags usage, VkImageCreateFlags flags,
+                                                                             VkImageFormatProperties *pImageFormatProperties) {
+    const VkFormatProperties format_props = FormatProperties(format);
+    const VkFormatFeatureFlags features =
+        tiling == VK_IMAGE_TILING_LINEAR ? format_props.linearTilingFeatures : format_props.optimalTilingFeatures;
+    if (!features) return VK_ERROR_FORMAT_NOT_SUPPORTED;
+
+    const VkPhysicalDeviceLimits &limits = GetProfile().properties.limits;
+    memset(pImageFormatProperties, 0, sizeof(*pImageFormatProperties));
+    switch (type) {
+        case VK_IMAGE_TYPE_1D:
+            pImageFormatProperties->maxExtent = {limits.maxImageDimension1D, 1, 1};
+            break;
+        case VK_IMAGE_TYPE_3D:
+            pImageFormatProperties->maxExtent = {limits.maxImageDimension3D, limits.maxImageDimension3D,
+                                                 limits.maxImageDimension3D};
+            break;
+        default:
+            pImageFormatProperties->maxExtent = {limits.maxImageDimension2D, limits.maxImageDimension2D, 1};
+            break;
+    }
+    uint32_t max_dimension = pImageFormatProperties->maxExtent.width;
+    while (max_dimension) {
+        ++pImageFormatProperties->maxMipLevels;
+        max_dimension >>= 1;
+    }
+    pImageFormatProperties->maxArrayLayers = type == VK_IMAGE_TYPE_3D ? 1 : limits.maxImageArrayLayers;
+    pImageFormatProperties->sampleCounts = VK_SAMPLE_COUNT_1_BIT;
+    if (tiling == VK_IMAGE_TILING_OPTIMAL && type == VK_IMAGE_TYPE_2D) {
+        pImageFormatProperties->sampleCounts = limits.sampledImageColorSampleCounts;
+    }
+    pImageFormatProperties->maxResourceSize = 1ULL << 31;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice,
+                                                              VkPhysicalDeviceProperties *pProperties) {
+    *pProperties = GetProfile().properties;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice,
+                                                                         uint32_t *pQueueFamilyPropertyCount,
+                                                                         VkQueueFamilyProperties *pQueueFamilyProperties) {
+    const std::vector<VkQueueFamilyProperties> &families = GetProfile().queue_families;
+    EnumerateArray(families.data(), static_cast<uint32_t>(families.size()), pQueueFamilyPropertyCount, pQueueFamilyProperties);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties(VkPhysicalDevice physicalDevice,
+                                                                    VkPhysicalDeviceMemoryProperties *pMemoryProperties) {
+    *pMemoryProperties = GetProfile().memory;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format,
+                                                                              VkImageType type, VkSampleCountFlagBits samples,
+                                                                              VkImageUsageFlags usage, VkImageTiling tiling,
+                                                                              uint32_t *pPropertyCount,
+                                                                              VkSparseImageFormatProperties *pProperties) {
+    *pPropertyCount = 0;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char *pLayerName,
+                                                                         uint32_t *pPropertyCount,
+                                                                         VkExtensionProperties *pProperties) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceLayerProperties(VkPhysicalDevice physicalDevice, uint32_t *pPropertyCount,
+                                                                     VkLayerProperties *pProperties) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo *pCreateInfo,
+                                                   const VkAllocationCallbacks *pAllocator, VkDevice *pDevice) {
+    Device *device = new Device();
+    set_loader_magic_value(device);
+    device->queues.resize(GetProfile().queue_families.size());
+    for (uint32_t i = 0; i < pCreateInfo->queueCreateInfoCount; ++i) {
+        const VkDeviceQueueCreateInfo &queue_info = pCreateInfo->pQueueCreateInfos[i];
+        if (queue_info.queueFamilyIndex >= device->queues.size()) continue;
+        auto &family = device->queues[queue_info.queueFamilyIndex];
+        while (family.size() < queue_info.queueCount) {
+            DispatchableObject *queue = new DispatchableObject();
+            set_loader_magic_value(queue);
+            family.push_back(queue);
+        }
+    }
+    *pDevice = reinterpret_cast<VkDevice>(device);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    Device *null_device = reinterpret_cast<Device *>(device);
+    if (!null_device) return;
+    for (auto &family : null_device->queues) {
+        for (auto queue : family) delete queue;
+    }
+    delete null_device;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue *pQueue) {
+    *pQueue = reinterpret_cast<VkQueue>(reinterpret_cast<Device *>(device)->queues[queueFamilyIndex][queueIndex]);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pAllocateInfo,
+                                                     const VkAllocationCallbacks *pAllocator, VkDeviceMemory *pMemory) {
+    DeviceMemory *memory = new DeviceMemory();
+    memory->size = pAllocateInfo->allocationSize;
+    memory->host = nullptr;
+    *pMemory = ToHandle<VkDeviceMemory>(memory);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL FreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks *pAllocator) {
+    DeviceMemory *null_memory = FromHandle<DeviceMemory>(memory);
+    if (!null_memory) return;
+    free(null_memory->host);
+    delete null_memory;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL MapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size,
+                                                VkMemoryMapFlags flags, void **ppData) {
+    DeviceMemory *null_memory = FromHandle<DeviceMemory>(memory);
+    if (!null_memory->host) {
+        null_memory->host = calloc(1, static_cast<size_t>(null_memory->size));
+        if (!null_memory->host) return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+    *ppData = static_cast<char *>(null_memory->host) + offset;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory,
+                                                            VkDeviceSize *pCommittedMemoryInBytes) {
+    *pCommittedMemoryInBytes = FromHandle<DeviceMemory>(memory)->size;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo,
+                                                   const VkAllocationCallbacks *pAllocator, VkBuffer *pBuffer) {
+    Buffer *buffer = new Buffer();
+    buffer->size = pCreateInfo->size;
+    *pBuffer = ToHandle<VkBuffer>(buffer);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator) {
+    delete FromHandle<Buffer>(buffer);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(VkDevice device, VkBuffer buffer,
+                                                              VkMemoryRequirements *pMemoryRequirements) {
+    const VkDeviceSize size = FromHandle<Buffer>(buffer)->size;
+    pMemoryRequirements->size = (size + kResourceAlignment - 1) & ~(kResourceAlignment - 1);
+    pMemoryRequirements->alignment = kResourceAlignment;
+    pMemoryRequirements->memoryTypeBits = kMemoryTypeBits;
+}
+
+// Sized for the largest texel of any format, with a full mip chain
+static VKAPI_ATTR VkResult VKAPI_CALL CreateImage(VkDevice device, const VkImageCreateInfo *pCreateInfo,
+                                                  const VkAllocationCallbacks *pAllocator, VkImage *pImage) {
+    Image *image = new Image();
+    VkDeviceSize texels = static_cast<VkDeviceSize>(pCreateInfo->extent.width) * pCreateInfo->extent.height *
+                          pCreateInfo->extent.depth * pCreateInfo->arrayLayers * pCreateInfo->samples;
+    image->size = (texels * 16 * 4 / 3 + kResourceAlignment - 1) & ~(kResourceAlignment - 1);
+    *pImage = ToHandle<VkImage>(image);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator) {
+    delete FromHandle<Image>(image);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(VkDevice device, VkImage image,
+                                                             VkMemoryRequirements *pMemoryRequirements) {
+    pMemoryRequirements->size = FromHandle<Image>(image)->size;
+    pMemoryRequirements->alignment = kResourceAlignment;
+    pMemoryRequirements->memoryTypeBits = kMemoryTypeBits;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements(VkDevice device, VkImage image,
+                                                                   uint32_t *pSparseMemoryRequirementCount,
+                                                                   VkSparseImageMemoryRequirements *pSparseMemoryRequirements) {
+    *pSparseMemoryRequirementCount = 0;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource *pSubresource,
+                                                            VkSubresourceLayout *pLayout) {
+    memset(pLayout, 0, sizeof(*pLayout));
+    pLayout->size = FromHandle<Image>(image)->size;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(VkDevice device, const VkEventCreateInfo *pCreateInfo,
+                                                  const VkAllocationCallbacks *pAllocator, VkEvent *pEvent) {
+    Event *event = new Event();
+    event->signaled = false;
+    *pEvent = ToHandle<VkEvent>(event);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks *pAllocator) {
+    delete FromHandle<Event>(event);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetEventStatus(VkDevice device, VkEvent event) {
+    return FromHandle<Event>(event)->signaled ? VK_EVENT_SET : VK_EVENT_RESET;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL SetEvent(VkDevice device, VkEvent event) {
+    FromHandle<Event>(event)->signaled = true;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL ResetEvent(VkDevice device, VkEvent event) {
+    FromHandle<Event>(event)->signaled = false;
+    return VK_SUCCESS;
+}
+
+// Every query has completed with a result of zero
+static VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery,
+                                                          uint32_t queryCount, size_t dataSize, void *pData, VkDeviceSize stride,
+                                                          VkQueryResultFlags flags) {
+    memset(pData, 0, dataSize);
+    return VK_SUCCESS;
+}
+
+// Only the header that the spec requires of every pipeline cache blob
+static VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t *pDataSize,
+                                                           void *pData) {
+    const VkPhysicalDeviceProperties &properties = GetProfile().properties;
+    const uint32_t header[4] = {16 + VK_UUID_SIZE, VK_PIPELINE_CACHE_HEADER_VERSION_ONE, properties.vendorID, properties.deviceID};
+    const size_t header_size = sizeof(header) + VK_UUID_SIZE;
+    if (!pData) {
+        *pDataSize = header_size;
+        return VK_SUCCESS;
+    }
+    if (*pDataSize < header_size) {
+        *pDataSize = 0;
+        return VK_INCOMPLETE;
+    }
+    memcpy(pData, header, sizeof(header));
+    memcpy(static_cast<char *>(pData) + sizeof(header), properties.pipelineCacheUUID, VK_UUID_SIZE);
+    *pDataSize = header_size;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache,
+                                                              uint32_t createInfoCount,
+                                                              const VkGraphicsPipelineCreateInfo *pCreateInfos,
+                                                              const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines) {
+    for (uint32_t i = 0; i < createInfoCount; ++i) pPipelines[i] = NewHandle<VkPipeline>();
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache,
+                                                             uint32_t createInfoCount,
+                                                             const VkComputePipelineCreateInfo *pCreateInfos,
+                                                             const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines) {
+    for (uint32_t i = 0; i < createInfoCount; ++i) pPipelines[i] = NewHandle<VkPipeline>();
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo,
+                                                             VkDescriptorSet *pDescriptorSets) {
+    for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; ++i) pDescriptorSets[i] = NewHandle<VkDescriptorSet>();
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D *pGranularity) {
+    *pGranularity = {1, 1};
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo *pCreateInfo,
+                                                        const VkAllocationCallbacks *pAllocator, VkCommandPool *pCommandPool) {
+    *pCommandPool = ToHandle<VkCommandPool>(new CommandPool());
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(VkDevice device, VkCommandPool commandPool,
+                                                     const VkAllocationCallbacks *pAllocator) {
+    CommandPool *pool = FromHandle<CommandPool>(commandPool);
+    if (!pool) return;
+    for (auto command_buffer : pool->command_buffers) delete command_buffer;
+    delete pool;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllocateInfo,
+                                                             VkCommandBuffer *pCommandBuffers) {
+    CommandPool *pool = FromHandle<CommandPool>(pAllocateInfo->commandPool);
+    for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; ++i) {
+        DispatchableObject *command_buffer = new DispatchableObject();
+        set_loader_magic_value(command_buffer);
+        pool->command_buffers.insert(command_buffer);
+        pCommandBuffers[i] = reinterpret_cast<VkCommandBuffer>(command_buffer);
+    }
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
+                                                     const VkCommandBuffer *pCommandBuffers) {
+    CommandPool *pool = FromHandle<CommandPool>(commandPool);
+    for (uint32_t i = 0; i < commandBufferCount; ++i) {
+        DispatchableObject *command_buffer = reinterpret_cast<DispatchableObject *>(pCommandBuffers[i]);
+        if (pool->command_buffers.erase(command_buffer)) delete command_buffer;
+    }
+}
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char *pName);
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance, const char *pName);
+
+#define NULL_ICD_ENTRY(name) \
+    { "vk" #name, reinterpret_cast<PFN_vkVoidFunction>(name) }
+#define NULL_ICD_NO_OP(name) \
+    { "vk" #name, reinterpret_cast<PFN_vkVoidFunction>(NoOp<PFN_vk##name>::Call) }
+#define NULL_ICD_CREATE(name) \
+    { "vk" #name, reinterpret_cast<PFN_vkVoidFunction>(CreateHandle<PFN_vk##name>::Call) }
+
+struct FunctionEntry {
+    const char *name;
+    PFN_vkVoidFunction function;
+};
+
+static const FunctionEntry functions[] = {
+    NULL_ICD_ENTRY(CreateInstance),
+    NULL_ICD_ENTRY(DestroyInstance),
+    NULL_ICD_ENTRY(EnumeratePhysicalDevices),
+    NULL_ICD_ENTRY(GetPhysicalDeviceFeatures),
+    NULL_ICD_ENTRY(GetPhysicalDeviceFormatProperties),
+    NULL_ICD_ENTRY(GetPhysicalDeviceImageFormatProperties),
+    NULL_ICD_ENTRY(GetPhysicalDeviceProperties),
+    NULL_ICD_ENTRY(GetPhysicalDeviceQueueFamilyProperties),
+    NULL_ICD_ENTRY(GetPhysicalDeviceMemoryProperties),
+    NULL_ICD_ENTRY(GetInstanceProcAddr),
+    NULL_ICD_ENTRY(GetDeviceProcAddr),
+    NULL_ICD_ENTRY(CreateDevice),
+    NULL_ICD_ENTRY(DestroyDevice),
+    NULL_ICD_ENTRY(EnumerateInstanceExtensionProperties),
+    NULL_ICD_ENTRY(EnumerateDeviceExtensionProperties),
+    NULL_ICD_ENTRY(EnumerateInstanceLayerProperties),
+    NULL_ICD_ENTRY(EnumerateDeviceLayerProperties),
+    NULL_ICD_ENTRY(GetDeviceQueue),
+    NULL_ICD_NO_OP(QueueSubmit),
+    NULL_ICD_NO_OP(QueueWaitIdle),
+    NULL_ICD_NO_OP(DeviceWaitIdle),
+    NULL_ICD_ENTRY(AllocateMemory),
+    NULL_ICD_ENTRY(FreeMemory),
+    NULL_ICD_ENTRY(MapMemory),
+    NULL_ICD_NO_OP(UnmapMemory),
+    NULL_ICD_NO_OP(FlushMappedMemoryRanges),
+    NULL_ICD_NO_OP(InvalidateMappedMemoryRanges),
+    NULL_ICD_ENTRY(GetDeviceMemoryCommitment),
+    NULL_ICD_NO_OP(BindBufferMemory),
+    NULL_ICD_NO_OP(BindImageMemory),
+    NULL_ICD_ENTRY(GetBufferMemoryRequirements),
+    NULL_ICD_ENTRY(GetImageMemoryRequirements),
+    NULL_ICD_ENTRY(GetImageSparseMemoryRequirements),
+    NULL_ICD_ENTRY(GetPhysicalDeviceSparseImageFormatProperties),
+    NULL_ICD_NO_OP(QueueBindSparse),
+    NULL_ICD_CREATE(CreateFence),
+    NULL_ICD_NO_OP(DestroyFence),
+    NULL_ICD_NO_OP(ResetFences),
+    NULL_ICD_NO_OP(GetFenceStatus),
+    NULL_ICD_NO_OP(WaitForFences),
+    NULL_ICD_CREATE(CreateSemaphore),
+    NULL_ICD_NO_OP(DestroySemaphore),
+    NULL_ICD_ENTRY(CreateEvent),
+    NULL_ICD_ENTRY(DestroyEvent),
+    NULL_ICD_ENTRY(GetEventStatus),
+    NULL_ICD_ENTRY(SetEvent),
+    NULL_ICD_ENTRY(ResetEvent),
+    NULL_ICD_CREATE(CreateQueryPool),
+    NULL_ICD_NO_OP(DestroyQueryPool),
+    NULL_ICD_ENTRY(GetQueryPoolResults),
+    NULL_ICD_ENTRY(CreateBuffer),
+    NULL_ICD_ENTRY(DestroyBuffer),
+    NULL_ICD_CREATE(CreateBufferView),
+    NULL_ICD_NO_OP(DestroyBufferView),
+    NULL_ICD_ENTRY(CreateImage),
+    NULL_ICD_ENTRY(DestroyImage),
+    NULL_ICD_ENTRY(GetImageSubresourceLayout),
+    NULL_ICD_CREATE(CreateImageView),
+    NULL_ICD_NO_OP(DestroyImageView),
+    NULL_ICD_CREATE(CreateShaderModule),
+    NULL_ICD_NO_OP(DestroyShaderModule),
+    NULL_ICD_CREATE(CreatePipelineCache),
+    NULL_ICD_NO_OP(DestroyPipelineCache),
+    NULL_ICD_ENTRY(GetPipelineCacheData),
+    NULL_ICD_NO_OP(MergePipelineCaches),
+    NULL_ICD_ENTRY(CreateGraphicsPipelines),
+    NULL_ICD_ENTRY(CreateComputePipelines),
+    NULL_ICD_NO_OP(DestroyPipeline),
+    NULL_ICD_CREATE(CreatePipelineLayout),
+    NULL_ICD_NO_OP(DestroyPipelineLayout),
+    NULL_ICD_CREATE(CreateSampler),
+    NULL_ICD_NO_OP(DestroySampler),
+    NULL_ICD_CREATE(CreateDescriptorSetLayout),
+    NULL_ICD_NO_OP(DestroyDescriptorSetLayout),
+    NULL_ICD_CREATE(CreateDescriptorPool),
+    NULL_ICD_NO_OP(DestroyDescriptorPool),
+    NULL_ICD_NO_OP(ResetDescriptorPool),
+    NULL_ICD_ENTRY(AllocateDescriptorSets),
+    NULL_ICD_NO_OP(FreeDescriptorSets),
+    NULL_ICD_NO_OP(UpdateDescriptorSets),
+    NULL_ICD_CREATE(CreateFramebuffer),
+    NULL_ICD_NO_OP(DestroyFramebuffer),
+    NULL_ICD_CREATE(CreateRenderPass),
+    NULL_ICD_NO_OP(DestroyRenderPass),
+    NULL_ICD_ENTRY(GetRenderAreaGranularity),
+    NULL_ICD_ENTRY(CreateCommandPool),
+    NULL_ICD_ENTRY(DestroyCommandPool),
+    NULL_ICD_NO_OP(ResetCommandPool),
+    NULL_ICD_ENTRY(AllocateCommandBuffers),
+    NULL_ICD_ENTRY(FreeCommandBuffers),
+    NULL_ICD_NO_OP(BeginCommandBuffer),
+    NULL_ICD_NO_OP(EndCommandBuffer),
+    NULL_ICD_NO_OP(ResetCommandBuffer),
+    NULL_ICD_NO_OP(CmdBindPipeline),
+    NULL_ICD_NO_OP(CmdSetViewport),
+    NULL_ICD_NO_OP(CmdSetScissor),
+    NULL_ICD_NO_OP(CmdSetLineWidth),
+    NULL_ICD_NO_OP(CmdSetDepthBias),
+    NULL_ICD_NO_OP(CmdSetBlendConstants),
+    NULL_ICD_NO_OP(CmdSetDepthBounds),
+    NULL_ICD_NO_OP(CmdSetStencilCompareMask),
+    NULL_ICD_NO_OP(CmdSetStencilWriteMask),
+    NULL_ICD_NO_OP(CmdSetStencilReference),
+    NULL_ICD_NO_OP(CmdBindDescriptorSets),
+    NULL_ICD_NO_OP(CmdBindIndexBuffer),
+    NULL_ICD_NO_OP(CmdBindVertexBuffers),
+    NULL_ICD_NO_OP(CmdDraw),
+    NULL_ICD_NO_OP(CmdDrawIndexed),
+    NULL_ICD_NO_OP(CmdDrawIndirect),
+    NULL_ICD_NO_OP(CmdDrawIndexedIndirect),
+    NULL_ICD_NO_OP(CmdDispatch),
+    NULL_ICD_NO_OP(CmdDispatchIndirect),
+    NULL_ICD_NO_OP(CmdCopyBuffer),
+    NULL_ICD_NO_OP(CmdCopyImage),
+    NULL_ICD_NO_OP(CmdBlitImage),
+    NULL_ICD_NO_OP(CmdCopyBufferToImage),
+    NULL_ICD_NO_OP(CmdCopyImageToBuffer),
+    NULL_ICD_NO_OP(CmdUpdateBuffer),
+    NULL_ICD_NO_OP(CmdFillBuffer),
+    NULL_ICD_NO_OP(CmdClearColorImage),
+    NULL_ICD_NO_OP(CmdClearDepthStencilImage),
+    NULL_ICD_NO_OP(CmdClearAttachments),
+    NULL_ICD_NO_OP(CmdResolveImage),
+    NULL_ICD_NO_OP(CmdSetEvent),
+    NULL_ICD_NO_OP(CmdResetEvent),
+    NULL_ICD_NO_OP(CmdWaitEvents),
+    NULL_ICD_NO_OP(CmdPipelineBarrier),
+    NULL_ICD_NO_OP(CmdBeginQuery),
+    NULL_ICD_NO_OP(CmdEndQuery),
+    NULL_ICD_NO_OP(CmdResetQueryPool),
+    NULL_ICD_NO_OP(CmdWriteTimestamp),
+    NULL_ICD_NO_OP(CmdCopyQueryPoolResults),
+    NULL_ICD_NO_OP(CmdPushConstants),
+    NULL_ICD_NO_OP(CmdBeginRenderPass),
+    NULL_ICD_NO_OP(CmdNextSubpass),
+    NULL_ICD_NO_OP(CmdEndRenderPass),
+    NULL_ICD_NO_OP(CmdExecuteCommands),
+};
+
+#undef NULL_ICD_ENTRY
+#undef NULL_ICD_NO_OP
+#undef NULL_ICD_CREATE
+
+static PFN_vkVoidFunction LookupFunction(const char *pName) {
+    for (const auto &entry : functions) {
+        if (!strcmp(pName, entry.name)) return entry.function;
+    }
+    return nullptr;
+}
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char *pName) {
+    return LookupFunction(pName);
+}
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance, const char *pName) {
+    return LookupFunction(pName);
+}
+
+}  // namespace null_icd
+
+extern "C" {
+
+NULL_ICD_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vk_icdNegotiateLoaderICDInterfaceVersion(uint32_t *pSupportedVersion) {
+    if (*pSupportedVersion > CURRENT_LOADER_ICD_INTERFACE_VERSION) *pSupportedVersion = CURRENT_LOADER_ICD_INTERFACE_VERSION;
+    return VK_SUCCESS;
+}
+
+NULL_ICD_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_icdGetInstanceProcAddr(VkInstance instance, const char *pName) {
+    return null_icd::LookupFunction(pName);
+}
+
+// No physical device commands beyond the core ones exist
+NULL_ICD_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_icdGetPhysicalDeviceProcAddr(VkInstance instance, const char *pName) {
+    return nullptr;
+}
+
+}  // extern "C"
@@ -132,12 +132,30 @@ RunEnumerateInstanceExtensionPropertiesTest()
     echo "EnumerateInstanceExtensionProperties OnePass vs TwoPass test PASSED"
 }
 
+RunUnknownExtensionTest()
+{
+    # Register thousands of unknown extension commands through the stand-in ICD.
+    output=$(VK_ICD_FILENAMES=./icd/VkICD_test.json \
+       GTEST_FILTER=UnknownExtension.* \
+       ./vk_loader_validation_tests --gtest_also_run_disabled_tests 2>&1)
+    ec=$?
+
+    if [ $ec -ne 0 ] || ! echo "$output" | grep -q "\[  PASSED  \] 2 tests"
+    then
+        echo "$output" >&2
+        echo "Unknown extension test FAILED" >&2
+        exit 1
+    fi
+    echo "Unknown extension test PASSED"
+}
+
 ./vk_loader_validation_tests
 
 RunEnvironmentVariablePathsTest
 RunCreateInstanceTest
 RunEnumerateInstanceLayerPropertiesTest
 RunEnumerateInstanceExtensionPropertiesTest
+RunUnknownExtensionTest
 
 # Test the wrap objects layer.
 ./run_wrap_objects_tests.sh || exit 1